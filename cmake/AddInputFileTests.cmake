@@ -38,9 +38,42 @@ function(add_single_input_file_test INPUT_FILE EXECUTABLE CHECK_TYPE TIMEOUT)
       COMMAND ${CMAKE_BINARY_DIR}/bin/${EXECUTABLE}
       --input-file ${INPUT_FILE}
       )
+  elseif("${CHECK_TYPE}" STREQUAL "restart")
+    # Run the simulation, which must write Checkpoint_0000, to the end. Then
+    # restart it from that checkpoint in another directory and compare the
+    # reduction data written after the checkpoint. Each input file gets its
+    # own directory so the checkpoints of different tests do not collide.
+    set(RESTART_DIR "${CMAKE_BINARY_DIR}/tmp/${EXECUTABLE}.${INPUT_FILE_NAME}")
+    if(H5PY_FOUND)
+      set(COMPARE_REDUCTION_DATA "&& \
+${PYTHON_EXECUTABLE} \
+${CMAKE_SOURCE_DIR}/tools/CompareRestartedReductionData.py \
+--straight-through ${RESTART_DIR}/StraightThrough/TimeSeriesData.h5 \
+--restarted ${RESTART_DIR}/Restarted/TimeSeriesData.h5")
+    else()
+      set(COMPARE_REDUCTION_DATA "")
+    endif()
+    add_test(
+      NAME "${CTEST_NAME}"
+      COMMAND sh -c
+      "rm -rf ${RESTART_DIR} && \
+mkdir -p ${RESTART_DIR}/StraightThrough ${RESTART_DIR}/Restarted && \
+cd ${RESTART_DIR}/StraightThrough && \
+${CMAKE_BINARY_DIR}/bin/${EXECUTABLE} --input-file ${INPUT_FILE} && \
+cp -r Checkpoint_0000 ${RESTART_DIR}/Restarted && \
+cd ${RESTART_DIR}/Restarted && \
+${CMAKE_BINARY_DIR}/bin/${EXECUTABLE} +restart Checkpoint_0000 \
+${COMPARE_REDUCTION_DATA}"
+      )
+    # The pass expression makes CTest ignore the exit code, so a failed
+    # comparison is caught by the "ERROR" it prints.
+    set_tests_properties(
+      "${CTEST_NAME}"
+      PROPERTIES
+      PASS_REGULAR_EXPRESSION "Restarted from Checkpoint_0000")
   else()
     message(FATAL_ERROR "Unknown Check for input file: ${CHECK_TYPE}."
-      "Known checks are: execute")
+      "Known checks are: execute, restart")
   endif()
 
   set_tests_properties(
@@ -61,7 +94,12 @@ endfunction()
 # OR
 # '# Check:'
 # If 'execute' is present then the input file will not just be parsed,
-# but the simulation will be run.
+# but the simulation will be run. If 'restart' is present then the
+# simulation is run and then restarted from the first checkpoint it wrote,
+# so the input file must trigger a WriteCheckpoint event. If h5py is
+# available, the reduction data written after the restart is compared to
+# that of the run without restart, so the input file must also observe
+# reduction data both before and after the checkpoint.
 function(add_input_file_tests INPUT_FILE_DIR)
   set(INPUT_FILE_LIST "")
   file(GLOB_RECURSE INPUT_FILE_LIST ${INPUT_FILE_DIR} "${INPUT_FILE_DIR}*.yaml")
@@ -82,7 +120,7 @@ function(add_input_file_tests INPUT_FILE_DIR)
       INPUT_FILE_EXECUTABLE "${INPUT_FILE_EXECUTABLE}")
     string(STRIP "${INPUT_FILE_EXECUTABLE}" INPUT_FILE_EXECUTABLE)
 
-    # Read what tests to do. Currently only "execute" is available
+    # Read what tests to do. Currently "execute" and "restart" are available
     # "parse" is ignored because it's always run, empty is accepted.
     string(REGEX MATCH "#[ ]*Check:[^\n]+"
       INPUT_FILE_CHECKS "${INPUT_FILE_CONTENTS}")
@@ -105,6 +143,21 @@ function(add_input_file_tests INPUT_FILE_DIR)
   endforeach()
 endfunction()
 
+# The restart check compares the reduction data with h5py if it is available.
+find_package(PythonInterp REQUIRED)
+execute_process(
+  COMMAND "${PYTHON_EXECUTABLE}" "-c" "import h5py, numpy"
+  RESULT_VARIABLE H5PY_IMPORT_RESULT
+  OUTPUT_QUIET
+  ERROR_QUIET)
+if(H5PY_IMPORT_RESULT EQUAL 0)
+  set(H5PY_FOUND TRUE)
+else()
+  set(H5PY_FOUND FALSE)
+  message(STATUS "h5py not found, so the restart checks of the input files "
+    "do not compare the reduction data")
+endif()
+
 # Dependencies will be added as the tests are processed.
 add_custom_target(test-executables)
 
@@ -41,8 +41,14 @@ def create_interface_file(args):
               "    entry [reductiontarget] void reduction_action(Arg arg);\n" \
               "\n" \
               "    entry void perform_algorithm();\n" \
+              "\n" \
+              "    entry void perform_algorithm(bool);\n" \
               "\n" % (args['algorithm_name'], args['algorithm_name'])
 
+    if args['algorithm_type'] == "array":
+        ci_str += "    entry void start_load_balancing();\n" \
+            "\n"
+
     if (args['algorithm_type'] == "nodegroup"):
         ci_str += "    template <typename Action, typenameLDOTLDOTLDOT Args>\n" \
             "    entry void threaded_action(\n" \
@@ -145,9 +151,28 @@ def create_header_file(args):
         " public:\n" \
         "  using Parallel::AlgorithmImpl<ParallelComponent,\n" \
         "                  typename ParallelComponent::action_list\n" \
-        "                  >::AlgorithmImpl;\n" \
-        "};\n\n" % (args['algorithm_name'],
+        "                  >::AlgorithmImpl;\n" % (args['algorithm_name'],
                     args['algorithm_name'], args['algorithm_name'])
+    # Array elements are serialized when they migrate during load balancing,
+    # and arrays, groups and nodegroups are serialized when writing a
+    # checkpoint. Charm++ does not checkpoint plain chares.
+    if args['algorithm_type'] != "chare":
+        header_str += \
+            "\n" \
+            "  // NOLINTNEXTLINE(google-runtime-references)\n" \
+            "  void pup(PUP::er& p) override {\n" \
+            "    CBase_Algorithm%s<ParallelComponent,\n" \
+            "                      SpectreArrayIndex>::pup(p);\n" \
+            "    Parallel::AlgorithmImpl<ParallelComponent,\n" \
+            "                  typename ParallelComponent::action_list>" \
+            "::pup(p);\n" \
+            "  }\n" % args['algorithm_name']
+    else:
+        header_str += \
+            "  using CBase_Algorithm%s<ParallelComponent,\n" \
+            "                        SpectreArrayIndex>::pup;\n" % \
+            args['algorithm_name']
+    header_str += "};\n\n"
     # Write include of the def file, but including only the template definitions
     header_str += "#define CK_TEMPLATES_ONLY\n" \
                   "#include \"Algorithms/Algorithm%s.def.h\"\n" \
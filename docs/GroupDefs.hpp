@@ -629,13 +629,28 @@ function is called on all parallel components. Once all parallel components'
 `initialize` function is complete, the next phase is determined and the
 `execute_next_phase` function is called after on all the parallel components.
 
-At the end of an execution the `Exit` phase has the executable wait to make sure
-no parallel components are performing or need to perform any more tasks, and
-then exits. An example where this approach is important is if we are done
+At the end of an execution the `Exit` phase is passed to the
+`execute_next_phase` function of all parallel components so that they can
+finish up, e.g. write buffered data to disk. The executable then waits to make
+sure no parallel components are performing or need to perform any more tasks,
+and exits. An example where this approach is important is if we are done
 evolving a system but still need to write data to disk. We do not want to exit
 the simulation until all data has been written to disk, even though we've
 reached the final time of the evolution.
 
+A parallel component can also interrupt the current phase by calling
+`Parallel::Main::request_phase` on the proxy returned by
+`ConstGlobalCache::main_proxy()`. The requested phase is executed once the
+current phase has ended, after which the interrupted phase is resumed. This is
+how the `Events::LoadBalancing` and `Events::WriteCheckpoint` events pause an
+evolution. If the `Phase` enum class has a `WriteCheckpoint` phase,
+`Parallel::Main` writes a Charm++ checkpoint of all parallel components at the
+end of that phase, one file per processor in the directory `Checkpoint_NNNN`.
+The executable can be restarted from the checkpoint by passing
+`+restart Checkpoint_NNNN` on the command line, in which case it resumes the
+phase that was interrupted by the checkpoint. Singleton parallel components are
+plain Charm++ chares and are not checkpointed.
+
 ### The Algorithm
 
 Since most numerical algorithms repeat steps until some criterion such as the
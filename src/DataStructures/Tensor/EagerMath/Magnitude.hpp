@@ -3,14 +3,18 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
+// @{
 /*!
  * \ingroup TensorGroup
  * \brief Compute the Euclidean magnitude of a rank-1 tensor
@@ -19,12 +23,28 @@
  * Computes the square root of the sum of the squares of the components of
  * the rank-1 tensor.
  */
+template <typename DataType, typename Index>
+void magnitude(
+    const gsl::not_null<Scalar<DataType>*> result,
+    const Tensor<DataType, Symmetry<1>, index_list<Index>>& vector) noexcept {
+  destructive_resize_components(result, get_size(vector.get(0)));
+  get(*result) = square(vector.get(0));
+  for (size_t d = 1; d < vector.index_dim(0); ++d) {
+    get(*result) += square(vector.get(d));
+  }
+  get(*result) = sqrt(get(*result));
+}
+
 template <typename DataType, typename Index>
 Scalar<DataType> magnitude(
     const Tensor<DataType, Symmetry<1>, index_list<Index>>& vector) noexcept {
-  return Scalar<DataType>{sqrt(get(dot_product(vector, vector)))};
+  Scalar<DataType> result{};
+  magnitude(make_not_null(&result), vector);
+  return result;
 }
+// @}
 
+// @{
 /*!
  * \ingroup TensorGroup
  * \brief Compute the magnitude of a rank-1 tensor
@@ -33,6 +53,25 @@ Scalar<DataType> magnitude(
  * Returns the square root of the input tensor contracted twice with the given
  * metric.
  */
+template <typename DataType, typename Index>
+void magnitude(
+    const gsl::not_null<Scalar<DataType>*> result,
+    const Tensor<DataType, Symmetry<1>, index_list<Index>>& vector,
+    const Tensor<DataType, Symmetry<1, 1>,
+                 index_list<change_index_up_lo<Index>,
+                            change_index_up_lo<Index>>>&
+        metric) noexcept {
+  destructive_resize_components(result, get_size(vector.get(0)));
+  get(*result) = 0.0;
+  for (size_t a = 0; a < vector.index_dim(0); ++a) {
+    get(*result) += metric.get(a, a) * square(vector.get(a));
+    for (size_t b = a + 1; b < vector.index_dim(0); ++b) {
+      get(*result) += 2.0 * metric.get(a, b) * vector.get(a) * vector.get(b);
+    }
+  }
+  get(*result) = sqrt(get(*result));
+}
+
 template <typename DataType, typename Index>
 Scalar<DataType> magnitude(
     const Tensor<DataType, Symmetry<1>, index_list<Index>>& vector,
@@ -40,8 +79,11 @@ Scalar<DataType> magnitude(
                  index_list<change_index_up_lo<Index>,
                             change_index_up_lo<Index>>>&
         metric) noexcept {
-  return Scalar<DataType>{sqrt(get(dot_product(vector, vector, metric)))};
+  Scalar<DataType> result{};
+  magnitude(make_not_null(&result), vector, metric);
+  return result;
 }
+// @}
 
 namespace Tags {
 /// \ingroup DataBoxTagsGroup
@@ -66,8 +108,9 @@ struct Magnitude : db::PrefixTag, db::SimpleTag {
 template <typename Tag>
 struct EuclideanMagnitude : Magnitude<Tag>, db::ComputeTag {
   using base = Magnitude<Tag>;
-  static constexpr Scalar<DataVector> (*function)(const db::item_type<Tag>&) =
-      magnitude;
+  using return_type = Scalar<DataVector>;
+  static constexpr void (*function)(const gsl::not_null<return_type*>,
+                                    const db::item_type<Tag>&) = magnitude;
   using argument_tags = tmpl::list<Tag>;
 };
 
@@ -79,8 +122,11 @@ struct EuclideanMagnitude : Magnitude<Tag>, db::ComputeTag {
 template <typename Tag, typename MetricTag>
 struct NonEuclideanMagnitude : Magnitude<Tag>, db::ComputeTag {
   using base = Magnitude<Tag>;
-  static constexpr Scalar<DataVector> (*function)(
-      const db::item_type<Tag>&, const db::item_type<MetricTag>&) = magnitude;
+  using return_type = Scalar<DataVector>;
+  static constexpr void (*function)(const gsl::not_null<return_type*>,
+                                    const db::item_type<Tag>&,
+                                    const db::item_type<MetricTag>&) =
+      magnitude;
   using argument_tags = tmpl::list<Tag, MetricTag>;
 };
 
@@ -94,15 +140,16 @@ struct Normalized : db::ComputeTag {
   static std::string name() noexcept {
     return "Normalized(" + Tag::name() + ")";
   }
-  static constexpr auto function(
-      const db::item_type<Tag>&
-          vector_in,  // Compute items need to take const references
+  using return_type = db::item_type<Tag>;
+  static void function(
+      const gsl::not_null<return_type*> normalized_vector,
+      const db::item_type<Tag>& vector,
       const db::item_type<Magnitude<Tag>>& magnitude) noexcept {
-    auto vector = vector_in;
+    destructive_resize_components(normalized_vector,
+                                  get_size(get(magnitude)));
     for (size_t d = 0; d < vector.index_dim(0); ++d) {
-      vector.get(d) /= get(magnitude);
+      normalized_vector->get(d) = vector.get(d) / get(magnitude);
     }
-    return vector;
   }
   using argument_tags = tmpl::list<Tag, Magnitude<Tag>>;
 };
@@ -520,6 +520,31 @@ SPECTRE_ALWAYS_INLINE constexpr size_t index_dim(
   return Tensor<Ts...>::structure::template dim<I>();
 }
 
+/// \ingroup TensorGroup
+/// \brief Resize the components of `tensor` to `number_of_grid_points` if
+/// they have a different size, discarding their values.
+///
+/// \details Used by functions that compute into a `gsl::not_null<Tensor*>` to
+/// accept an empty tensor, while reusing the memory of a tensor of the right
+/// size. Tensors of `double`s are left unchanged.
+template <typename X, typename Symm, typename IndexList>
+void destructive_resize_components(
+    const gsl::not_null<Tensor<X, Symm, IndexList>*> tensor,
+    const size_t number_of_grid_points) noexcept {
+  if (UNLIKELY(tensor->begin()->size() != number_of_grid_points)) {
+    for (auto& component : *tensor) {
+      component = X(number_of_grid_points);
+    }
+  }
+}
+
+/// \cond
+template <typename Symm, typename IndexList>
+void destructive_resize_components(
+    const gsl::not_null<Tensor<double, Symm, IndexList>*> /*tensor*/,
+    const size_t /*number_of_grid_points*/) noexcept {}
+/// \endcond
+
 // We place the stream operators in the header file so they do not need to be
 // explicitly instantiated.
 template <typename X, typename Symm, template <typename...> class IndexList,
@@ -168,35 +168,51 @@ std::vector<size_t> oriented_offset(
 /// \ingroup DataStructuresGroup
 /// Orients variables on a slice to the data-storage order of a neighbor with
 /// the given orientation.
+///
+/// \details The overload taking a `gsl::not_null` writes the oriented data
+/// into `result`, which is only reallocated if it does not have the number of
+/// grid points of the slice.  The reorientation is a single permuted copy of
+/// all independent components.
+//@{
 template <size_t VolumeDim, typename TagsList>
-Variables<TagsList> orient_variables_on_slice(
+void orient_variables_on_slice(
+    const gsl::not_null<Variables<TagsList>*> result,
     const Variables<TagsList>& variables_on_slice,
     const Index<VolumeDim - 1>& slice_extents, const size_t sliced_dim,
     const OrientationMap<VolumeDim>& orientation_of_neighbor) noexcept {
   const size_t number_of_grid_points = slice_extents.product();
-
-  Variables<TagsList> oriented_variables(number_of_grid_points);
+  ASSERT(variables_on_slice.number_of_grid_points() == number_of_grid_points,
+         "Mismatch between slice extents (" << number_of_grid_points
+         << ") and variables (" << variables_on_slice.number_of_grid_points()
+         << ").");
+  if (result->number_of_grid_points() != number_of_grid_points) {
+    result->initialize(number_of_grid_points);
+  }
   const auto oriented_offset = OrientVariablesOnSlice_detail::oriented_offset(
       slice_extents, sliced_dim, orientation_of_neighbor);
 
-  tmpl::for_each<TagsList>([&oriented_variables, &variables_on_slice,
-                            &oriented_offset,
-                            &number_of_grid_points](auto tag) {
-    using Tag = tmpl::type_from<decltype(tag)>;
-    auto& oriented_tensor = get<Tag>(oriented_variables);
-    const auto& tensor_on_slice = get<Tag>(variables_on_slice);
-    for (decltype(auto) oriented_and_slice_tensor_components :
-         boost::combine(oriented_tensor, tensor_on_slice)) {
-      DataVector& oriented_tensor_component =
-          boost::get<0>(oriented_and_slice_tensor_components);
-      const DataVector& tensor_component_on_slice =
-          boost::get<1>(oriented_and_slice_tensor_components);
-      for (size_t s = 0; s < number_of_grid_points; ++s) {
-        oriented_tensor_component[oriented_offset[s]] =
-            tensor_component_on_slice[s];
-      }
+  double* const oriented_data = result->data();
+  const double* const slice_data = variables_on_slice.data();
+  for (size_t i = 0; i < variables_on_slice.number_of_independent_components;
+       ++i) {
+    const size_t component_offset = i * number_of_grid_points;
+    for (size_t s = 0; s < number_of_grid_points; ++s) {
+      // clang-tidy: do not use pointer arithmetic
+      oriented_data[component_offset + oriented_offset[s]] =  // NOLINT
+          slice_data[component_offset + s];                   // NOLINT
     }
-  });
+  }
+}
 
+template <size_t VolumeDim, typename TagsList>
+Variables<TagsList> orient_variables_on_slice(
+    const Variables<TagsList>& variables_on_slice,
+    const Index<VolumeDim - 1>& slice_extents, const size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) noexcept {
+  Variables<TagsList> oriented_variables(slice_extents.product());
+  orient_variables_on_slice(make_not_null(&oriented_variables),
+                            variables_on_slice, slice_extents, sliced_dim,
+                            orientation_of_neighbor);
   return oriented_variables;
 }
+//@}
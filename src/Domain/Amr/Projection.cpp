@@ -0,0 +1,87 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/Amr/Projection.hpp"
+
+#include <algorithm>
+
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr {
+template <size_t Dim>
+Mesh<Dim> new_mesh(const Mesh<Dim>& mesh,
+                   const std::array<Flag, Dim>& flags) noexcept {
+  std::array<size_t, Dim> extents = mesh.extents().indices();
+  for (size_t d = 0; d < Dim; ++d) {
+    ASSERT(gsl::at(flags, d) != Flag::Undefined,
+           "Undefined flag in dimension " << d);
+    if (gsl::at(flags, d) == Flag::IncreaseResolution) {
+      ++gsl::at(extents, d);
+    } else if (gsl::at(flags, d) == Flag::DecreaseResolution) {
+      ASSERT(gsl::at(extents, d) > 1,
+             "Cannot decrease the resolution of " << mesh << " in dimension "
+                                                  << d);
+      --gsl::at(extents, d);
+    }
+  }
+  return {extents, mesh.basis(), mesh.quadrature()};
+}
+
+template <size_t Dim>
+std::array<Matrix, Dim> p_projection_matrices(
+    const Mesh<Dim>& old_mesh, const Mesh<Dim>& new_mesh) noexcept {
+  std::array<Matrix, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto old_mesh_1d = old_mesh.slice_through(d);
+    const auto new_mesh_1d = new_mesh.slice_through(d);
+    if (old_mesh_1d == new_mesh_1d) {
+      continue;
+    }
+    ASSERT(old_mesh_1d.basis(0) == new_mesh_1d.basis(0),
+           "Cannot project between different bases in dimension " << d);
+    const size_t old_extent = old_mesh_1d.extents(0);
+    const size_t new_extent = new_mesh_1d.extents(0);
+    const size_t number_of_modes = std::min(old_extent, new_extent);
+    // We multiply the first `number_of_modes` columns of the Vandermonde
+    // matrix of the new mesh with the first `number_of_modes` rows of the
+    // inverse Vandermonde matrix of the old mesh.
+    const Matrix& to_spectral =
+        Spectral::grid_points_to_spectral_matrix(old_mesh_1d);
+    const Matrix& to_grid_points =
+        Spectral::spectral_to_grid_points_matrix(new_mesh_1d);
+    Matrix& projection = gsl::at(result, d);
+    projection = Matrix(new_extent, old_extent, 0.0);
+    for (size_t i = 0; i < new_extent; ++i) {
+      for (size_t j = 0; j < old_extent; ++j) {
+        for (size_t k = 0; k < number_of_modes; ++k) {
+          projection(i, j) += to_grid_points(i, k) * to_spectral(k, j);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                    \
+  template Mesh<DIM(data)> new_mesh(                            \
+      const Mesh<DIM(data)>& mesh,                              \
+      const std::array<Flag, DIM(data)>& flags) noexcept;       \
+  template std::array<Matrix, DIM(data)> p_projection_matrices( \
+      const Mesh<DIM(data)>& old_mesh,                          \
+      const Mesh<DIM(data)>& new_mesh) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+/// \endcond
+}  // namespace amr
@@ -0,0 +1,46 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Functions for changing the Mesh of an Element during p-refinement.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "Domain/Amr/Flag.hpp"
+
+/// \cond
+class Matrix;
+template <size_t Dim>
+class Mesh;
+/// \endcond
+
+namespace amr {
+/// \ingroup ComputationalDomainGroup
+/// \brief The Mesh of an Element after applying the p-refinement `flags` to
+/// `mesh`.
+///
+/// \details The number of points is increased or decreased by one in each
+/// dimension flagged with amr::Flag::IncreaseResolution or
+/// amr::Flag::DecreaseResolution. The h-refinement flags amr::Flag::Split and
+/// amr::Flag::Join do not change the Mesh.
+template <size_t Dim>
+Mesh<Dim> new_mesh(const Mesh<Dim>& mesh,
+                   const std::array<Flag, Dim>& flags) noexcept;
+
+/// \ingroup ComputationalDomainGroup
+/// \brief The matrices that project data on `old_mesh` to `new_mesh` of the
+/// same Element, for use with `apply_matrices`.
+///
+/// \details In each dimension the spectral coefficients of the data are
+/// truncated to the number of points of `new_mesh`, or padded with zeros, so
+/// that increasing the resolution is exact and decreasing the resolution is
+/// the \f$L_2\f$ projection for a Legendre basis. The matrix is empty for
+/// dimensions in which the meshes agree, which `apply_matrices` treats as the
+/// identity.
+template <size_t Dim>
+std::array<Matrix, Dim> p_projection_matrices(
+    const Mesh<Dim>& old_mesh, const Mesh<Dim>& new_mesh) noexcept;
+}  // namespace amr
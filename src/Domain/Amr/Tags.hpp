@@ -0,0 +1,83 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines tags related to adaptive mesh refinement.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/TruncationError.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/Mesh.hpp"
+#include "Domain/Tags.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace OptionTags {
+/// \ingroup OptionTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The criterion used to decide how the Elements are refined
+struct AmrCriterion {
+  using type = amr::TruncationErrorCriterion;
+  static constexpr OptionString help = {
+      "The criterion for adapting the resolution of the elements"};
+};
+}  // namespace OptionTags
+
+namespace amr {
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The amr::Flag%s of the Element in each dimension. They are
+/// amr::Flag::Undefined unless a decision is being made.
+template <size_t VolumeDim>
+struct Flags : db::SimpleTag {
+  static std::string name() noexcept { return "Flags"; }
+  using type = std::array<amr::Flag, VolumeDim>;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The latest amr::Flag%s received from each neighbor of the Element
+template <size_t VolumeDim>
+struct NeighborFlags : db::SimpleTag {
+  static std::string name() noexcept { return "NeighborFlags"; }
+  using type = std::unordered_map<ElementId<VolumeDim>,
+                                  std::array<amr::Flag, VolumeDim>>;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The Mesh each neighbor of the Element will have after applying its latest
+/// amr::Flag%s, in the neighbor's logical frame
+template <size_t VolumeDim>
+struct NeighborMeshes : db::SimpleTag {
+  static std::string name() noexcept { return "NeighborMeshes"; }
+  using type = std::unordered_map<ElementId<VolumeDim>, ::Mesh<VolumeDim>>;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The largest amr::relative_truncation_error of the tensors in
+/// `VariablesTag` in each dimension, i.e. the relative size of the highest
+/// spectral modes. It is a cheap measure of how well the variables are
+/// resolved that can be used for monitoring and for refinement decisions.
+template <size_t VolumeDim, typename VariablesTag>
+struct RelativeTruncationError : db::ComputeTag {
+  static std::string name() noexcept { return "RelativeTruncationError"; }
+  static std::array<double, VolumeDim> function(
+      const ::Mesh<VolumeDim>& mesh,
+      const db::item_type<VariablesTag>& vars) noexcept {
+    return relative_truncation_error(vars, mesh);
+  }
+  using argument_tags = tmpl::list<::Tags::Mesh<VolumeDim>, VariablesTag>;
+};
+}  // namespace Tags
+}  // namespace amr
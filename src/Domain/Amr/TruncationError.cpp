@@ -0,0 +1,143 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/Amr/TruncationError.hpp"
+
+#include <cmath>
+#include <functional>
+#include <pup.h>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/IndexIterator.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace amr {
+template <size_t Dim>
+std::array<double, Dim> relative_truncation_error(
+    const DataVector& u, const Mesh<Dim>& mesh) noexcept {
+  ASSERT(u.size() == mesh.number_of_grid_points(),
+         "Mismatch between mesh (" << mesh.number_of_grid_points()
+                                   << " points) and data (" << u.size()
+                                   << " points).");
+  auto matrices = make_array<Dim>(std::cref(
+      Spectral::grid_points_to_spectral_matrix(mesh.slice_through(0))));
+  for (size_t d = 1; d < Dim; ++d) {
+    gsl::at(matrices, d) = std::cref(
+        Spectral::grid_points_to_spectral_matrix(mesh.slice_through(d)));
+  }
+  const DataVector modes = apply_matrices(matrices, u, mesh.extents());
+
+  // The largest coefficient for each mode number in each dimension
+  std::array<DataVector, Dim> max_modes{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(max_modes, d) = DataVector(mesh.extents(d), 0.0);
+  }
+  for (IndexIterator<Dim> index(mesh.extents()); index; ++index) {
+    const double magnitude = std::abs(modes[index.collapsed_index()]);
+    for (size_t d = 0; d < Dim; ++d) {
+      double& max_mode = gsl::at(max_modes, d)[index()[d]];
+      max_mode = std::max(max_mode, magnitude);
+    }
+  }
+
+  std::array<double, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const DataVector& max_mode = gsl::at(max_modes, d);
+    const size_t number_of_modes = max_mode.size();
+    const double largest_mode =
+        *std::max_element(max_mode.begin(), max_mode.end());
+    if (largest_mode == 0.0) {
+      gsl::at(result, d) = 0.0;
+      continue;
+    }
+    double highest_modes = max_mode[number_of_modes - 1];
+    if (number_of_modes > 2) {
+      highest_modes = std::max(highest_modes, max_mode[number_of_modes - 2]);
+    }
+    gsl::at(result, d) = highest_modes / largest_mode;
+  }
+  return result;
+}
+
+TruncationErrorCriterion::TruncationErrorCriterion(
+    const double refinement_threshold, const double coarsening_threshold,
+    const size_t minimum_number_of_points,
+    const size_t maximum_number_of_points, const OptionContext& context)
+    : refinement_threshold_(refinement_threshold),
+      coarsening_threshold_(coarsening_threshold),
+      minimum_number_of_points_(minimum_number_of_points),
+      maximum_number_of_points_(maximum_number_of_points) {
+  if (coarsening_threshold_ >= refinement_threshold_) {
+    PARSE_ERROR(context,
+                "CoarseningThreshold must be smaller than RefinementThreshold");
+  }
+  if (minimum_number_of_points_ > maximum_number_of_points_) {
+    PARSE_ERROR(context,
+                "MinimumNumberOfPoints must not be larger than "
+                "MaximumNumberOfPoints");
+  }
+}
+
+template <size_t Dim>
+std::array<Flag, Dim> TruncationErrorCriterion::flags(
+    const std::array<double, Dim>& errors, const Mesh<Dim>& mesh) const
+    noexcept {
+  std::array<Flag, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const double error = gsl::at(errors, d);
+    const size_t extent = mesh.extents(d);
+    if (error > refinement_threshold_ and extent < maximum_number_of_points_) {
+      gsl::at(result, d) = Flag::IncreaseResolution;
+    } else if (error < coarsening_threshold_ and
+               extent > minimum_number_of_points_) {
+      gsl::at(result, d) = Flag::DecreaseResolution;
+    } else {
+      gsl::at(result, d) = Flag::DoNothing;
+    }
+  }
+  return result;
+}
+
+void TruncationErrorCriterion::pup(PUP::er& p) noexcept {
+  p | refinement_threshold_;
+  p | coarsening_threshold_;
+  p | minimum_number_of_points_;
+  p | maximum_number_of_points_;
+}
+
+bool operator==(const TruncationErrorCriterion& lhs,
+                const TruncationErrorCriterion& rhs) noexcept {
+  return lhs.refinement_threshold_ == rhs.refinement_threshold_ and
+         lhs.coarsening_threshold_ == rhs.coarsening_threshold_ and
+         lhs.minimum_number_of_points_ == rhs.minimum_number_of_points_ and
+         lhs.maximum_number_of_points_ == rhs.maximum_number_of_points_;
+}
+
+bool operator!=(const TruncationErrorCriterion& lhs,
+                const TruncationErrorCriterion& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                            \
+  template std::array<double, DIM(data)> relative_truncation_error(     \
+      const DataVector& u, const Mesh<DIM(data)>& mesh) noexcept;       \
+  template std::array<Flag, DIM(data)> TruncationErrorCriterion::flags( \
+      const std::array<double, DIM(data)>& errors,                      \
+      const Mesh<DIM(data)>& mesh) const noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+/// \endcond
+}  // namespace amr
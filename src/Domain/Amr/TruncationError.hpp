@@ -0,0 +1,155 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines a refinement criterion based on the spectral coefficients of the
+/// evolved variables.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "DataStructures/Variables.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+template <size_t Dim>
+class Mesh;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace amr {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief An estimate of the relative truncation error of `u` in each
+ * dimension of `mesh`.
+ *
+ * \details The nodal values `u` are transformed to the spectral coefficients
+ * \f$\widetilde{u}_{ijk}\f$. For each dimension \f$d\f$ the largest magnitude
+ * \f$a_m\f$ of the coefficients with index \f$m\f$ in dimension \f$d\f$ is
+ * found, and the truncation error is estimated as the largest \f$a_m\f$ of the
+ * two highest modes divided by the largest \f$a_m\f$ of all modes. Only the
+ * highest mode is used in a dimension with fewer than three points. The
+ * estimate is zero if all coefficients vanish.
+ */
+template <size_t Dim>
+std::array<double, Dim> relative_truncation_error(
+    const DataVector& u, const Mesh<Dim>& mesh) noexcept;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief The largest `relative_truncation_error` of all tensor components in
+ * `vars` in each dimension of `mesh`.
+ */
+template <size_t Dim, typename TagsList>
+std::array<double, Dim> relative_truncation_error(
+    const Variables<TagsList>& vars, const Mesh<Dim>& mesh) noexcept {
+  auto errors = make_array<Dim>(0.0);
+  tmpl::for_each<TagsList>([&errors, &vars, &mesh ](auto tag) noexcept {
+    using Tag = tmpl::type_from<decltype(tag)>;
+    for (const auto& component : get<Tag>(vars)) {
+      const auto component_errors = relative_truncation_error(component, mesh);
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(errors, d) =
+            std::max(gsl::at(errors, d), gsl::at(component_errors, d));
+      }
+    }
+  });
+  return errors;
+}
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Chooses p-refinement flags from the relative truncation error of the
+ * evolved variables.
+ *
+ * \details In each dimension the largest `relative_truncation_error` of all
+ * tensor components is compared with the thresholds: the resolution is
+ * increased if the error is larger than `RefinementThreshold` and decreased if
+ * the error is smaller than `CoarseningThreshold`, keeping the number of
+ * points between `MinimumNumberOfPoints` and `MaximumNumberOfPoints`.
+ *
+ * This criterion never requests h-refinement, i.e. it never returns
+ * amr::Flag::Split or amr::Flag::Join.
+ */
+class TruncationErrorCriterion {
+ public:
+  struct RefinementThreshold {
+    using type = double;
+    static constexpr OptionString help = {
+        "Increase the resolution if the relative error is above this value"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+  struct CoarseningThreshold {
+    using type = double;
+    static constexpr OptionString help = {
+        "Decrease the resolution if the relative error is below this value"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+  struct MinimumNumberOfPoints {
+    using type = size_t;
+    static constexpr OptionString help = {
+        "Never decrease the number of points per dimension below this value"};
+    static type lower_bound() noexcept { return 2; }
+  };
+  struct MaximumNumberOfPoints {
+    using type = size_t;
+    static constexpr OptionString help = {
+        "Never increase the number of points per dimension above this value"};
+    static type lower_bound() noexcept { return 2; }
+  };
+
+  using options = tmpl::list<RefinementThreshold, CoarseningThreshold,
+                             MinimumNumberOfPoints, MaximumNumberOfPoints>;
+  static constexpr OptionString help = {
+      "Adjust the number of grid points of each element according to the\n"
+      "relative size of the highest spectral coefficients of the evolved\n"
+      "variables."};
+
+  TruncationErrorCriterion(double refinement_threshold,
+                           double coarsening_threshold,
+                           size_t minimum_number_of_points,
+                           size_t maximum_number_of_points,
+                           const OptionContext& context = {});
+
+  TruncationErrorCriterion() = default;
+
+  /// The flags for the Element with `mesh` holding `vars`.
+  template <size_t Dim, typename TagsList>
+  std::array<Flag, Dim> operator()(const Variables<TagsList>& vars,
+                                   const Mesh<Dim>& mesh) const noexcept {
+    return flags(relative_truncation_error(vars, mesh), mesh);
+  }
+
+  /// The flags for the Element with `mesh` given the largest relative
+  /// truncation error of all components in each dimension.
+  template <size_t Dim>
+  std::array<Flag, Dim> flags(const std::array<double, Dim>& errors,
+                              const Mesh<Dim>& mesh) const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  friend bool operator==(const TruncationErrorCriterion& lhs,
+                         const TruncationErrorCriterion& rhs) noexcept;
+
+  double refinement_threshold_{std::numeric_limits<double>::signaling_NaN()};
+  double coarsening_threshold_{std::numeric_limits<double>::signaling_NaN()};
+  size_t minimum_number_of_points_{0};
+  size_t maximum_number_of_points_{0};
+};
+
+bool operator!=(const TruncationErrorCriterion& lhs,
+                const TruncationErrorCriterion& rhs) noexcept;
+}  // namespace amr
@@ -3,16 +3,21 @@
 
 #include "BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Block.hpp"
 #include "Domain/BlockId.hpp"
+#include "Domain/BlockSearchTree.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/Domain.hpp"  // IWYU pragma: keep
 #include "ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -28,24 +33,20 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
   const size_t num_pts = get<0>(x).size();
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
   std::vector<tnsr::I<double, Dim, Frame>> points_with_no_block;
+  std::vector<size_t> candidate_block_ids{};
   for (size_t s = 0; s < num_pts; ++s) {
     tnsr::I<double, Dim, Frame> x_frame(0.0);
     for (size_t d = 0; d < Dim; ++d) {
       x_frame.get(d) = x.get(d)[s];
     }
     auto& x_logical = block_coord_holders[s].data;
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    bool found_block = false;
-    for (const auto& block : domain.blocks()) {
+    const auto is_in_block = [&x_frame, &x_logical ](
+        const Block<Dim, Frame>& block) noexcept {
       const auto inv = block.coordinate_map().inverse(x_frame);
-      if(inv) {
-        x_logical = inv.get();
-      } else {
-        continue; // Not in this block
+      if (not inv) {
+        return false;
       }
+      x_logical = inv.get();
       bool is_contained = true;
       for (size_t d = 0; d < Dim; ++d) {
         // Assumes that logical coordinates go from -1 to +1 in each
@@ -53,7 +54,34 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
         is_contained = is_contained and x_logical.get(d) >= -1.0 and
                        x_logical.get(d) <= 1.0;
       }
-      if (is_contained) {
+      return is_contained;
+    };
+    // Check which block this point is in. Each point will be in one
+    // and only one block, unless it is on a shared boundary.  In that
+    // case, choose the first matching block.  We first try the blocks
+    // whose bounding box contains the point, which is usually only one,
+    // in order of increasing block_id.  The boxes are estimates, so if
+    // none of those contain the point we try the remaining blocks.  A
+    // point on a shared boundary therefore goes to the matching block
+    // with the smallest block_id only if that block's box contains it.
+    domain.block_search_tree().candidate_blocks(
+        make_not_null(&candidate_block_ids), x_frame);
+    const auto found_candidate = std::find_if(
+        candidate_block_ids.begin(), candidate_block_ids.end(),
+        [&domain, &is_in_block](const size_t block_id) noexcept {
+          return is_in_block(domain.blocks()[block_id]);
+        });
+    if (found_candidate != candidate_block_ids.end()) {
+      block_coord_holders[s].id = domain::BlockId(*found_candidate);
+      continue;
+    }
+    bool found_block = false;
+    for (const auto& block : domain.blocks()) {
+      if (std::binary_search(candidate_block_ids.begin(),
+                             candidate_block_ids.end(), block.id())) {
+        continue;  // Already tried this block
+      }
+      if (is_in_block(block)) {
         // Point is in this block.  Don't bother checking subsequent
         // blocks.
         block_coord_holders[s].id = domain::BlockId(block.id());
@@ -30,8 +30,12 @@ class IdPair;
 /// block logical coords of that point and the `BlockId` of the `Block` that
 /// contains that point.
 /// If a point is on a shared boundary of two or more `Block`s, it is
-/// returned only once, and is considered to belong to the `Block`
-/// with the smaller `BlockId`.
+/// returned only once, and is considered to belong to one of these
+/// `Block`s.  This is usually the one with the smallest `BlockId`, but
+/// not if the bounding box of that `Block` in the `BlockSearchTree` of
+/// the `Domain` misses the point, so the block logical coordinates of
+/// such points may differ from those found by checking every `Block` in
+/// order.  The target-frame coordinates they map to agree up to roundoff.
 template <size_t Dim, typename Frame>
 std::vector<
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>
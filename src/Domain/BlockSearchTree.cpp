@@ -0,0 +1,180 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockSearchTree.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Frame {
+struct Logical;
+}  // namespace Frame
+
+template <size_t VolumeDim, typename TargetFrame>
+BlockSearchTree<VolumeDim, TargetFrame>::BlockSearchTree(
+    const std::vector<Block<VolumeDim, TargetFrame>>& blocks) noexcept {
+  if (blocks.empty()) {
+    return;
+  }
+
+  // Map a uniform grid of logical points to estimate the bounding boxes.
+  size_t number_of_samples = 1;
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    number_of_samples *= points_per_dimension;
+  }
+  tnsr::I<DataVector, VolumeDim, Frame::Logical> logical_samples(
+      number_of_samples);
+  for (size_t s = 0; s < number_of_samples; ++s) {
+    size_t index = s;
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      logical_samples.get(d)[s] =
+          -1.0 + 2.0 * static_cast<double>(index % points_per_dimension) /
+                     static_cast<double>(points_per_dimension - 1);
+      index /= points_per_dimension;
+    }
+  }
+
+  std::vector<std::pair<size_t, BoundingBox>> ids_and_boxes(blocks.size());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    const auto samples = blocks[i].coordinate_map()(logical_samples);
+    ids_and_boxes[i].first = blocks[i].id();
+    auto& box = ids_and_boxes[i].second;
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      const auto min_and_max =
+          std::minmax_element(samples.get(d).begin(), samples.get(d).end());
+      const double padding =
+          relative_padding * (*min_and_max.second - *min_and_max.first);
+      gsl::at(box.lower, d) = *min_and_max.first - padding;
+      gsl::at(box.upper, d) = *min_and_max.second + padding;
+    }
+  }
+
+  nodes_.reserve(2 * blocks.size());
+  block_ids_.reserve(blocks.size());
+  build(make_not_null(&ids_and_boxes), 0, ids_and_boxes.size());
+}
+
+template <size_t VolumeDim, typename TargetFrame>
+void BlockSearchTree<VolumeDim, TargetFrame>::candidate_blocks(
+    const gsl::not_null<std::vector<size_t>*> block_ids,
+    const tnsr::I<double, VolumeDim, TargetFrame>& x) const noexcept {
+  block_ids->clear();
+  if (nodes_.empty()) {
+    return;
+  }
+  find(block_ids, 0, x);
+  std::sort(block_ids->begin(), block_ids->end());
+}
+
+template <size_t VolumeDim, typename TargetFrame>
+void BlockSearchTree<VolumeDim, TargetFrame>::build(
+    const gsl::not_null<std::vector<std::pair<size_t, BoundingBox>>*>
+        ids_and_boxes,
+    const size_t begin, const size_t end) noexcept {
+  ASSERT(begin < end, "Cannot build a node without any blocks.");
+  const auto first =
+      ids_and_boxes->begin() + static_cast<std::ptrdiff_t>(begin);
+  const auto last = ids_and_boxes->begin() + static_cast<std::ptrdiff_t>(end);
+
+  // The node's box encloses the boxes of its blocks, and we split them along
+  // the dimension in which their centers are spread the most.
+  const size_t node_index = nodes_.size();
+  nodes_.emplace_back();
+  BoundingBox box{};
+  std::array<double, VolumeDim> lower_center{};
+  std::array<double, VolumeDim> upper_center{};
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    gsl::at(box.lower, d) = std::numeric_limits<double>::max();
+    gsl::at(box.upper, d) = std::numeric_limits<double>::lowest();
+    gsl::at(lower_center, d) = std::numeric_limits<double>::max();
+    gsl::at(upper_center, d) = std::numeric_limits<double>::lowest();
+  }
+  for (auto it = first; it != last; ++it) {
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      const double lower = gsl::at(it->second.lower, d);
+      const double upper = gsl::at(it->second.upper, d);
+      const double center = 0.5 * (lower + upper);
+      gsl::at(box.lower, d) = std::min(gsl::at(box.lower, d), lower);
+      gsl::at(box.upper, d) = std::max(gsl::at(box.upper, d), upper);
+      gsl::at(lower_center, d) = std::min(gsl::at(lower_center, d), center);
+      gsl::at(upper_center, d) = std::max(gsl::at(upper_center, d), center);
+    }
+  }
+  nodes_[node_index].box = box;
+
+  if (end - begin <= max_blocks_per_leaf) {
+    nodes_[node_index].begin = block_ids_.size();
+    for (auto it = first; it != last; ++it) {
+      block_ids_.push_back(it->first);
+    }
+    nodes_[node_index].end = block_ids_.size();
+    return;
+  }
+
+  size_t split_dim = 0;
+  for (size_t d = 1; d < VolumeDim; ++d) {
+    if (gsl::at(upper_center, d) - gsl::at(lower_center, d) >
+        gsl::at(upper_center, split_dim) - gsl::at(lower_center, split_dim)) {
+      split_dim = d;
+    }
+  }
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(
+      first, ids_and_boxes->begin() + static_cast<std::ptrdiff_t>(middle), last,
+      [split_dim](const std::pair<size_t, BoundingBox>& lhs,
+                  const std::pair<size_t, BoundingBox>& rhs) noexcept {
+        return gsl::at(lhs.second.lower, split_dim) +
+                   gsl::at(lhs.second.upper, split_dim) <
+               gsl::at(rhs.second.lower, split_dim) +
+                   gsl::at(rhs.second.upper, split_dim);
+      });
+  build(ids_and_boxes, begin, middle);
+  nodes_[node_index].right_child = nodes_.size();
+  build(ids_and_boxes, middle, end);
+}
+
+template <size_t VolumeDim, typename TargetFrame>
+void BlockSearchTree<VolumeDim, TargetFrame>::find(
+    const gsl::not_null<std::vector<size_t>*> block_ids, const size_t node,
+    const tnsr::I<double, VolumeDim, TargetFrame>& x) const noexcept {
+  const auto& current = nodes_[node];
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    if (x.get(d) < gsl::at(current.box.lower, d) or
+        x.get(d) > gsl::at(current.box.upper, d)) {
+      return;
+    }
+  }
+  if (current.right_child == 0) {
+    block_ids->insert(
+        block_ids->end(),
+        block_ids_.begin() + static_cast<std::ptrdiff_t>(current.begin),
+        block_ids_.begin() + static_cast<std::ptrdiff_t>(current.end));
+    return;
+  }
+  find(block_ids, node + 1, x);
+  find(block_ids, current.right_child, x);
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data) \
+  template class BlockSearchTree<DIM(data), FRAME(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (Frame::Distorted, Frame::Grid, Frame::Inertial))
+
+#undef DIM
+#undef FRAME
+#undef INSTANTIATE
+/// \endcond
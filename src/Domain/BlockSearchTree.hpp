@@ -0,0 +1,89 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class template BlockSearchTree.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+template <size_t VolumeDim, typename TargetFrame>
+class Block;
+/// \endcond
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief A bounding volume hierarchy over the Blocks of a Domain, used to find
+ * the Blocks that may contain a point.
+ *
+ * \details The bounding box of each Block in the `TargetFrame` is estimated
+ * by mapping a uniform grid of `points_per_dimension` logical points per
+ * dimension and padding the result by `relative_padding` of its width in each
+ * dimension, which accounts for the curvature of the Block's faces between
+ * the sampled points. The boxes are sorted into a binary tree by recursively
+ * splitting along the longest dimension of the box centers, with at most
+ * `max_blocks_per_leaf` Blocks in a leaf.
+ *
+ * `candidate_blocks` returns the ids of the Blocks whose box contains a point,
+ * which is usually a single Block, instead of requiring a
+ * `CoordinateMap::inverse` for every Block. Since the boxes are estimates,
+ * users that must not miss a Block, such as `block_logical_coordinates`, fall
+ * back to trying the remaining Blocks if none of the candidates contain the
+ * point.
+ */
+template <size_t VolumeDim, typename TargetFrame>
+class BlockSearchTree {
+ public:
+  static constexpr size_t points_per_dimension = 5;
+  static constexpr double relative_padding = 0.1;
+  static constexpr size_t max_blocks_per_leaf = 2;
+
+  BlockSearchTree() = default;
+  explicit BlockSearchTree(
+      const std::vector<Block<VolumeDim, TargetFrame>>& blocks) noexcept;
+
+  /// Set `block_ids` to the ids of the Blocks whose bounding box contains
+  /// `x`, in increasing order.
+  void candidate_blocks(
+      gsl::not_null<std::vector<size_t>*> block_ids,
+      const tnsr::I<double, VolumeDim, TargetFrame>& x) const noexcept;
+
+  /// The number of Blocks in the tree.
+  size_t number_of_blocks() const noexcept { return block_ids_.size(); }
+
+ private:
+  struct BoundingBox {
+    std::array<double, VolumeDim> lower{};
+    std::array<double, VolumeDim> upper{};
+  };
+
+  // The left child of a node immediately follows it in `nodes_`. A node with
+  // `right_child == 0` is a leaf, holding the blocks
+  // `block_ids_[begin, end)`.
+  struct Node {
+    BoundingBox box{};
+    size_t right_child{0};
+    size_t begin{0};
+    size_t end{0};
+  };
+
+  // Adds the node for the blocks `[begin, end)` of `ids_and_boxes` and its
+  // children, reordering them.
+  void build(gsl::not_null<std::vector<std::pair<size_t, BoundingBox>>*>
+                 ids_and_boxes,
+             size_t begin, size_t end) noexcept;
+
+  void find(gsl::not_null<std::vector<size_t>*> block_ids, size_t node,
+            const tnsr::I<double, VolumeDim, TargetFrame>& x) const noexcept;
+
+  std::vector<Node> nodes_{};
+  std::vector<size_t> block_ids_{};
+};
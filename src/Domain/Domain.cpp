@@ -23,7 +23,7 @@ struct Logical;
 template <size_t VolumeDim, typename TargetFrame>
 Domain<VolumeDim, TargetFrame>::Domain(
     std::vector<Block<VolumeDim, TargetFrame>> blocks) noexcept
-    : blocks_(std::move(blocks)) {}
+    : blocks_(std::move(blocks)), block_search_tree_(blocks_) {}
 
 template <size_t VolumeDim, typename TargetFrame>
 Domain<VolumeDim, TargetFrame>::Domain(
@@ -46,6 +46,7 @@ Domain<VolumeDim, TargetFrame>::Domain(
     blocks_.emplace_back(std::move(maps[i]), i,
                          std::move(neighbors_of_all_blocks[i]));
   }
+  block_search_tree_ = BlockSearchTree<VolumeDim, TargetFrame>(blocks_);
 }
 
 template <size_t VolumeDim, typename TargetFrame>
@@ -74,6 +75,9 @@ std::ostream& operator<<(std::ostream& os,
 template <size_t VolumeDim, typename TargetFrame>
 void Domain<VolumeDim, TargetFrame>::pup(PUP::er& p) noexcept {
   p | blocks_;
+  if (p.isUnpacking()) {
+    block_search_tree_ = BlockSearchTree<VolumeDim, TargetFrame>(blocks_);
+  }
 }
 
 /// \cond HIDDEN_SYMBOLS
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockSearchTree.hpp"
 #include "Domain/DomainHelpers.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 
@@ -31,6 +32,9 @@ class CoordinateMapBase;
  *  \ingroup ComputationalDomainGroup
  *  \brief A wrapper around a vector of Blocks that represent the computational
  * domain.
+ *
+ * \details The Domain also holds a BlockSearchTree over its Blocks, which is
+ * built when the Domain is constructed or deserialized.
  */
 template <size_t VolumeDim, typename TargetFrame>
 class Domain {
@@ -74,11 +78,18 @@ class Domain {
     return blocks_;
   }
 
+  /// Finds the Blocks that may contain a point in the `TargetFrame`.
+  const BlockSearchTree<VolumeDim, TargetFrame>& block_search_tree() const
+      noexcept {
+    return block_search_tree_;
+  }
+
   //clang-tidy: google-runtime-references
   void pup(PUP::er& p) noexcept;  // NOLINT
 
  private:
   std::vector<Block<VolumeDim, TargetFrame>> blocks_{};
+  BlockSearchTree<VolumeDim, TargetFrame> block_search_tree_{};
 };
 
 template <size_t VolumeDim, typename TargetFrame>
@@ -0,0 +1,217 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/ElementDistribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/CreateInitialElement.hpp"
+#include "Domain/Element.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/Neighbors.hpp"  // IWYU pragma: keep
+#include "Domain/SegmentId.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Options/Options.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Frame {
+struct Grid;      // IWYU pragma: keep
+struct Inertial;  // IWYU pragma: keep
+}  // namespace Frame
+
+namespace {
+// The position of each element along a Morton curve through its block. The
+// segment indices are first scaled to the finest refinement level in the
+// block, so that elements with different refinement levels are ordered
+// consistently.
+template <size_t VolumeDim>
+std::vector<size_t> morton_indices(
+    const std::vector<ElementId<VolumeDim>>& element_ids) noexcept {
+  std::unordered_map<size_t, std::array<size_t, VolumeDim>>
+      finest_levels_in_block{};
+  for (const auto& element_id : element_ids) {
+    auto& finest_levels = finest_levels_in_block[element_id.block_id()];
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      gsl::at(finest_levels, d) =
+          std::max(gsl::at(finest_levels, d),
+                   gsl::at(element_id.segment_ids(), d).refinement_level());
+    }
+  }
+
+  std::vector<size_t> result(element_ids.size(), 0);
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    const auto& element_id = element_ids[i];
+    const auto& finest_levels =
+        finest_levels_in_block.at(element_id.block_id());
+    const size_t number_of_bits =
+        *std::max_element(finest_levels.begin(), finest_levels.end());
+    ASSERT(number_of_bits * VolumeDim < 8 * sizeof(size_t),
+           "The refinement levels are too high to compute the Morton index of "
+               << element_id);
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      const auto& segment_id = gsl::at(element_id.segment_ids(), d);
+      const size_t index =
+          segment_id.index()
+          << (gsl::at(finest_levels, d) - segment_id.refinement_level());
+      for (size_t bit = 0; bit < number_of_bits; ++bit) {
+        result[i] |= ((index >> bit) & 1) << (bit * VolumeDim + d);
+      }
+    }
+  }
+  return result;
+}
+}  // namespace
+
+namespace domain {
+std::ostream& operator<<(std::ostream& os,
+                         const ElementPlacement& placement) noexcept {
+  switch (placement) {
+    case ElementPlacement::RoundRobin:
+      return os << "RoundRobin";
+    case ElementPlacement::SpaceFillingCurve:
+      return os << "SpaceFillingCurve";
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR("Need to add another case, don't understand value of 'placement'");
+      // LCOV_EXCL_STOP
+  }
+}
+
+template <size_t VolumeDim>
+std::vector<int> element_placement(
+    const std::vector<ElementId<VolumeDim>>& element_ids,
+    const std::vector<size_t>& element_weights, const size_t number_of_procs,
+    const ElementPlacement placement) noexcept {
+  ASSERT(number_of_procs > 0, "Need at least one processor.");
+  ASSERT(element_weights.size() == element_ids.size(),
+         "Need one weight per element, but got " << element_weights.size()
+                                                 << " weights for "
+                                                 << element_ids.size()
+                                                 << " elements.");
+  std::vector<int> procs(element_ids.size(), 0);
+  if (placement == ElementPlacement::RoundRobin) {
+    size_t which_proc = 0;
+    for (size_t i = 0; i < element_ids.size(); ++i) {
+      if (i > 0 and
+          element_ids[i].block_id() != element_ids[i - 1].block_id()) {
+        which_proc = 0;
+      }
+      procs[i] = static_cast<int>(which_proc);
+      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+    }
+    return procs;
+  }
+
+  const std::vector<size_t> curve_indices = morton_indices(element_ids);
+  std::vector<size_t> order(element_ids.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&element_ids, &curve_indices](const size_t lhs,
+                                           const size_t rhs) noexcept {
+              return std::make_pair(element_ids[lhs].block_id(),
+                                    curve_indices[lhs]) <
+                     std::make_pair(element_ids[rhs].block_id(),
+                                    curve_indices[rhs]);
+            });
+
+  // Each element goes to the chunk containing the midpoint of its weight, so
+  // the chunks are contiguous along the curve and have close to
+  // `total_weight / number_of_procs` each.
+  const double total_weight = static_cast<double>(std::accumulate(
+      element_weights.begin(), element_weights.end(), size_t{0}));
+  ASSERT(element_ids.empty() or total_weight > 0.0,
+         "The elements must have a positive total weight.");
+  double weight_before = 0.0;
+  for (const size_t i : order) {
+    const double weight = static_cast<double>(element_weights[i]);
+    const auto chunk = static_cast<size_t>(
+        std::floor((weight_before + 0.5 * weight) *
+                   static_cast<double>(number_of_procs) / total_weight));
+    procs[i] = static_cast<int>(std::min(chunk, number_of_procs - 1));
+    weight_before += weight;
+  }
+  return procs;
+}
+
+template <size_t VolumeDim, typename TargetFrame>
+size_t number_of_cut_faces(
+    const std::vector<Block<VolumeDim, TargetFrame>>& blocks,
+    const std::vector<ElementId<VolumeDim>>& element_ids,
+    const std::vector<int>& procs) noexcept {
+  ASSERT(procs.size() == element_ids.size(),
+         "Need one processor per element, but got "
+             << procs.size() << " processors for " << element_ids.size()
+             << " elements.");
+  std::unordered_map<ElementId<VolumeDim>, size_t> element_indices{};
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    element_indices.emplace(element_ids[i], i);
+  }
+  size_t result = 0;
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    const auto element = create_initial_element(
+        element_ids[i], blocks[element_ids[i].block_id()]);
+    for (const auto& direction_and_neighbors : element.neighbors()) {
+      for (const auto& neighbor_id : direction_and_neighbors.second.ids()) {
+        const auto neighbor = element_indices.find(neighbor_id);
+        // Count each pair of neighbors once
+        if (neighbor != element_indices.end() and neighbor->second > i and
+            procs[neighbor->second] != procs[i]) {
+          ++result;
+        }
+      }
+    }
+  }
+  return result;
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE_PLACEMENT(_, data)                            \
+  template std::vector<int> element_placement(                    \
+      const std::vector<ElementId<DIM(data)>>& element_ids,       \
+      const std::vector<size_t>& element_weights,                 \
+      size_t number_of_procs, ElementPlacement placement) noexcept;
+
+#define INSTANTIATE_CUT_FACES(_, data)                            \
+  template size_t number_of_cut_faces(                            \
+      const std::vector<Block<DIM(data), FRAME(data)>>& blocks,   \
+      const std::vector<ElementId<DIM(data)>>& element_ids,       \
+      const std::vector<int>& procs) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_PLACEMENT, (1, 2, 3))
+GENERATE_INSTANTIATIONS(INSTANTIATE_CUT_FACES, (1, 2, 3),
+                        (Frame::Grid, Frame::Inertial))
+
+#undef DIM
+#undef FRAME
+#undef INSTANTIATE_PLACEMENT
+#undef INSTANTIATE_CUT_FACES
+/// \endcond
+}  // namespace domain
+
+domain::ElementPlacement create_from_yaml<domain::ElementPlacement>::create(
+    const Option& options) {
+  const std::string type_read = options.parse_as<std::string>();
+  if ("RoundRobin" == type_read) {
+    return domain::ElementPlacement::RoundRobin;
+  } else if ("SpaceFillingCurve" == type_read) {
+    return domain::ElementPlacement::SpaceFillingCurve;
+  }
+  PARSE_ERROR(options.context(),
+              "Failed to convert \"" << type_read
+                                     << "\" to ElementPlacement. Must be one "
+                                        "of RoundRobin or SpaceFillingCurve.");
+}
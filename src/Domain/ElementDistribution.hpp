@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions for distributing the initial Elements over processors.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+/// \cond
+template <size_t VolumeDim, typename TargetFrame>
+class Block;
+template <size_t VolumeDim>
+class ElementId;
+template <typename T>
+struct create_from_yaml;
+class Option;
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief How the initial Elements are assigned to processors.
+ *
+ * - `RoundRobin`: the Elements of each Block are dealt out to the processors
+ *   in turn, starting again from the first processor for every Block.
+ * - `SpaceFillingCurve`: the Elements are ordered by Block and, within a
+ *   Block, along a Morton (Z-order) curve through their segment indices. The
+ *   ordered Elements are cut into contiguous chunks of roughly equal weight,
+ *   one per processor, so that most face neighbors are on the same processor.
+ */
+enum class ElementPlacement { RoundRobin, SpaceFillingCurve };
+
+std::ostream& operator<<(std::ostream& os,
+                         const ElementPlacement& placement) noexcept;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief The processor of each of the `element_ids` according to `placement`.
+ *
+ * `element_weights` is the cost of each Element, typically its number of grid
+ * points, and is used by `ElementPlacement::SpaceFillingCurve` to balance the
+ * chunks. The Elements of a Block must be contiguous in `element_ids`, as is
+ * the case for the result of `initial_element_ids`.
+ */
+template <size_t VolumeDim>
+std::vector<int> element_placement(
+    const std::vector<ElementId<VolumeDim>>& element_ids,
+    const std::vector<size_t>& element_weights, size_t number_of_procs,
+    ElementPlacement placement) noexcept;
+
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief The number of pairs of initial face neighbors among the
+ * `element_ids` that are placed on different processors by `procs`.
+ *
+ * Each such pair exchanges boundary data between processors every step, so
+ * this is a measure of the communication cost of a placement.
+ */
+template <size_t VolumeDim, typename TargetFrame>
+size_t number_of_cut_faces(
+    const std::vector<Block<VolumeDim, TargetFrame>>& blocks,
+    const std::vector<ElementId<VolumeDim>>& element_ids,
+    const std::vector<int>& procs) noexcept;
+}  // namespace domain
+
+template <>
+struct create_from_yaml<domain::ElementPlacement> {
+  static domain::ElementPlacement create(const Option& options);
+};
@@ -3,6 +3,7 @@
 
 #include "ElementLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <unordered_map>
@@ -14,10 +15,11 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/BlockId.hpp"    // IWYU pragma: keep
 #include "Domain/ElementId.hpp"  // IWYU pragma: keep
+#include "Domain/SegmentId.hpp"
 #include "Domain/Side.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/MakeArray.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -38,43 +40,121 @@ element_logical_coordinates(const std::vector<ElementId<Dim>>& element_ids,
       element_ids.size());
   std::vector<std::vector<size_t>> offsets(element_ids.size());
 
+  // Instead of checking every element for every point, we compute which
+  // segments contain the point from the refinement levels of the elements
+  // in its block and look up the elements with those segments.  Usually
+  // all elements in a block have the same refinement levels.
+  std::unordered_map<ElementId<Dim>, size_t> element_indices{};
+  std::unordered_map<size_t, std::vector<std::array<size_t, Dim>>>
+      refinement_levels_in_block{};
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    const auto& element_id = element_ids[index];
+    // If an element is repeated, the first one gets the points.
+    element_indices.emplace(element_id, index);
+    std::array<size_t, Dim> refinement_levels{};
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(refinement_levels, d) =
+          gsl::at(element_id.segment_ids(), d).refinement_level();
+    }
+    auto& levels_in_block = refinement_levels_in_block[element_id.block_id()];
+    if (std::find(levels_in_block.begin(), levels_in_block.end(),
+                  refinement_levels) == levels_in_block.end()) {
+      levels_in_block.push_back(refinement_levels);
+    }
+  }
+
+  // The segments in each dimension whose closed interval contains the point.
+  // A point on the boundary between segments is contained in both.
+  std::array<std::vector<SegmentId>, Dim> containing_segments{};
   // Loop over points
   for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
     const auto& block_id = block_coord_holders[offset].id;
     const auto& x_block_logical = block_coord_holders[offset].data;
-    // Need to loop over elements, because the block doesn't know
-    // things like the refinement_level of each element.
-    for (size_t index = 0; index < element_ids.size(); ++index) {
-      const auto& element_id = element_ids[index];
-      if (element_id.block_id() == block_id.get_index()) {
-        // This element is in this block; now check if the point is in
-        // this element.
-        bool is_contained = true;
-        auto x_elem = make_array<Dim>(0.0);
+    const auto levels_in_block =
+        refinement_levels_in_block.find(block_id.get_index());
+    if (levels_in_block == refinement_levels_in_block.end()) {
+      continue;
+    }
+    // The points go to the first matching element in `element_ids`, as if we
+    // were checking them in order.
+    size_t element_index = element_ids.size();
+    for (const auto& refinement_levels : levels_in_block->second) {
+      bool is_contained = true;
+      for (size_t d = 0; d < Dim; ++d) {
+        const size_t level = gsl::at(refinement_levels, d);
+        const size_t number_of_segments = two_to_the(level);
+        const double x_block_log = x_block_logical.get(d);
+        const double scaled_x =
+            0.5 * (x_block_log + 1.0) * static_cast<double>(number_of_segments);
+        const size_t nearest_segment =
+            scaled_x <= 0.0
+                ? 0
+                : std::min(static_cast<size_t>(scaled_x),
+                           number_of_segments - 1);
+        auto& segments = gsl::at(containing_segments, d);
+        segments.clear();
+        // Roundoff may put the point in the neighbors of the nearest segment.
+        const size_t first_segment =
+            nearest_segment == 0 ? 0 : nearest_segment - 1;
+        const size_t last_segment =
+            std::min(nearest_segment + 1, number_of_segments - 1);
+        for (size_t segment_index = first_segment;
+             segment_index <= last_segment; ++segment_index) {
+          const SegmentId segment(level, segment_index);
+          if (x_block_log >= segment.endpoint(Side::Lower) and
+              x_block_log <= segment.endpoint(Side::Upper)) {
+            segments.push_back(segment);
+          }
+        }
+        if (segments.empty()) {
+          is_contained = false;
+          break;
+        }
+      }
+      if (not is_contained) {
+        continue;
+      }
+      // Look up the elements with all combinations of the segments.
+      std::array<size_t, Dim> combination{};
+      while (true) {
+        std::array<SegmentId, Dim> segment_ids{};
         for (size_t d = 0; d < Dim; ++d) {
-          const double up =
-              gsl::at(element_id.segment_ids(), d).endpoint(Side::Upper);
-          const double lo =
-              gsl::at(element_id.segment_ids(), d).endpoint(Side::Lower);
-          const double x_block_log = x_block_logical.get(d);
-          if (x_block_log < lo or x_block_log > up) {
-            is_contained = false;
+          gsl::at(segment_ids, d) =
+              gsl::at(containing_segments, d)[gsl::at(combination, d)];
+        }
+        const auto element = element_indices.find(
+            ElementId<Dim>(block_id.get_index(), segment_ids));
+        if (element != element_indices.end()) {
+          element_index = std::min(element_index, element->second);
+        }
+        size_t d = 0;
+        for (; d < Dim; ++d) {
+          if (++gsl::at(combination, d) <
+              gsl::at(containing_segments, d).size()) {
             break;
           }
-          // Map to element coords
-          gsl::at(x_elem, d) = (2.0 * x_block_log - up - lo) / (up - lo);
+          gsl::at(combination, d) = 0;
         }
-        if (is_contained) {
-          for (size_t d = 0; d < Dim; ++d) {
-            gsl::at(x_element_logical[index], d).push_back(gsl::at(x_elem, d));
-          }
-          offsets[index].push_back(offset);
-          // Found a matching element, so we don't need to check other
-          // elements.
+        if (d == Dim) {
           break;
         }
       }
     }
+    if (element_index == element_ids.size()) {
+      continue;
+    }
+
+    // Map to element coords
+    const auto& element_id = element_ids[element_index];
+    for (size_t d = 0; d < Dim; ++d) {
+      const double up =
+          gsl::at(element_id.segment_ids(), d).endpoint(Side::Upper);
+      const double lo =
+          gsl::at(element_id.segment_ids(), d).endpoint(Side::Lower);
+      gsl::at(x_element_logical[element_index], d)
+          .push_back((2.0 * x_block_logical.get(d) - up - lo) / (up - lo));
+    }
+    offsets[element_index].push_back(offset);
   }
 
   // Now we know how many points are in each element, so we can
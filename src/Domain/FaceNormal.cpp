@@ -11,10 +11,12 @@
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/Mesh.hpp"                          // IWYU pragma: keep
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 template <typename TargetFrame, size_t VolumeDim, typename Map>
-tnsr::i<DataVector, VolumeDim, TargetFrame> unnormalized_face_normal_impl(
+void unnormalized_face_normal_impl(
+    const gsl::not_null<tnsr::i<DataVector, VolumeDim, TargetFrame>*> result,
     const Mesh<VolumeDim - 1>& interface_mesh, const Map& map,
     const Direction<VolumeDim>& direction) noexcept {
   auto interface_coords =
@@ -25,24 +27,41 @@ tnsr::i<DataVector, VolumeDim, TargetFrame> unnormalized_face_normal_impl(
   const auto sliced_away_dim = direction.dimension();
   const double sign = direction.sign();
 
-  tnsr::i<DataVector, VolumeDim, TargetFrame> face_normal(
-      interface_mesh.number_of_grid_points());
-
+  destructive_resize_components(result,
+                                interface_mesh.number_of_grid_points());
   for (size_t d = 0; d < VolumeDim; ++d) {
-    face_normal.get(d) =
-        sign * inv_jacobian_on_interface.get(sliced_away_dim, d);
+    result->get(d) = sign * inv_jacobian_on_interface.get(sliced_away_dim, d);
   }
-  return face_normal;
 }
 }  // namespace
 
+template <size_t VolumeDim, typename TargetFrame>
+void unnormalized_face_normal(
+    const gsl::not_null<tnsr::i<DataVector, VolumeDim, TargetFrame>*> result,
+    const Mesh<VolumeDim - 1>& interface_mesh,
+    const ElementMap<VolumeDim, TargetFrame>& map,
+    const Direction<VolumeDim>& direction) noexcept {
+  unnormalized_face_normal_impl(result, interface_mesh, map, direction);
+}
+
 template <size_t VolumeDim, typename TargetFrame>
 tnsr::i<DataVector, VolumeDim, TargetFrame> unnormalized_face_normal(
     const Mesh<VolumeDim - 1>& interface_mesh,
     const ElementMap<VolumeDim, TargetFrame>& map,
     const Direction<VolumeDim>& direction) noexcept {
-  return unnormalized_face_normal_impl<TargetFrame>(interface_mesh, map,
-                                                    direction);
+  tnsr::i<DataVector, VolumeDim, TargetFrame> face_normal{};
+  unnormalized_face_normal_impl(make_not_null(&face_normal), interface_mesh,
+                                map, direction);
+  return face_normal;
+}
+
+template <size_t VolumeDim, typename TargetFrame>
+void unnormalized_face_normal(
+    const gsl::not_null<tnsr::i<DataVector, VolumeDim, TargetFrame>*> result,
+    const Mesh<VolumeDim - 1>& interface_mesh,
+    const CoordinateMapBase<Frame::Logical, TargetFrame, VolumeDim>& map,
+    const Direction<VolumeDim>& direction) noexcept {
+  unnormalized_face_normal_impl(result, interface_mesh, map, direction);
 }
 
 template <size_t VolumeDim, typename TargetFrame>
@@ -50,14 +69,29 @@ tnsr::i<DataVector, VolumeDim, TargetFrame> unnormalized_face_normal(
     const Mesh<VolumeDim - 1>& interface_mesh,
     const CoordinateMapBase<Frame::Logical, TargetFrame, VolumeDim>& map,
     const Direction<VolumeDim>& direction) noexcept {
-  return unnormalized_face_normal_impl<TargetFrame>(interface_mesh, map,
-                                                    direction);
+  tnsr::i<DataVector, VolumeDim, TargetFrame> face_normal{};
+  unnormalized_face_normal_impl(make_not_null(&face_normal), interface_mesh,
+                                map, direction);
+  return face_normal;
 }
 
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define GET_FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
 
 #define INSTANTIATION(_, data)                                                \
+  template void unnormalized_face_normal(                                     \
+      const gsl::not_null<tnsr::i<DataVector, GET_DIM(data), GET_FRAME(data)>* \
+                              result,                                         \
+      const Mesh<GET_DIM(data) - 1>&,                                         \
+      const ElementMap<GET_DIM(data), GET_FRAME(data)>&,                      \
+      const Direction<GET_DIM(data)>&) noexcept;                              \
+  template void unnormalized_face_normal(                                     \
+      const gsl::not_null<tnsr::i<DataVector, GET_DIM(data), GET_FRAME(data)>* \
+                              result,                                         \
+      const Mesh<GET_DIM(data) - 1>&,                                         \
+      const CoordinateMapBase<Frame::Logical, GET_FRAME(data),                \
+                              GET_DIM(data)>&,                                \
+      const Direction<GET_DIM(data)>&) noexcept;                              \
   template tnsr::i<DataVector, GET_DIM(data), GET_FRAME(data)>                \
   unnormalized_face_normal(const Mesh<GET_DIM(data) - 1>&,                    \
                            const ElementMap<GET_DIM(data), GET_FRAME(data)>&, \
@@ -6,13 +6,14 @@
 
 #pragma once
 
-#include <algorithm>
 #include <cstddef>
 #include <string>
+#include <unordered_map>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Tags.hpp"  // IWYU pragma: keep
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -43,11 +44,25 @@ class Mesh;
  * \snippet Test_FaceNormal.cpp face_normal_example
  */
 template <size_t VolumeDim, typename TargetFrame>
+void unnormalized_face_normal(
+    gsl::not_null<tnsr::i<DataVector, VolumeDim, TargetFrame>*> result,
+    const Mesh<VolumeDim - 1>& interface_mesh,
+    const ElementMap<VolumeDim, TargetFrame>& map,
+    const Direction<VolumeDim>& direction) noexcept;
+
+template <size_t VolumeDim, typename TargetFrame>
 tnsr::i<DataVector, VolumeDim, TargetFrame> unnormalized_face_normal(
     const Mesh<VolumeDim - 1>& interface_mesh,
     const ElementMap<VolumeDim, TargetFrame>& map,
     const Direction<VolumeDim>& direction) noexcept;
 
+template <size_t VolumeDim, typename TargetFrame>
+void unnormalized_face_normal(
+    gsl::not_null<tnsr::i<DataVector, VolumeDim, TargetFrame>*> result,
+    const Mesh<VolumeDim - 1>& interface_mesh,
+    const CoordinateMapBase<Frame::Logical, TargetFrame, VolumeDim>& map,
+    const Direction<VolumeDim>& direction) noexcept;
+
 template <size_t VolumeDim, typename TargetFrame>
 tnsr::i<DataVector, VolumeDim, TargetFrame> unnormalized_face_normal(
     const Mesh<VolumeDim - 1>& interface_mesh,
@@ -62,9 +77,11 @@ namespace Tags {
 template <size_t VolumeDim, typename Frame = ::Frame::Inertial>
 struct UnnormalizedFaceNormal : db::ComputeTag {
   static std::string name() noexcept { return "UnnormalizedFaceNormal"; }
-  static constexpr tnsr::i<DataVector, VolumeDim, Frame> (*function)(
-      const ::Mesh<VolumeDim - 1>&, const ::ElementMap<VolumeDim, Frame>&,
-      const ::Direction<VolumeDim>&) = unnormalized_face_normal;
+  using return_type = tnsr::i<DataVector, VolumeDim, Frame>;
+  static constexpr void (*function)(
+      const gsl::not_null<return_type*>, const ::Mesh<VolumeDim - 1>&,
+      const ::ElementMap<VolumeDim, Frame>&, const ::Direction<VolumeDim>&) =
+      unnormalized_face_normal;
   using argument_tags =
       tmpl::list<Mesh<VolumeDim - 1>, ElementMap<VolumeDim, Frame>,
                  Direction<VolumeDim>>;
@@ -90,22 +107,23 @@ struct InterfaceComputeItem<Tags::BoundaryDirectionsExterior<VolumeDim>,
     return "BoundaryDirectionsExterior<UnnormalizedFaceNormal>";
   }
 
-  static auto function(
+  using return_type = std::unordered_map<::Direction<VolumeDim>,
+                                         tnsr::i<DataVector, VolumeDim, Frame>>;
+
+  static void function(
+      const gsl::not_null<return_type*> normals,
       const db::item_type<Tags::Interface<dirs, Mesh<VolumeDim - 1>>>& meshes,
       const db::item_type<Tags::ElementMap<VolumeDim, Frame>>& map) noexcept {
-    std::unordered_map<::Direction<VolumeDim>,
-                       tnsr::i<DataVector, VolumeDim, Frame>>
-        normals{};
+    Interface_detail::remove_stale_directions(normals, meshes);
     for (const auto& direction_and_mesh : meshes) {
       const auto& direction = direction_and_mesh.first;
       const auto& mesh = direction_and_mesh.second;
-      auto internal_face_normal =
-          unnormalized_face_normal(mesh, map, direction);
-      std::transform(internal_face_normal.begin(), internal_face_normal.end(),
-                     internal_face_normal.begin(), std::negate<>());
-      normals[direction] = std::move(internal_face_normal);
+      auto& normal = (*normals)[direction];
+      unnormalized_face_normal(make_not_null(&normal), mesh, map, direction);
+      for (auto& component : normal) {
+        component *= -1.0;
+      }
     }
-    return normals;
   }
 
   using argument_tags = tmpl::list<Tags::Interface<dirs, Mesh<VolumeDim - 1>>,
@@ -267,14 +267,31 @@ struct unmap_interface_args<false> {
   }
 };
 
+// Remove the entries of `map` for directions that are not in `directions`, so
+// that a map that is updated in place holds the same directions as a newly
+// computed one.
+template <typename Map, typename Directions>
+void remove_stale_directions(const gsl::not_null<Map*> map,
+                             const Directions& directions) noexcept {
+  for (auto it = map->begin(); it != map->end();) {
+    if (directions.count(it->first) == 0) {
+      it = map->erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 template <typename DirectionsTag, typename BaseComputeItem,
-          typename ArgumentTags>
+          typename ArgumentTags,
+          bool IsMutating =
+              db::DataBox_detail::has_return_type_member_v<BaseComputeItem>>
 struct evaluate_compute_item;
 
 template <typename DirectionsTag, typename BaseComputeItem,
           typename... ArgumentTags>
 struct evaluate_compute_item<DirectionsTag, BaseComputeItem,
-                             tmpl::list<ArgumentTags...>> {
+                             tmpl::list<ArgumentTags...>, false> {
   using volume_tags = typename volume_tags<BaseComputeItem>::type;
   static_assert(
       tmpl::size<tmpl::list_difference<
@@ -300,6 +317,51 @@ struct evaluate_compute_item<DirectionsTag, BaseComputeItem,
   }
 };
 
+// A mutating base compute item updates the value on each interface in place,
+// so the storage of the interface item is reused when it is recomputed.
+template <typename DirectionsTag, typename BaseComputeItem,
+          typename... ArgumentTags>
+struct evaluate_compute_item<DirectionsTag, BaseComputeItem,
+                             tmpl::list<ArgumentTags...>, true> {
+  using volume_tags = typename volume_tags<BaseComputeItem>::type;
+  static_assert(
+      tmpl::size<tmpl::list_difference<
+          volume_tags, typename BaseComputeItem::argument_tags>>::value == 0,
+      "volume_tags contains tags not in argument_tags");
+
+  using return_type =
+      std::unordered_map<typename db::item_type<DirectionsTag>::value_type,
+                         typename BaseComputeItem::return_type>;
+
+  static void apply(const gsl::not_null<return_type*> result,
+                    const db::item_type<DirectionsTag>& directions,
+                    const db::item_type<ArgumentTags>&... args) noexcept {
+    remove_stale_directions(result, directions);
+    for (const auto& direction : directions) {
+      BaseComputeItem::function(
+          make_not_null(&(*result)[direction]),
+          unmap_interface_args<tmpl::list_contains_v<
+              volume_tags, ArgumentTags>>::apply(direction, args)...);
+    }
+  }
+};
+
+// Forward the `return_type` of a mutating base compute item to the interface
+// compute item, which makes the interface compute item mutating as well.
+template <typename DirectionsTag, typename BaseComputeItem,
+          typename ArgumentTags, typename = cpp17::void_t<>>
+struct interface_return_type {};
+
+template <typename DirectionsTag, typename BaseComputeItem,
+          typename ArgumentTags>
+struct interface_return_type<
+    DirectionsTag, BaseComputeItem, ArgumentTags,
+    cpp17::void_t<typename BaseComputeItem::return_type>> {
+  using return_type =
+      typename evaluate_compute_item<DirectionsTag, BaseComputeItem,
+                                     ArgumentTags>::return_type;
+};
+
 template <typename DirectionsTag, typename Tag, typename = cpp17::void_t<>>
 struct GetBaseTagIfPresent {};
 
@@ -384,6 +446,10 @@ struct Interface : virtual db::SimpleTag,
 /// some of the compute item's inputs should be taken from the volume even when
 /// applied on a slice, it may indicate them using `volume_tags`.
 ///
+/// If `Tag` is a mutating compute item (see db::ComputeTag) then so is the
+/// interface compute item, and the value on each interface is updated in place
+/// when the item is recomputed.
+///
 /// If using the base tag mechanism for an interface tag is desired,
 /// then `Tag` can have a `base` type alias pointing to its base
 /// class.  (This requirement is due to the lack of a way to determine
@@ -395,7 +461,11 @@ template <typename DirectionsTag, typename Tag>
 struct InterfaceComputeItem
     : Interface<DirectionsTag, Tag>,
       db::ComputeTag,
-      virtual db::PrefixTag {
+      virtual db::PrefixTag,
+      Interface_detail::interface_return_type<
+          DirectionsTag, Tag,
+          Interface_detail::interface_compute_item_argument_tags<DirectionsTag,
+                                                                 Tag>> {
   // Defining name here prevents an ambiguous function call when using base
   // tags; Both Interface<Dirs, Tag> and Interface<Dirs, Tag::base> will have a
   // name function and so cannot be disambiguated.
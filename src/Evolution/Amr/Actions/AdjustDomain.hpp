@@ -0,0 +1,248 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Projection.hpp"
+#include "Domain/Amr/Tags.hpp"
+#include "Domain/Element.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/Mesh.hpp"
+#include "Domain/OrientationMap.hpp"
+#include "Domain/Tags.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Time/Tags.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/StdHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class ElementIndex;
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace amr {
+namespace Actions {
+namespace detail {
+// Volume data that is overwritten before it is used, so it only has to have
+// the right size.
+template <typename Tag, typename DbTagsList,
+          Requires<not tmpl::list_contains_v<DbTagsList, Tag>> = nullptr>
+void resize_volume_data(
+    const gsl::not_null<db::DataBox<DbTagsList>*> /*box*/,
+    const size_t /*number_of_grid_points*/) noexcept {}
+
+template <typename Tag, typename DbTagsList,
+          Requires<tmpl::list_contains_v<DbTagsList, Tag>> = nullptr>
+void resize_volume_data(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                        const size_t number_of_grid_points) noexcept {
+  db::mutate<Tag>(
+      box, [number_of_grid_points](
+               const gsl::not_null<db::item_type<Tag>*> data) noexcept {
+        *data = db::item_type<Tag>(number_of_grid_points);
+      });
+}
+
+// Data on the faces of the element that is overwritten before it is used, so
+// it only has to have the right size.
+template <typename Tag, size_t Dim, typename DbTagsList,
+          Requires<not tmpl::list_contains_v<DbTagsList, Tag>> = nullptr>
+void resize_face_data(const gsl::not_null<db::DataBox<DbTagsList>*> /*box*/,
+                      const Mesh<Dim>& /*mesh*/) noexcept {}
+
+template <typename Tag, size_t Dim, typename DbTagsList,
+          Requires<tmpl::list_contains_v<DbTagsList, Tag>> = nullptr>
+void resize_face_data(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                      const Mesh<Dim>& mesh) noexcept {
+  db::mutate<Tag>(
+      box, [&mesh](const gsl::not_null<db::item_type<Tag>*> data) noexcept {
+        for (auto& direction_and_data : *data) {
+          direction_and_data.second.initialize(
+              mesh.slice_away(direction_and_data.first.dimension())
+                  .number_of_grid_points(),
+              0.0);
+        }
+      });
+}
+}  // namespace detail
+
+/// \ingroup ActionsGroup
+/// \brief Applies the p-refinement amr::Flag%s of the element in the
+/// `AdjustDomain` phase.
+///
+/// The evolved variables and the time stepper history are projected to the
+/// new Mesh with `amr::p_projection_matrices`, and the data that is
+/// overwritten before it is used is resized. The Mesh of each mortar is
+/// recomputed from the new Mesh of the element and the new Mesh of the
+/// neighbor received by `amr::Actions::UpdateAmrDecision`. All AMR flags are
+/// reset for the next decision.
+///
+/// \note This action only does p-refinement. Splitting and joining elements
+/// (h-refinement) is out of scope: it would need the element array to create
+/// and destroy elements, and the neighbors and mortars of all affected
+/// elements to be rebuilt. The flags never request it, because
+/// `amr::TruncationErrorCriterion` only chooses p-refinement flags and
+/// `amr::update_amr_decision` only chooses amr::Flag::Split to follow a
+/// neighbor that splits. The history of the boundary data used by local time
+/// stepping cannot be projected, so global time stepping is required.
+///
+/// Uses:
+/// - DataBox:
+///   * Tags::Element<Dim>
+///   * amr::Tags::NeighborMeshes<Dim>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   * Tags::Mesh<Dim>
+///   * Metavariables::system::variables_tag
+///   * Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>
+///   * db::add_tag_prefix<Tags::dt, variables_tag>
+///   * fluxes and sources of conservative systems
+///   * normal dot fluxes and exterior boundary data on the faces
+///   * Tags::Mortars<Tags::Mesh<Dim - 1>, Dim>
+///   * amr::Tags::Flags<Dim>
+///   * amr::Tags::NeighborFlags<Dim>
+///   * amr::Tags::NeighborMeshes<Dim>
+struct AdjustDomain {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent,
+            Requires<tmpl::list_contains_v<DbTagsList, Tags::Flags<Dim>>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ElementIndex<Dim>& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    static_assert(not Metavariables::local_time_stepping,
+                  "AMR requires global time stepping.");
+    using system = typename Metavariables::system;
+    using variables_tag = typename system::variables_tag;
+    using dt_variables_tag = db::add_tag_prefix<::Tags::dt, variables_tag>;
+    using history_tag =
+        ::Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>;
+
+    const auto& flags = db::get<Tags::Flags<Dim>>(box);
+    ASSERT(alg::none_of(flags,
+                        [](const Flag flag) noexcept {
+                          return flag == Flag::Split or flag == Flag::Join;
+                        }),
+           "Only p-refinement flags are chosen, but the flags of "
+               << db::get<::Tags::Element<Dim>>(box).id() << " are "
+               << flags);
+    const Mesh<Dim> old_mesh = db::get<::Tags::Mesh<Dim>>(box);
+    const Mesh<Dim> mesh = new_mesh(old_mesh, flags);
+
+    if (mesh != old_mesh) {
+      const auto projection_matrices = p_projection_matrices(old_mesh, mesh);
+      const auto project = [&old_mesh, &projection_matrices ](
+          const auto& data) noexcept {
+        return apply_matrices(projection_matrices, data, old_mesh.extents());
+      };
+      db::mutate<::Tags::Mesh<Dim>, variables_tag, history_tag>(
+          make_not_null(&box),
+          [&mesh, &project ](
+              const gsl::not_null<Mesh<Dim>*> element_mesh,
+              const gsl::not_null<db::item_type<variables_tag>*> vars,
+              const gsl::not_null<db::item_type<history_tag>*>
+                  history) noexcept {
+            *element_mesh = mesh;
+            *vars = project(*vars);
+            db::item_type<history_tag> projected_history{};
+            for (auto it = history->begin(); it != history->end(); ++it) {
+              projected_history.insert(*it, project(it.value()),
+                                       project(it.derivative()));
+            }
+            *history = std::move(projected_history);
+          });
+
+      using flux_comm_types = dg::FluxCommunicationTypes<Metavariables>;
+      using normal_dot_fluxes_tag =
+          typename flux_comm_types::normal_dot_fluxes_tag;
+      const size_t number_of_grid_points = mesh.number_of_grid_points();
+      detail::resize_volume_data<dt_variables_tag>(make_not_null(&box),
+                                                   number_of_grid_points);
+      detail::resize_volume_data<
+          db::add_tag_prefix<::Tags::Flux, variables_tag, tmpl::size_t<Dim>,
+                             Frame::Inertial>>(make_not_null(&box),
+                                               number_of_grid_points);
+      detail::resize_volume_data<
+          db::add_tag_prefix<::Tags::Source, variables_tag>>(
+          make_not_null(&box), number_of_grid_points);
+      detail::resize_face_data<::Tags::Interface<
+          ::Tags::BoundaryDirectionsExterior<Dim>, variables_tag>>(
+          make_not_null(&box), mesh);
+      detail::resize_face_data<::Tags::Interface<
+          ::Tags::InternalDirections<Dim>, normal_dot_fluxes_tag>>(
+          make_not_null(&box), mesh);
+      detail::resize_face_data<::Tags::Interface<
+          ::Tags::BoundaryDirectionsInterior<Dim>, normal_dot_fluxes_tag>>(
+          make_not_null(&box), mesh);
+      detail::resize_face_data<::Tags::Interface<
+          ::Tags::BoundaryDirectionsExterior<Dim>, normal_dot_fluxes_tag>>(
+          make_not_null(&box), mesh);
+    }
+
+    // The mortars have to be updated even if only the neighbor changed its
+    // Mesh.
+    const auto& element = db::get<::Tags::Element<Dim>>(box);
+    db::mutate<::Tags::Mortars<::Tags::Mesh<Dim - 1>, Dim>, Tags::Flags<Dim>,
+               Tags::NeighborFlags<Dim>, Tags::NeighborMeshes<Dim>>(
+        make_not_null(&box),
+        [&element, &mesh ](
+            const gsl::not_null<db::item_type<
+                ::Tags::Mortars<::Tags::Mesh<Dim - 1>, Dim>>*>
+                mortar_meshes,
+            const gsl::not_null<db::item_type<Tags::Flags<Dim>>*> my_flags,
+            const gsl::not_null<db::item_type<Tags::NeighborFlags<Dim>>*>
+                neighbor_flags,
+            const gsl::not_null<db::item_type<Tags::NeighborMeshes<Dim>>*>
+                neighbor_meshes) noexcept {
+          for (auto& mortar_id_and_mesh : *mortar_meshes) {
+            const auto& direction = mortar_id_and_mesh.first.first;
+            const auto& neighbor_id = mortar_id_and_mesh.first.second;
+            const auto face_mesh = mesh.slice_away(direction.dimension());
+            if (neighbor_id == ElementId<Dim>::external_boundary_id()) {
+              mortar_id_and_mesh.second = face_mesh;
+              continue;
+            }
+            ASSERT(neighbor_meshes->count(neighbor_id) == 1,
+                   "Did not receive the new mesh of neighbor " << neighbor_id);
+            const auto& orientation =
+                element.neighbors().at(direction).orientation();
+            mortar_id_and_mesh.second = dg::mortar_mesh(
+                face_mesh, orientation(neighbor_meshes->at(neighbor_id))
+                               .slice_away(direction.dimension()));
+          }
+          *my_flags = make_array<Dim>(Flag::Undefined);
+          neighbor_flags->clear();
+          neighbor_meshes->clear();
+        });
+  }
+};
+}  // namespace Actions
+}  // namespace amr
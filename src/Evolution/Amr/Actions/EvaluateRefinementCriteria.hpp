@@ -0,0 +1,83 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Amr/Tags.hpp"
+#include "Domain/Amr/UpdateAmrDecision.hpp"
+#include "Domain/Tags.hpp"
+#include "Evolution/Amr/Actions/UpdateAmrDecision.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/RequestPhase.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class ElementIndex;
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace amr {
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \brief Chooses the amr::Flag%s of the element in the
+/// `EvaluateAmrCriteria` phase.
+///
+/// The flags are chosen by `OptionTags::AmrCriterion` from the evolved
+/// variables, updated with the flags already received from neighbors, and sent
+/// to all neighbors with `amr::Actions::UpdateAmrDecision`. The element then
+/// requests the `AdjustDomain` phase, which starts once all neighbors have
+/// agreed on their flags.
+///
+/// Uses:
+/// - ConstGlobalCache:
+///   * OptionTags::AmrCriterion
+/// - DataBox:
+///   * Tags::Element<Dim>
+///   * Tags::Mesh<Dim>
+///   * Metavariables::system::variables_tag
+///   * amr::Tags::NeighborFlags<Dim>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   * amr::Tags::Flags<Dim>
+struct EvaluateRefinementCriteria {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent,
+            Requires<tmpl::list_contains_v<DbTagsList, Tags::Flags<Dim>>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ElementIndex<Dim>& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    const auto& element = db::get<::Tags::Element<Dim>>(box);
+    const auto& mesh = db::get<::Tags::Mesh<Dim>>(box);
+    auto flags = Parallel::get<OptionTags::AmrCriterion>(cache)(
+        db::get<typename Metavariables::system::variables_tag>(box), mesh);
+    for (const auto& id_and_flags : db::get<Tags::NeighborFlags<Dim>>(box)) {
+      update_amr_decision(make_not_null(&flags), element, id_and_flags.first,
+                          id_and_flags.second);
+    }
+    db::mutate<Tags::Flags<Dim>>(
+        make_not_null(&box),
+        [&flags](const gsl::not_null<db::item_type<Tags::Flags<Dim>>*>
+                     my_flags) noexcept { *my_flags = flags; });
+    detail::send_flags_to_neighbors<ParallelComponent>(cache, element, mesh,
+                                                       flags);
+    Parallel::request_phase(cache, Metavariables::Phase::AdjustDomain);
+  }
+};
+}  // namespace Actions
+}  // namespace amr
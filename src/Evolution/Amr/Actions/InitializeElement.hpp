@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Domain.hpp"
+#include "Evolution/DiscontinuousGalerkin/InitializeElement.hpp"
+#include "Evolution/Initialization/Amr.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class ElementIndex;
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace amr {
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \brief Initializes an element that adapts its mesh.
+///
+/// Does what `dg::Actions::InitializeElement` does, and then adds the tags
+/// used in the `EvaluateAmrCriteria` and `AdjustDomain` phases with
+/// `Initialization::Amr`. Executables that do not adapt the mesh use
+/// `dg::Actions::InitializeElement` and do not carry these tags.
+template <size_t Dim>
+struct InitializeElement {
+  template <class Metavariables>
+  using return_tag_list = tmpl::append<
+      typename dg::Actions::InitializeElement<Dim>::template return_tag_list<
+          Metavariables>,
+      typename Initialization::Amr<Dim>::simple_tags,
+      typename Initialization::Amr<Dim>::compute_tags>;
+
+  template <typename... InboxTags, typename Metavariables, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(const db::DataBox<tmpl::list<>>& box,
+                    const tuples::TaggedTuple<InboxTags...>& inboxes,
+                    const Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ElementIndex<Dim>& array_index,
+                    const ActionList meta,
+                    const ParallelComponent* const component,
+                    std::vector<std::array<size_t, Dim>> initial_extents,
+                    Domain<Dim, Frame::Inertial> domain,
+                    const double initial_time, const double initial_dt,
+                    const double initial_slab_size) noexcept {
+    auto dg_box = std::get<0>(dg::Actions::InitializeElement<Dim>::apply(
+        box, inboxes, cache, array_index, meta, component,
+        std::move(initial_extents), std::move(domain), initial_time,
+        initial_dt, initial_slab_size));
+    return std::make_tuple(
+        Initialization::Amr<Dim>::initialize(std::move(dg_box)));
+  }
+};
+}  // namespace Actions
+}  // namespace amr
@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Projection.hpp"
+#include "Domain/Amr/Tags.hpp"
+#include "Domain/Amr/UpdateAmrDecision.hpp"
+#include "Domain/Element.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/Mesh.hpp"
+#include "Domain/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class ElementIndex;
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace amr {
+namespace Actions {
+struct UpdateAmrDecision;
+
+namespace detail {
+// Sends the `flags` of `element` and the Mesh it will have after applying
+// them to all neighbors of `element`.
+template <typename ParallelComponent, typename Metavariables, size_t Dim>
+void send_flags_to_neighbors(Parallel::ConstGlobalCache<Metavariables>& cache,
+                             const Element<Dim>& element,
+                             const Mesh<Dim>& mesh,
+                             const std::array<Flag, Dim>& flags) noexcept {
+  auto& receiver_proxy =
+      Parallel::get_parallel_component<ParallelComponent>(cache);
+  const Mesh<Dim> my_new_mesh = new_mesh(mesh, flags);
+  for (const auto& direction_neighbors : element.neighbors()) {
+    for (const auto& neighbor : direction_neighbors.second) {
+      Parallel::simple_action<UpdateAmrDecision>(
+          receiver_proxy[neighbor], element.id(), flags, my_new_mesh);
+    }
+  }
+}
+}  // namespace detail
+
+/// \ingroup ActionsGroup
+/// \brief Receives the amr::Flag%s of a neighbor and reconciles them with the
+/// flags of the element.
+///
+/// The flags and the Mesh the neighbor will have after applying them are
+/// stored. If the element has already chosen its own flags they are updated
+/// with `amr::update_amr_decision`, and if any of them change the new flags
+/// are sent to all neighbors. Otherwise the neighbor's flags are taken into
+/// account by `amr::Actions::EvaluateRefinementCriteria`.
+///
+/// Uses:
+/// - DataBox:
+///   * Tags::Element<Dim>
+///   * Tags::Mesh<Dim>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   * amr::Tags::Flags<Dim>
+///   * amr::Tags::NeighborFlags<Dim>
+///   * amr::Tags::NeighborMeshes<Dim>
+struct UpdateAmrDecision {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent,
+            Requires<tmpl::list_contains_v<DbTagsList, Tags::Flags<Dim>>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ElementIndex<Dim>& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const ElementId<Dim>& neighbor_id,
+                    const std::array<Flag, Dim>& neighbor_flags,
+                    const Mesh<Dim>& neighbor_new_mesh) noexcept {
+    const auto& element = db::get<::Tags::Element<Dim>>(box);
+    bool flags_changed = false;
+    db::mutate<Tags::Flags<Dim>, Tags::NeighborFlags<Dim>,
+               Tags::NeighborMeshes<Dim>>(
+        make_not_null(&box),
+        [&element, &flags_changed, &neighbor_id, &neighbor_flags,
+         &neighbor_new_mesh ](
+            const gsl::not_null<db::item_type<Tags::Flags<Dim>>*> flags,
+            const gsl::not_null<db::item_type<Tags::NeighborFlags<Dim>>*>
+                all_neighbor_flags,
+            const gsl::not_null<db::item_type<Tags::NeighborMeshes<Dim>>*>
+                neighbor_meshes) noexcept {
+          (*all_neighbor_flags)[neighbor_id] = neighbor_flags;
+          (*neighbor_meshes)[neighbor_id] = neighbor_new_mesh;
+          if (flags->front() != Flag::Undefined) {
+            flags_changed = update_amr_decision(flags, element, neighbor_id,
+                                                neighbor_flags);
+          }
+        });
+    if (flags_changed) {
+      detail::send_flags_to_neighbors<ParallelComponent>(
+          cache, element, db::get<::Tags::Mesh<Dim>>(box),
+          db::get<Tags::Flags<Dim>>(box));
+    }
+  }
+};
+}  // namespace Actions
+}  // namespace amr
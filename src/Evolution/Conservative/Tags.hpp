@@ -11,7 +11,7 @@
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Variables.hpp"  // IWYU pragma: keep
 #include "Domain/FaceNormal.hpp"
-#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -35,28 +35,32 @@ struct ComputeNormalDotFlux : db::add_tag_prefix<NormalDotFlux, Tag>,
   using flux_tag = db::add_tag_prefix<Flux, Tag, tmpl::size_t<VolumeDim>, Fr>;
   using normal_tag =
       Tags::Normalized<Tags::UnnormalizedFaceNormal<VolumeDim, Fr>>;
+  using tags_list = typename db::item_type<Tag>::tags_list;
 
  public:
-  static auto function(const db::item_type<flux_tag>& flux,
+  using return_type = ::Variables<db::wrap_tags_in<NormalDotFlux, tags_list>>;
+
+  static void function(const gsl::not_null<return_type*> result,
+                       const db::item_type<flux_tag>& flux,
                        const db::item_type<normal_tag>& normal) noexcept {
-    using tags_list = typename db::item_type<Tag>::tags_list;
-    auto result = make_with_value<
-        ::Variables<db::wrap_tags_in<NormalDotFlux, tags_list>>>(flux, 0.);
+    if (result->number_of_grid_points() != flux.number_of_grid_points()) {
+      result->initialize(flux.number_of_grid_points());
+    }
 
     tmpl::for_each<tags_list>([&result, &flux,
                                &normal ](auto local_tag) noexcept {
       using tensor_tag = tmpl::type_from<decltype(local_tag)>;
-      auto& result_tensor = get<NormalDotFlux<tensor_tag>>(result);
+      auto& result_tensor = get<NormalDotFlux<tensor_tag>>(*result);
       const auto& flux_tensor =
           get<Flux<tensor_tag, tmpl::size_t<VolumeDim>, Fr>>(flux);
       for (auto it = result_tensor.begin(); it != result_tensor.end(); ++it) {
         const auto result_indices = result_tensor.get_tensor_index(it);
-        for (size_t d = 0; d < VolumeDim; ++d) {
+        *it = normal.get(0) * flux_tensor.get(prepend(result_indices, 0));
+        for (size_t d = 1; d < VolumeDim; ++d) {
           *it += normal.get(d) * flux_tensor.get(prepend(result_indices, d));
         }
       }
     });
-    return result;
   }
   using argument_tags = tmpl::list<flux_tag, normal_tag>;
 };
@@ -5,22 +5,34 @@
 
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
 #include "AlgorithmArray.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/DomainCreators/DomainCreator.hpp"  // IWYU pragma: keep
-#include "Domain/ElementId.hpp"                     // IWYU pragma: keep
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/ElementId.hpp"  // IWYU pragma: keep
 #include "Domain/ElementIndex.hpp"
 #include "Domain/InitialElementIds.hpp"
 #include "ErrorHandling/Error.hpp"
+#include "Evolution/Amr/Actions/AdjustDomain.hpp"
+#include "Evolution/Amr/Actions/EvaluateRefinementCriteria.hpp"
+#include "Evolution/EventsAndTriggers/AdaptMesh.hpp"
+#include "Evolution/EventsAndTriggers/LoadBalancing.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Options.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Printf.hpp"
+#include "Parallel/TypeTraits.hpp"
 #include "Time/Tags.hpp"  // IWYU pragma: keep
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -39,10 +51,22 @@ template <class Metavariables, class InitializeAction, class ActionList>
 struct DgElementArray {
   static constexpr size_t volume_dim = Metavariables::system::volume_dim;
 
+  struct ElementPlacement {
+    using type = domain::ElementPlacement;
+    static constexpr OptionString help = {
+        "How to assign the initial elements to processors"};
+    static type default_value() noexcept {
+      return domain::ElementPlacement::RoundRobin;
+    }
+  };
+
   using chare_type = Parallel::Algorithms::Array;
   using metavariables = Metavariables;
   using action_list = ActionList;
   using array_index = ElementIndex<volume_dim>;
+  /// The elements are migrated in the `LoadBalancing` phase, if the
+  /// metavariables have one
+  using load_balancing = std::true_type;
 
   using const_global_cache_tag_list =
       Parallel::get_const_global_cache_tags<action_list>;
@@ -55,34 +79,83 @@ struct DgElementArray {
       OptionTags::InitialTimeStep,
       tmpl::conditional_t<tmpl::list_contains_v<const_global_cache_tag_list,
                                                 OptionTags::StepController>,
-                          OptionTags::InitialSlabSize, tmpl::list<>>>>;
+                          OptionTags::InitialSlabSize, tmpl::list<>>,
+      ElementPlacement>>;
 
   static void initialize(
       Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache,
       std::unique_ptr<DomainCreator<volume_dim, Frame::Inertial>>
           domain_creator,
-      double initial_time, double initial_dt) noexcept;
+      double initial_time, double initial_dt,
+      domain::ElementPlacement element_placement) noexcept;
 
   static void initialize(
       Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache,
       std::unique_ptr<DomainCreator<volume_dim, Frame::Inertial>>
           domain_creator,
-      double initial_time, double initial_dt,
-      double initial_slab_size) noexcept;
+      double initial_time, double initial_dt, double initial_slab_size,
+      domain::ElementPlacement element_placement) noexcept;
 
   static void execute_next_phase(
       const typename Metavariables::Phase next_phase,
       Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
     auto& local_cache = *(global_cache.ckLocalBranch());
     if (next_phase == Metavariables::Phase::Evolve) {
+      // Elements paused by a LoadBalancing or AdaptMesh event resume where
+      // they stopped
       Parallel::get_parallel_component<DgElementArray>(local_cache)
-          .perform_algorithm();
+          .perform_algorithm(true);
     } else {
       try_register_with_observers(next_phase, global_cache);
+      try_load_balance(next_phase, global_cache);
+      try_adapt_mesh(next_phase, global_cache);
     }
   }
 
  private:
+  template <typename PhaseType,
+            Requires<not Parallel::has_amr_phases_v<PhaseType>> = nullptr>
+  static void try_adapt_mesh(
+      const PhaseType /*next_phase*/,
+      Parallel::CProxy_ConstGlobalCache<
+          Metavariables>& /*global_cache*/) noexcept {}
+
+  template <typename PhaseType,
+            Requires<Parallel::has_amr_phases_v<PhaseType>> = nullptr>
+  static void try_adapt_mesh(
+      const PhaseType next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    if (next_phase == Metavariables::Phase::EvaluateAmrCriteria) {
+      Parallel::simple_action<amr::Actions::EvaluateRefinementCriteria>(
+          Parallel::get_parallel_component<DgElementArray>(local_cache));
+    } else if (next_phase == Metavariables::Phase::AdjustDomain) {
+      Parallel::simple_action<amr::Actions::AdjustDomain>(
+          Parallel::get_parallel_component<DgElementArray>(local_cache));
+    }
+  }
+
+  template <typename PhaseType,
+            Requires<not Parallel::has_load_balancing_phase_v<PhaseType>> =
+                nullptr>
+  static void try_load_balance(
+      const PhaseType /*next_phase*/,
+      Parallel::CProxy_ConstGlobalCache<
+          Metavariables>& /*global_cache*/) noexcept {}
+
+  template <typename PhaseType,
+            Requires<Parallel::has_load_balancing_phase_v<PhaseType>> =
+                nullptr>
+  static void try_load_balance(
+      const PhaseType next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    if (next_phase == Metavariables::Phase::LoadBalancing) {
+      auto& local_cache = *(global_cache.ckLocalBranch());
+      Parallel::get_parallel_component<DgElementArray>(local_cache)
+          .start_load_balancing();
+    }
+  }
+
   template <typename PhaseType,
             Requires<not observers::has_register_with_observer_v<PhaseType>> =
                 nullptr>
@@ -116,9 +189,10 @@ template <class Metavariables, class InitializeAction, class ActionList>
 void DgElementArray<Metavariables, InitializeAction, ActionList>::initialize(
     Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache,
     std::unique_ptr<DomainCreator<volume_dim, Frame::Inertial>> domain_creator,
-    const double initial_time, const double initial_dt) noexcept {
+    const double initial_time, const double initial_dt,
+    const domain::ElementPlacement element_placement) noexcept {
   initialize(global_cache, std::move(domain_creator), initial_time, initial_dt,
-             std::abs(initial_dt));
+             std::abs(initial_dt), element_placement);
 }
 
 template <class Metavariables, class InitializeAction, class ActionList>
@@ -127,7 +201,8 @@ void DgElementArray<Metavariables, InitializeAction, ActionList>::initialize(
     const std::unique_ptr<DomainCreator<volume_dim, Frame::Inertial>>
         domain_creator,
     const double initial_time, const double initial_dt,
-    const double initial_slab_size) noexcept {
+    const double initial_slab_size,
+    const domain::ElementPlacement element_placement) noexcept {
   auto& cache = *global_cache.ckLocalBranch();
   auto& dg_element_array =
       Parallel::get_parallel_component<DgElementArray>(cache);
@@ -138,19 +213,30 @@ void DgElementArray<Metavariables, InitializeAction, ActionList>::initialize(
   }
 
   auto domain = domain_creator->create_domain();
-  for (const auto& block : domain.blocks()) {
-    const auto initial_ref_levs =
-        domain_creator->initial_refinement_levels()[block.id()];
-    const std::vector<ElementId<volume_dim>> element_ids =
-        initial_element_ids(block.id(), initial_ref_levs);
-    int which_proc = 0;
-    const int number_of_procs = Parallel::number_of_procs();
-    for (size_t i = 0; i < element_ids.size(); ++i) {
-      dg_element_array(ElementIndex<volume_dim>(element_ids[i]))
-          .insert(global_cache, which_proc);
-      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
-    }
+  const auto initial_ref_levs = domain_creator->initial_refinement_levels();
+  const auto initial_extents = domain_creator->initial_extents();
+  const std::vector<ElementId<volume_dim>> element_ids =
+      initial_element_ids(initial_ref_levs);
+  std::vector<size_t> element_weights(element_ids.size());
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    const auto& extents = initial_extents[element_ids[i].block_id()];
+    element_weights[i] = std::accumulate(extents.begin(), extents.end(),
+                                         size_t{1}, std::multiplies<size_t>{});
+  }
+  const auto number_of_procs =
+      static_cast<size_t>(Parallel::number_of_procs());
+  const std::vector<int> procs = domain::element_placement(
+      element_ids, element_weights, number_of_procs, element_placement);
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    dg_element_array(ElementIndex<volume_dim>(element_ids[i]))
+        .insert(global_cache, procs[i]);
   }
+  Parallel::printf(
+      "Placed %zu elements on %zu processors using %s placement, with %zu "
+      "pairs of face neighbors on different processors.\n",
+      element_ids.size(), number_of_procs,
+      get_output(element_placement).c_str(),
+      domain::number_of_cut_faces(domain.blocks(), element_ids, procs));
   dg_element_array.doneInserting();
 
   Parallel::simple_action<InitializeAction>(
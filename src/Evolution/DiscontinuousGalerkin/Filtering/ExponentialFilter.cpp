@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/Filtering/ExponentialFilter.hpp"
+
+#include <pup.h>
+
+#include "Domain/Mesh.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Filters {
+namespace {
+template <Spectral::Quadrature QuadratureType, size_t MaxPoints>
+void compute_matrices(const gsl::not_null<std::array<Matrix, MaxPoints>*>
+                          matrices,
+                      const double alpha, const size_t half_power) noexcept {
+  for (size_t num_points = Spectral::minimum_number_of_points<
+           Spectral::Basis::Legendre, QuadratureType>;
+       num_points < MaxPoints; ++num_points) {
+    gsl::at(*matrices, num_points) =
+        Spectral::exponential_filter_matrix<Spectral::Basis::Legendre,
+                                            QuadratureType>(num_points, alpha,
+                                                            half_power);
+  }
+}
+}  // namespace
+
+Exponential::Exponential(const double alpha, const size_t half_power) noexcept
+    : alpha_(alpha), half_power_(half_power) {
+  compute_filter_matrices();
+}
+
+const Matrix& Exponential::filter_matrix(const Mesh<1>& mesh) const noexcept {
+  ASSERT(mesh.basis(0) == Spectral::Basis::Legendre,
+         "The exponential filter only supports the Legendre basis, not "
+             << mesh.basis(0));
+  const auto& matrix = gsl::at(
+      gsl::at(filter_matrices_, static_cast<size_t>(mesh.quadrature(0))),
+      mesh.extents(0));
+  ASSERT(matrix.rows() == mesh.extents(0),
+         "No filter matrix for " << mesh.extents(0) << " points with "
+                                 << mesh.quadrature(0) << " quadrature.");
+  return matrix;
+}
+
+void Exponential::compute_filter_matrices() noexcept {
+  compute_matrices<Spectral::Quadrature::Gauss>(
+      make_not_null(&gsl::at(
+          filter_matrices_,
+          static_cast<size_t>(Spectral::Quadrature::Gauss))),
+      alpha_, half_power_);
+  compute_matrices<Spectral::Quadrature::GaussLobatto>(
+      make_not_null(&gsl::at(
+          filter_matrices_,
+          static_cast<size_t>(Spectral::Quadrature::GaussLobatto))),
+      alpha_, half_power_);
+}
+
+void Exponential::pup(PUP::er& p) noexcept {
+  p | alpha_;
+  p | half_power_;
+  if (p.isUnpacking()) {
+    compute_filter_matrices();
+  }
+}
+
+bool operator==(const Exponential& lhs, const Exponential& rhs) noexcept {
+  return lhs.alpha_ == rhs.alpha_ and lhs.half_power_ == rhs.half_power_;
+}
+
+bool operator!=(const Exponential& lhs, const Exponential& rhs) noexcept {
+  return not(lhs == rhs);
+}
+}  // namespace Filters
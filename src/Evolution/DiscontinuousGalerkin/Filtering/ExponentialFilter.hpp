@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "DataStructures/Matrix.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <size_t Dim>
+class Mesh;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Filters {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief An exponential filter that damps the highest modes of the evolved
+ * variables.
+ *
+ * \details The mode \f$k\f$ of a function on \f$N\f$ collocation points is
+ * multiplied by \f$\exp\left(-\alpha\left(\frac{k}{N-1}\right)^{2s}\right)\f$,
+ * see `Spectral::exponential_filter_matrix`. The filter matrices for all
+ * supported numbers of grid points are computed once when the filter is
+ * created, so applying the filter only requires a lookup.
+ *
+ * \note Only the Legendre basis is supported.
+ */
+class Exponential {
+ public:
+  /// \brief The value of the exponent \f$\alpha\f$.
+  struct Alpha {
+    using type = double;
+    static constexpr OptionString help = {
+        "The exponent at which the highest mode is damped"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+
+  /// \brief Half of the power \f$2s\f$ of the mode number in the exponent.
+  struct HalfPower {
+    using type = size_t;
+    static constexpr OptionString help = {
+        "Half of the power of the mode number in the exponent"};
+    static type lower_bound() noexcept { return 1; }
+  };
+
+  using options = tmpl::list<Alpha, HalfPower>;
+  static constexpr OptionString help = {
+      "An exponential filter that damps the highest spectral modes."};
+
+  Exponential(double alpha, size_t half_power) noexcept;
+
+  Exponential() = default;
+  Exponential(const Exponential&) = default;
+  Exponential& operator=(const Exponential&) = default;
+  Exponential(Exponential&&) = default;
+  Exponential& operator=(Exponential&&) = default;
+  ~Exponential() = default;
+
+  /// The matrix that filters a function on the one-dimensional `mesh`
+  const Matrix& filter_matrix(const Mesh<1>& mesh) const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  friend bool operator==(const Exponential& lhs,
+                         const Exponential& rhs) noexcept;
+
+  void compute_filter_matrices() noexcept;
+
+  static constexpr size_t max_num_points =
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+
+  double alpha_{std::numeric_limits<double>::signaling_NaN()};
+  size_t half_power_{0};
+  // Indexed by the quadrature and the number of grid points
+  std::array<std::array<Matrix, max_num_points + 1>, 2> filter_matrices_{};
+};
+
+bool operator!=(const Exponential& lhs, const Exponential& rhs) noexcept;
+}  // namespace Filters
@@ -0,0 +1,106 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines the action Filter
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace Filters {
+namespace Actions {
+/// \cond
+template <typename FilterOptionTag, typename TagsToFilter>
+struct Filter;
+/// \endcond
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Applies the filter in `FilterOptionTag` to every component of the
+/// tensors in `TagsToFilter`.
+///
+/// The filter is applied in each logical dimension with `apply_matrices`,
+/// using the matrices returned by its `filter_matrix(const Mesh<1>&)` member
+/// function, e.g. `Filters::Exponential` or `Filters::Heaviside`. The action
+/// only uses data local to the element, so it can be placed anywhere in the
+/// action list, typically right after the time step is taken.
+///
+/// Uses:
+/// - ConstGlobalCache:
+///   - FilterOptionTag
+/// - DataBox:
+///   - Tags::Mesh<volume_dim>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - TagsToFilter
+template <typename FilterOptionTag, typename... TagsToFilter>
+struct Filter<FilterOptionTag, tmpl::list<TagsToFilter...>> {
+  using const_global_cache_tags = tmpl::list<FilterOptionTag>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    constexpr size_t volume_dim = Metavariables::system::volume_dim;
+    const auto& filter = Parallel::get<FilterOptionTag>(cache);
+    const auto& mesh = db::get<::Tags::Mesh<volume_dim>>(box);
+
+    const Matrix empty{};
+    auto filter_matrices = make_array<volume_dim>(std::cref(empty));
+    for (size_t d = 0; d < volume_dim; d++) {
+      gsl::at(filter_matrices, d) =
+          std::cref(filter.filter_matrix(mesh.slice_through(d)));
+    }
+
+    // All components are filtered through the same buffer to avoid an
+    // allocation for each of them.
+    DataVector filtered_component(mesh.number_of_grid_points());
+    const auto filter_tensor = [&filter_matrices, &filtered_component,
+                                &mesh ](const auto tensor) noexcept {
+      for (auto& component : *tensor) {
+        apply_matrices(make_not_null(&filtered_component), filter_matrices,
+                       component, mesh.extents());
+        component = filtered_component;
+      }
+      return nullptr;
+    };
+    db::mutate<TagsToFilter...>(
+        make_not_null(&box),
+        [&filter_tensor](const gsl::not_null<db::item_type<TagsToFilter>*>...
+                             tensors) noexcept {
+          expand_pack(filter_tensor(tensors)...);
+        });
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
+}  // namespace Filters
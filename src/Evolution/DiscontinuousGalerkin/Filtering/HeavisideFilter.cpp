@@ -0,0 +1,34 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/Filtering/HeavisideFilter.hpp"
+
+#include <algorithm>
+#include <pup.h>
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+namespace Filters {
+Heaviside::Heaviside(const size_t number_of_modes_to_remove) noexcept
+    : number_of_modes_to_remove_(number_of_modes_to_remove) {}
+
+const Matrix& Heaviside::filter_matrix(const Mesh<1>& mesh) const noexcept {
+  const size_t num_points = mesh.extents(0);
+  return Spectral::heaviside_filter_matrix(
+      mesh, num_points > number_of_modes_to_remove_
+                ? num_points - number_of_modes_to_remove_
+                : 1);
+}
+
+void Heaviside::pup(PUP::er& p) noexcept { p | number_of_modes_to_remove_; }
+
+bool operator==(const Heaviside& lhs, const Heaviside& rhs) noexcept {
+  return lhs.number_of_modes_to_remove_ == rhs.number_of_modes_to_remove_;
+}
+
+bool operator!=(const Heaviside& lhs, const Heaviside& rhs) noexcept {
+  return not(lhs == rhs);
+}
+}  // namespace Filters
@@ -0,0 +1,60 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class Matrix;
+template <size_t Dim>
+class Mesh;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Filters {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief A filter that removes the highest modes of the evolved variables.
+ *
+ * \details The highest `NumberOfModesToRemove` modes are set to zero, but the
+ * lowest mode is always kept. The filter matrices are cached by
+ * `Spectral::heaviside_filter_matrix`.
+ */
+class Heaviside {
+ public:
+  /// \brief The number of highest modes that are set to zero.
+  struct NumberOfModesToRemove {
+    using type = size_t;
+    static constexpr OptionString help = {
+        "The number of highest modes that are set to zero"};
+    static type lower_bound() noexcept { return 1; }
+  };
+
+  using options = tmpl::list<NumberOfModesToRemove>;
+  static constexpr OptionString help = {
+      "A filter that removes the highest spectral modes."};
+
+  explicit Heaviside(size_t number_of_modes_to_remove) noexcept;
+
+  Heaviside() = default;
+
+  /// The matrix that filters a function on the one-dimensional `mesh`
+  const Matrix& filter_matrix(const Mesh<1>& mesh) const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  friend bool operator==(const Heaviside& lhs, const Heaviside& rhs) noexcept;
+
+  size_t number_of_modes_to_remove_{0};
+};
+
+bool operator!=(const Heaviside& lhs, const Heaviside& rhs) noexcept;
+}  // namespace Filters
@@ -0,0 +1,19 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Options/Options.hpp"
+
+namespace OptionTags {
+/*!
+ * \ingroup OptionTagsGroup
+ * \brief The global cache tag that retrieves the parameters for the filter
+ * from the input file
+ */
+template <typename FilterType>
+struct FilterParams {
+  static constexpr OptionString help = "The options for the filter";
+  using type = FilterType;
+};
+}  // namespace OptionTags
@@ -31,6 +31,7 @@
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "Evolution/Conservative/Tags.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
@@ -44,6 +45,7 @@
 #include "Time/Time.hpp"
 #include "Time/TimeId.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -90,6 +92,7 @@ namespace Actions {
 ///   * Tags::deriv<System::gradients_tags>
 ///   * db::add_tag_prefix<Tags::dt, System::variables_tag>
 ///   * Tags::UnnormalizedFaceNormal<Dim>
+///   * Tags::FluxCommunicationTiming
 /// - Removes: nothing
 /// - Modifies: nothing
 template <size_t Dim>
@@ -465,10 +468,11 @@ struct InitializeElement {
           db::AddSimpleTags<mortar_data_tag,
                             Tags::Mortars<Tags::Next<temporal_id_tag>, Dim>,
                             Tags::Mortars<Tags::Mesh<Dim - 1>, Dim>,
-                            Tags::Mortars<Tags::MortarSize<Dim - 1>, Dim>>>(
+                            Tags::Mortars<Tags::MortarSize<Dim - 1>, Dim>,
+                            Tags::FluxCommunicationTiming>>(
           std::move(box), std::move(mortar_data),
           std::move(mortar_next_temporal_ids), std::move(mortar_meshes),
-          std::move(mortar_sizes));
+          std::move(mortar_sizes), dg::FluxCommunicationTiming{});
     }
 
     template <typename LocalSystem,
@@ -480,6 +484,7 @@ struct InitializeElement {
           Tags::Mortars<Tags::Next<temporal_id_tag>, Dim>,
           Tags::Mortars<Tags::Mesh<Dim - 1>, Dim>,
           Tags::Mortars<Tags::MortarSize<Dim - 1>, Dim>,
+          Tags::FluxCommunicationTiming,
           interface_tag<typename flux_comm_types::normal_dot_fluxes_tag>,
           interior_boundary_tag<
               typename flux_comm_types::normal_dot_fluxes_tag>,
@@ -547,7 +552,8 @@ struct InitializeElement {
           db::AddSimpleTags<mortar_data_tag,
                             Tags::Mortars<Tags::Next<temporal_id_tag>, Dim>,
                             Tags::Mortars<Tags::Mesh<Dim - 1>, Dim>,
-                            Tags::Mortars<Tags::MortarSize<Dim - 1>, Dim>>;
+                            Tags::Mortars<Tags::MortarSize<Dim - 1>, Dim>,
+                            Tags::FluxCommunicationTiming>;
 
       template <typename Tag>
       using interface_compute_tag =
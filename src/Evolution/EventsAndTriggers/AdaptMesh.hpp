@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/RequestPhase.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \ingroup EventsAndTriggersGroup
+ * \brief Pauses the evolution to adapt the resolution of the elements.
+ *
+ * The element stops executing its actions and requests the
+ * `EvaluateAmrCriteria` phase from `Parallel::Main`. In that phase every
+ * element chooses its amr::Flag%s using `OptionTags::AmrCriterion`,
+ * reconciles them with its neighbors and requests the `AdjustDomain` phase,
+ * see `amr::Actions::EvaluateRefinementCriteria`. In the `AdjustDomain` phase
+ * every element changes its Mesh accordingly, see
+ * `amr::Actions::AdjustDomain`. The evolution then continues where it was
+ * paused.
+ *
+ * The trigger should fire on all elements at the same time, e.g. using a
+ * trigger on the slab number.
+ *
+ * \note Only p-refinement is supported, and the variables can only be
+ * projected to the new Mesh with global time stepping.
+ */
+template <typename KnownEvents>
+class AdaptMesh : public Event<KnownEvents> {
+ public:
+  /// \cond
+  explicit AdaptMesh(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(AdaptMesh);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "Pause the evolution to adapt the number of grid points of the\n"
+      "elements according to the AmrCriterion."};
+
+  AdaptMesh() = default;
+
+  using argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(Parallel::ConstGlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const Component* const /*meta*/) const noexcept {
+    static_assert(Parallel::has_amr_phases_v<typename Metavariables::Phase>,
+                  "The AdaptMesh event requires EvaluateAmrCriteria and "
+                  "AdjustDomain phases in the Metavariables.");
+    static_assert(not Metavariables::local_time_stepping,
+                  "The AdaptMesh event requires global time stepping.");
+    Parallel::pause_for_phase<Component>(
+        cache, array_index, Metavariables::Phase::EvaluateAmrCriteria);
+  }
+};
+
+/// \cond
+template <typename KnownEvents>
+PUP::able::PUP_ID AdaptMesh<KnownEvents>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
@@ -0,0 +1,67 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/RequestPhase.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \ingroup EventsAndTriggersGroup
+ * \brief Pauses the evolution for the `LoadBalancing` phase.
+ *
+ * The element stops executing its actions and requests the `LoadBalancing`
+ * phase from `Parallel::Main`, which starts once all elements have stopped.
+ * Charm++ then migrates the elements according to the wall time each spent
+ * executing actions since the previous load balancing, and the evolution
+ * continues where it was paused.
+ *
+ * The trigger should fire on all elements at the same time, e.g. using a
+ * trigger on the slab number. Elements the trigger does not fire on continue
+ * until they have to wait for data from a paused element.
+ */
+template <typename KnownEvents>
+class LoadBalancing : public Event<KnownEvents> {
+ public:
+  /// \cond
+  explicit LoadBalancing(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(LoadBalancing);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "Pause the evolution to migrate the elements between processors\n"
+      "according to their measured load."};
+
+  LoadBalancing() = default;
+
+  using argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(Parallel::ConstGlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const Component* const /*meta*/) const noexcept {
+    static_assert(
+        Parallel::has_load_balancing_phase_v<typename Metavariables::Phase>,
+        "The LoadBalancing event requires a LoadBalancing phase in the "
+        "Metavariables.");
+    static_assert(Parallel::is_load_balanced_v<Component>,
+                  "The LoadBalancing event requires a component with "
+                  "'using load_balancing = std::true_type;'.");
+    Parallel::pause_for_phase<Component>(
+        cache, array_index, Metavariables::Phase::LoadBalancing);
+  }
+};
+
+/// \cond
+template <typename KnownEvents>
+PUP::able::PUP_ID LoadBalancing<KnownEvents>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
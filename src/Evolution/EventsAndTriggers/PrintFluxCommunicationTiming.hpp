@@ -0,0 +1,57 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \ingroup EventsAndTriggersGroup
+ * \brief Prints how much of the boundary data exchange of the element was
+ * overlapped with local work.
+ *
+ * The breakdown is accumulated since the start of the evolution by the flux
+ * communication actions, see `dg::FluxCommunicationTiming`.
+ */
+template <typename KnownEvents>
+class PrintFluxCommunicationTiming : public Event<KnownEvents> {
+ public:
+  /// \cond
+  explicit PrintFluxCommunicationTiming(
+      CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(PrintFluxCommunicationTiming);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "Print the time each element overlapped the boundary data exchange with\n"
+      "local work and the time it waited for data from its neighbors."};
+
+  PrintFluxCommunicationTiming() = default;
+
+  using argument_tags = tmpl::list<Tags::FluxCommunicationTiming>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(const dg::FluxCommunicationTiming& timing,
+                  Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                  const ArrayIndex& array_index,
+                  const Component* const /*meta*/) const noexcept {
+    Parallel::printf("Flux communication of %s: %s\n", array_index, timing);
+  }
+};
+
+/// \cond
+template <typename KnownEvents>
+PUP::able::PUP_ID PrintFluxCommunicationTiming<KnownEvents>::my_PUP_ID =
+    0;  // NOLINT
+/// \endcond
+}  // namespace Events
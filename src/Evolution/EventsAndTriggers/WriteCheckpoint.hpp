@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/RequestPhase.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \ingroup EventsAndTriggersGroup
+ * \brief Pauses the evolution for the `WriteCheckpoint` phase.
+ *
+ * The element stops executing its actions and requests the `WriteCheckpoint`
+ * phase from `Parallel::Main`. Once all elements have stopped, the observers
+ * write their buffered data and `Parallel::Main` writes a Charm++ checkpoint
+ * of all parallel components to the directory `Checkpoint_NNNN`. The
+ * evolution then continues where it was paused. Running the executable with
+ * `+restart Checkpoint_NNNN` continues the evolution from the checkpoint.
+ *
+ * As for `Events::LoadBalancing`, the trigger should fire on all elements at
+ * the same time, e.g. using a trigger on the slab number.
+ */
+template <typename KnownEvents>
+class WriteCheckpoint : public Event<KnownEvents> {
+ public:
+  /// \cond
+  explicit WriteCheckpoint(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(WriteCheckpoint);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "Pause the evolution to write a checkpoint that the simulation can be\n"
+      "restarted from."};
+
+  WriteCheckpoint() = default;
+
+  using argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(Parallel::ConstGlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const Component* const /*meta*/) const noexcept {
+    static_assert(
+        Parallel::has_write_checkpoint_phase_v<typename Metavariables::Phase>,
+        "The WriteCheckpoint event requires a WriteCheckpoint phase in the "
+        "Metavariables.");
+    Parallel::pause_for_phase<Component>(
+        cache, array_index, Metavariables::Phase::WriteCheckpoint);
+  }
+};
+
+/// \cond
+template <typename KnownEvents>
+PUP::able::PUP_ID WriteCheckpoint<KnownEvents>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
@@ -6,22 +6,32 @@
 // IWYU pragma: no_include <pup.h>
 #include <vector>
 
+#include "Domain/Amr/Tags.hpp"
 #include "Domain/DomainCreators/RegisterDerivedWithCharm.cpp"
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/FloatingPointExceptions.hpp"
 #include "Evolution/Actions/ComputeVolumeDuDt.hpp"  // IWYU pragma: keep
 #include "Evolution/Actions/ComputeVolumeFluxes.hpp"  // IWYU pragma: keep
+#include "Evolution/Amr/Actions/InitializeElement.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"  // IWYU pragma: keep
-#include "Evolution/DiscontinuousGalerkin/InitializeElement.hpp"
 #include "Evolution/DiscontinuousGalerkin/SlopeLimiters/LimiterActions.hpp"
 #include "Evolution/DiscontinuousGalerkin/SlopeLimiters/Minmod.hpp"
 #include "Evolution/DiscontinuousGalerkin/SlopeLimiters/Tags.hpp"
+#include "Evolution/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/AdaptMesh.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Evolution/EventsAndTriggers/EventsAndTriggers.hpp"
+#include "Evolution/EventsAndTriggers/LoadBalancing.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/PrintFluxCommunicationTiming.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Trigger.hpp"
+#include "Evolution/EventsAndTriggers/WriteCheckpoint.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/Burgers/Equations.hpp"  // IWYU pragma: keep // for LocalLaxFriedrichsFlux
 #include "Evolution/Systems/Burgers/System.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ApplyBoundaryFluxesGlobalTimeStepping.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ApplyBoundaryFluxesLocalTimeStepping.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxCommunication.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ImposeBoundaryConditions.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregator.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/GotoAction.hpp"  // IWYU pragma: keep
@@ -42,6 +52,7 @@
 #include "Time/StepControllers/StepController.hpp"
 #include "Time/Tags.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Time/Triggers/TimeTriggers.hpp"  // IWYU pragma: keep
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -65,10 +76,24 @@ struct EvolutionMetavars {
       OptionTags::NumericalFluxParams<Burgers::LocalLaxFriedrichsFlux>;
   using limiter = OptionTags::SlopeLimiterParams<
       SlopeLimiters::Minmod<1, system::variables_tag::tags_list>>;
+  struct EventClasses {
+    template <typename T>
+    using type = tmpl::list<Events::AdaptMesh<T>, Events::LoadBalancing<T>,
+                            Events::PrintFluxCommunicationTiming<T>,
+                            Events::WriteCheckpoint<T>>;
+  };
+  struct TriggerClasses {
+    template <typename T>
+    using type = Triggers::time_triggers<T>;
+  };
+  using events_and_triggers_tag =
+      Tags::EventsAndTriggers<EventClasses, TriggerClasses>;
+
   using const_global_cache_tag_list =
       tmpl::list<analytic_solution_tag,
                  OptionTags::TypedTimeStepper<tmpl::conditional_t<
-                     local_time_stepping, LtsTimeStepper, TimeStepper>>>;
+                     local_time_stepping, LtsTimeStepper, TimeStepper>>,
+                 events_and_triggers_tag, OptionTags::AmrCriterion>;
   using domain_creator_tag = OptionTags::DomainCreator<1, Frame::Inertial>;
 
   using step_choosers =
@@ -81,6 +106,7 @@ struct EvolutionMetavars {
       dg::Actions::SendDataForFluxes<EvolutionMetavars>,
       Actions::ComputeVolumeDuDt,
       dg::Actions::ImposeDirichletBoundaryConditions<EvolutionMetavars>,
+      dg::Actions::RecordOverlappedWork,
       dg::Actions::ReceiveDataForFluxes<EvolutionMetavars>,
       tmpl::conditional_t<local_time_stepping, tmpl::list<>,
                           dg::Actions::ApplyBoundaryFluxesGlobalTimeStepping>,
@@ -94,16 +120,19 @@ struct EvolutionMetavars {
       SlopeLimiters::Actions::Limit<EvolutionMetavars>>>;
 
   struct EvolvePhaseStart;
-  using component_list = tmpl::list<DgElementArray<
-      EvolutionMetavars, dg::Actions::InitializeElement<1>,
-      tmpl::flatten<tmpl::list<
-          SelfStart::self_start_procedure<compute_rhs, update_variables>,
-          Actions::Label<EvolvePhaseStart>, Actions::AdvanceTime,
-          Actions::FinalTime,
-          tmpl::conditional_t<local_time_stepping,
-                              Actions::ChangeStepSize<step_choosers>,
-                              tmpl::list<>>,
-          compute_rhs, update_variables, Actions::Goto<EvolvePhaseStart>>>>>;
+  using component_list = tmpl::list<
+      dg::FluxAggregator<EvolutionMetavars>,
+      DgElementArray<
+          EvolutionMetavars, amr::Actions::InitializeElement<1>,
+          tmpl::flatten<tmpl::list<
+              SelfStart::self_start_procedure<compute_rhs, update_variables>,
+              Actions::Label<EvolvePhaseStart>, Actions::AdvanceTime,
+              Actions::RunEventsAndTriggers, Actions::FinalTime,
+              tmpl::conditional_t<local_time_stepping,
+                                  Actions::ChangeStepSize<step_choosers>,
+                                  tmpl::list<>>,
+              compute_rhs, update_variables,
+              Actions::Goto<EvolvePhaseStart>>>>>;
 
   static constexpr OptionString help{
       "Evolve the Burgers equation.\n\n"
@@ -113,6 +142,10 @@ struct EvolutionMetavars {
   enum class Phase {
     Initialization,
     Evolve,
+    EvaluateAmrCriteria,
+    AdjustDomain,
+    LoadBalancing,
+    WriteCheckpoint,
     Exit
   };
 
@@ -120,12 +153,16 @@ struct EvolutionMetavars {
       const Phase& current_phase,
       const Parallel::CProxy_ConstGlobalCache<
           EvolutionMetavars>& /*cache_proxy*/) noexcept {
-    return current_phase == Phase::Initialization ? Phase::Evolve : Phase::Exit;
+    return current_phase == Phase::Evolve ? Phase::Exit : Phase::Evolve;
   }
 };
 
 static const std::vector<void (*)()> charm_init_node_funcs{
     &setup_error_handling, &DomainCreators::register_derived_with_charm,
-    &Parallel::register_derived_classes_with_charm<TimeStepper>};
+    &Parallel::register_derived_classes_with_charm<TimeStepper>,
+    &Parallel::register_derived_classes_with_charm<
+        Event<EvolutionMetavars::EventClasses>>,
+    &Parallel::register_derived_classes_with_charm<
+        Trigger<EvolutionMetavars::TriggerClasses>>};
 static const std::vector<void (*)()> charm_init_proc_funcs{
     &enable_floating_point_exceptions};
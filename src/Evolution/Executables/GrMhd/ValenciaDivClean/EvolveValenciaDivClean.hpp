@@ -16,6 +16,13 @@
 #include "Evolution/DiscontinuousGalerkin/SlopeLimiters/LimiterActions.hpp"
 #include "Evolution/DiscontinuousGalerkin/SlopeLimiters/Minmod.hpp"
 #include "Evolution/DiscontinuousGalerkin/SlopeLimiters/Tags.hpp"
+#include "Evolution/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Evolution/EventsAndTriggers/EventsAndTriggers.hpp"
+#include "Evolution/EventsAndTriggers/LoadBalancing.hpp"
+#include "Evolution/EventsAndTriggers/PrintFluxCommunicationTiming.hpp"
+#include "Evolution/EventsAndTriggers/Trigger.hpp"
+#include "Evolution/EventsAndTriggers/WriteCheckpoint.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/FixConservatives.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Initialize.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Observe.hpp"
@@ -29,6 +36,7 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ApplyBoundaryFluxesLocalTimeStepping.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxCommunication.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ImposeBoundaryConditions.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregator.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/NumericalFluxes/LocalLaxFriedrichs.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Options/Options.hpp"
@@ -52,6 +60,7 @@
 #include "Time/StepControllers/StepController.hpp"
 #include "Time/Tags.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Time/Triggers/TimeTriggers.hpp"
 #include "Utilities/Functional.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -95,6 +104,20 @@ struct EvolutionMetavars {
   using ordered_list_of_primitive_recovery_schemes = tmpl::list<
       grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>;
 
+  struct EventClasses {
+    template <typename T>
+    using type =
+        tmpl::list<Events::LoadBalancing<T>,
+                   Events::PrintFluxCommunicationTiming<T>,
+                   Events::WriteCheckpoint<T>>;
+  };
+  struct TriggerClasses {
+    template <typename T>
+    using type = Triggers::time_triggers<T>;
+  };
+  using events_and_triggers_tag =
+      Tags::EventsAndTriggers<EventClasses, TriggerClasses>;
+
   // hack this has to be synchronized with the Observe action :(
   using Redum = Parallel::ReductionDatum<double, funcl::Plus<>,
                                          funcl::Sqrt<funcl::Divides<>>,
@@ -108,6 +131,7 @@ struct EvolutionMetavars {
       dg::Actions::SendDataForFluxes<EvolutionMetavars>,
       Actions::ComputeVolumeSources, Actions::ComputeVolumeDuDt,
       dg::Actions::ImposeDirichletBoundaryConditions<EvolutionMetavars>,
+      dg::Actions::RecordOverlappedWork,
       dg::Actions::ReceiveDataForFluxes<EvolutionMetavars>,
       tmpl::conditional_t<local_time_stepping, tmpl::list<>,
                           dg::Actions::ApplyBoundaryFluxesGlobalTimeStepping>,
@@ -126,12 +150,14 @@ struct EvolutionMetavars {
   using component_list = tmpl::list<
       observers::Observer<EvolutionMetavars>,
       observers::ObserverWriter<EvolutionMetavars>,
+      dg::FluxAggregator<EvolutionMetavars>,
       DgElementArray<
           EvolutionMetavars, grmhd::ValenciaDivClean::Actions::Initialize<3>,
           tmpl::flatten<tmpl::list<
               SelfStart::self_start_procedure<compute_rhs, update_variables>,
               Actions::Label<EvolvePhaseStart>, Actions::AdvanceTime,
-              grmhd::ValenciaDivClean::Actions::Observe, Actions::FinalTime,
+              grmhd::ValenciaDivClean::Actions::Observe,
+              Actions::RunEventsAndTriggers, Actions::FinalTime,
               tmpl::conditional_t<local_time_stepping,
                                   Actions::ChangeStepSize<step_choosers>,
                                   tmpl::list<>>,
@@ -142,7 +168,7 @@ struct EvolutionMetavars {
       tmpl::list<analytic_solution_tag,
                  OptionTags::TypedTimeStepper<tmpl::conditional_t<
                      local_time_stepping, LtsTimeStepper, TimeStepper>>,
-                 OptionTags::DampingParameter>;
+                 OptionTags::DampingParameter, events_and_triggers_tag>;
 
   using domain_creator_tag = OptionTags::DomainCreator<3, Frame::Inertial>;
 
@@ -150,7 +176,14 @@ struct EvolutionMetavars {
       "Evolve the Valencia formulation of the GRMHD system with divergence "
       "cleaning.\n\n"};
 
-  enum class Phase { Initialization, RegisterWithObserver, Evolve, Exit };
+  enum class Phase {
+    Initialization,
+    RegisterWithObserver,
+    Evolve,
+    LoadBalancing,
+    WriteCheckpoint,
+    Exit
+  };
 
   static Phase determine_next_phase(
       const Phase& current_phase,
@@ -163,6 +196,9 @@ struct EvolutionMetavars {
         return Phase::Evolve;
       case Phase::Evolve:
         return Phase::Exit;
+      case Phase::LoadBalancing:
+      case Phase::WriteCheckpoint:
+        return Phase::Evolve;
       case Phase::Exit:
         ERROR(
             "Should never call determine_next_phase with the current phase "
@@ -180,7 +216,11 @@ static const std::vector<void (*)()> charm_init_node_funcs{
     &Parallel::register_derived_classes_with_charm<
         StepChooser<EvolutionMetavars::step_choosers>>,
     &Parallel::register_derived_classes_with_charm<StepController>,
-    &Parallel::register_derived_classes_with_charm<TimeStepper>};
+    &Parallel::register_derived_classes_with_charm<TimeStepper>,
+    &Parallel::register_derived_classes_with_charm<
+        Event<EvolutionMetavars::EventClasses>>,
+    &Parallel::register_derived_classes_with_charm<
+        Trigger<EvolutionMetavars::TriggerClasses>>};
 
 static const std::vector<void (*)()> charm_init_proc_funcs{
     &enable_floating_point_exceptions};
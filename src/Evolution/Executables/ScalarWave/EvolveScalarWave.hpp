@@ -13,6 +13,13 @@
 #include "Evolution/Actions/ComputeVolumeDuDt.hpp"  // IWYU pragma: keep
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"  // IWYU pragma: keep
 #include "Evolution/DiscontinuousGalerkin/InitializeElement.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Evolution/EventsAndTriggers/EventsAndTriggers.hpp"
+#include "Evolution/EventsAndTriggers/LoadBalancing.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/PrintFluxCommunicationTiming.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Trigger.hpp"
+#include "Evolution/EventsAndTriggers/WriteCheckpoint.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/ScalarWave/Actions.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/ScalarWave/Equations.hpp"  // IWYU pragma: keep // for UpwindFlux
 #include "Evolution/Systems/ScalarWave/System.hpp"
@@ -24,6 +31,7 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ComputeNonconservativeBoundaryFluxes.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxCommunication.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ImposeBoundaryConditions.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregator.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/GotoAction.hpp"  // IWYU pragma: keep
@@ -46,6 +54,7 @@
 #include "Time/StepControllers/StepController.hpp"
 #include "Time/Tags.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Time/Triggers/TimeTriggers.hpp"  // IWYU pragma: keep
 #include "Utilities/Functional.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -71,12 +80,27 @@ struct EvolutionMetavars {
   using boundary_condition_tag = analytic_solution_tag;
   using normal_dot_numerical_flux =
       OptionTags::NumericalFluxParams<ScalarWave::UpwindFlux<Dim>>;
+  struct EventClasses {
+    template <typename T>
+    using type =
+        tmpl::list<Events::LoadBalancing<T>,
+                   Events::PrintFluxCommunicationTiming<T>,
+                   Events::WriteCheckpoint<T>>;
+  };
+  struct TriggerClasses {
+    template <typename T>
+    using type = Triggers::time_triggers<T>;
+  };
+  using events_and_triggers_tag =
+      Tags::EventsAndTriggers<EventClasses, TriggerClasses>;
+
   // A tmpl::list of tags to be added to the ConstGlobalCache by the
   // metavariables
   using const_global_cache_tag_list =
       tmpl::list<analytic_solution_tag,
                  OptionTags::TypedTimeStepper<tmpl::conditional_t<
-                     local_time_stepping, LtsTimeStepper, TimeStepper>>>;
+                     local_time_stepping, LtsTimeStepper, TimeStepper>>,
+                 events_and_triggers_tag>;
   using domain_creator_tag = OptionTags::DomainCreator<Dim, Frame::Inertial>;
 
   using Redum = Parallel::ReductionDatum<double, funcl::Plus<>,
@@ -96,6 +120,7 @@ struct EvolutionMetavars {
       dg::Actions::SendDataForFluxes<EvolutionMetavars>,
       Actions::ComputeVolumeDuDt,
       dg::Actions::ImposeDirichletBoundaryConditions<EvolutionMetavars>,
+      dg::Actions::RecordOverlappedWork,
       dg::Actions::ReceiveDataForFluxes<EvolutionMetavars>,
       tmpl::conditional_t<local_time_stepping, tmpl::list<>,
                           dg::Actions::ApplyBoundaryFluxesGlobalTimeStepping>,
@@ -110,12 +135,14 @@ struct EvolutionMetavars {
   using component_list = tmpl::list<
       observers::Observer<EvolutionMetavars>,
       observers::ObserverWriter<EvolutionMetavars>,
+      dg::FluxAggregator<EvolutionMetavars>,
       DgElementArray<
           EvolutionMetavars, dg::Actions::InitializeElement<Dim>,
           tmpl::flatten<tmpl::list<
               SelfStart::self_start_procedure<compute_rhs, update_variables>,
               Actions::Label<EvolvePhaseStart>, Actions::AdvanceTime,
-              ScalarWave::Actions::Observe, Actions::FinalTime,
+              ScalarWave::Actions::Observe, Actions::RunEventsAndTriggers,
+              Actions::FinalTime,
               tmpl::conditional_t<local_time_stepping,
                                   Actions::ChangeStepSize<step_choosers>,
                                   tmpl::list<>>,
@@ -131,6 +158,8 @@ struct EvolutionMetavars {
     Initialization,
     RegisterWithObserver,
     Evolve,
+    LoadBalancing,
+    WriteCheckpoint,
     Exit
   };
 
@@ -145,6 +174,9 @@ struct EvolutionMetavars {
         return Phase::Evolve;
       case Phase::Evolve:
         return Phase::Exit;
+      case Phase::LoadBalancing:
+      case Phase::WriteCheckpoint:
+        return Phase::Evolve;
       case Phase::Exit:
         ERROR(
             "Should never call determine_next_phase with the current phase "
@@ -163,6 +195,10 @@ static const std::vector<void (*)()> charm_init_node_funcs{
     &Parallel::register_derived_classes_with_charm<
         StepChooser<metavariables::step_choosers>>,
     &Parallel::register_derived_classes_with_charm<StepController>,
-    &Parallel::register_derived_classes_with_charm<TimeStepper>};
+    &Parallel::register_derived_classes_with_charm<TimeStepper>,
+    &Parallel::register_derived_classes_with_charm<
+        Event<metavariables::EventClasses>>,
+    &Parallel::register_derived_classes_with_charm<
+        Trigger<metavariables::TriggerClasses>>};
 static const std::vector<void (*)()> charm_init_proc_funcs{
     &enable_floating_point_exceptions};
@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Tags.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace Initialization {
+
+/// \brief Allocate items for adaptive mesh refinement
+///
+/// The flags are amr::Flag::Undefined until a decision is made in the
+/// `EvaluateAmrCriteria` phase.
+///
+/// DataBox changes:
+/// - Adds:
+///   * `amr::Tags::Flags<Dim>`
+///   * `amr::Tags::NeighborFlags<Dim>`
+///   * `amr::Tags::NeighborMeshes<Dim>`
+///
+/// - Removes: nothing
+/// - Modifies: nothing
+template <size_t Dim>
+struct Amr {
+  using simple_tags =
+      db::AddSimpleTags<amr::Tags::Flags<Dim>, amr::Tags::NeighborFlags<Dim>,
+                        amr::Tags::NeighborMeshes<Dim>>;
+  using compute_tags = db::AddComputeTags<>;
+  template <typename TagsList>
+  static auto initialize(db::DataBox<TagsList>&& box) noexcept {
+    return db::create_from<db::RemoveTags<>, simple_tags, compute_tags>(
+        std::move(box), make_array<Dim>(amr::Flag::Undefined),
+        db::item_type<amr::Tags::NeighborFlags<Dim>>{},
+        db::item_type<amr::Tags::NeighborMeshes<Dim>>{});
+  }
+};
+
+}  // namespace Initialization
@@ -51,6 +51,7 @@ namespace Initialization {
 ///   * Tags::Mortars<Tags::Next<temporal_id_tag>, dim>
 ///   * Tags::Mortars<Tags::Mesh<dim - 1>, dim>
 ///   * Tags::Mortars<Tags::MortarSize<dim - 1>, dim>
+///   * Tags::FluxCommunicationTiming
 /// - Removes: nothing
 /// - Modifies: nothing
 template <typename Metavariables>
@@ -124,10 +125,11 @@ struct DiscontinuousGalerkin {
         db::AddSimpleTags<mortar_data_tag,
                           Tags::Mortars<Tags::Next<temporal_id_tag>, dim>,
                           Tags::Mortars<Tags::Mesh<dim - 1>, dim>,
-                          Tags::Mortars<Tags::MortarSize<dim - 1>, dim>>>(
+                          Tags::Mortars<Tags::MortarSize<dim - 1>, dim>,
+                          Tags::FluxCommunicationTiming>>(
         std::move(box), std::move(mortar_data),
         std::move(mortar_next_temporal_ids), std::move(mortar_meshes),
-        std::move(mortar_sizes));
+        std::move(mortar_sizes), dg::FluxCommunicationTiming{});
   }
 
   template <typename LocalSystem, bool IsInFluxConservativeForm =
@@ -137,6 +139,7 @@ struct DiscontinuousGalerkin {
         mortar_data_tag, Tags::Mortars<Tags::Next<temporal_id_tag>, dim>,
         Tags::Mortars<Tags::Mesh<dim - 1>, dim>,
         Tags::Mortars<Tags::MortarSize<dim - 1>, dim>,
+        Tags::FluxCommunicationTiming,
         interface_tag<typename flux_comm_types::normal_dot_fluxes_tag>,
         interior_boundary_tag<typename flux_comm_types::normal_dot_fluxes_tag>,
         external_boundary_tag<typename flux_comm_types::normal_dot_fluxes_tag>>;
@@ -201,7 +204,8 @@ struct DiscontinuousGalerkin {
         db::AddSimpleTags<mortar_data_tag,
                           Tags::Mortars<Tags::Next<temporal_id_tag>, dim>,
                           Tags::Mortars<Tags::Mesh<dim - 1>, dim>,
-                          Tags::Mortars<Tags::MortarSize<dim - 1>, dim>>;
+                          Tags::Mortars<Tags::MortarSize<dim - 1>, dim>,
+                          Tags::FluxCommunicationTiming>;
 
     template <typename Tag>
     using interface_compute_tag =
@@ -3,16 +3,118 @@
 
 #include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
 
+#include <algorithm>
 #include <array>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "Utilities/Gsl.hpp"
+#include "Utilities/ScratchArena.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 
 namespace GeneralizedHarmonic {
+namespace {
+// The temporaries of ComputeDuDt
+namespace Temporaries {
+struct Gamma1Gamma2 {
+  using type = Scalar<DataVector>;
+};
+struct Gamma1Plus1 {
+  using type = Scalar<DataVector>;
+};
+template <size_t Dim>
+struct PhiOneUp {
+  using type = tnsr::Iaa<DataVector, Dim>;
+};
+template <size_t Dim>
+struct PhiThreeUp {
+  using type = tnsr::abC<DataVector, Dim>;
+};
+template <size_t Dim>
+struct PiTwoUp {
+  using type = tnsr::aB<DataVector, Dim>;
+};
+template <size_t Dim>
+struct ChristoffelFirstKindThreeUp {
+  using type = tnsr::abC<DataVector, Dim>;
+};
+template <size_t Dim>
+struct PiDotNormalSpacetimeVector {
+  using type = tnsr::a<DataVector, Dim>;
+};
+struct PiContractTwoNormalSpacetimeVectors {
+  using type = Scalar<DataVector>;
+};
+template <size_t Dim>
+struct PhiDotNormalSpacetimeVector {
+  using type = tnsr::ia<DataVector, Dim>;
+};
+template <size_t Dim>
+struct PhiContractTwoNormalSpacetimeVectors {
+  using type = tnsr::a<DataVector, Dim>;
+};
+template <size_t Dim>
+struct ThreeIndexConstraint {
+  using type = tnsr::iaa<DataVector, Dim>;
+};
+template <size_t Dim>
+struct OneIndexConstraint {
+  using type = tnsr::a<DataVector, Dim>;
+};
+struct NormalDotOneIndexConstraint {
+  using type = Scalar<DataVector>;
+};
+template <size_t Dim>
+struct ShiftDotThreeIndexConstraint {
+  using type = tnsr::aa<DataVector, Dim>;
+};
+
+template <size_t Dim>
+using tags = tmpl::list<
+    Gamma1Gamma2, Gamma1Plus1, PhiOneUp<Dim>, PhiThreeUp<Dim>, PiTwoUp<Dim>,
+    ChristoffelFirstKindThreeUp<Dim>, PiDotNormalSpacetimeVector<Dim>,
+    PiContractTwoNormalSpacetimeVectors, PhiDotNormalSpacetimeVector<Dim>,
+    PhiContractTwoNormalSpacetimeVectors<Dim>, ThreeIndexConstraint<Dim>,
+    OneIndexConstraint<Dim>, NormalDotOneIndexConstraint,
+    ShiftDotThreeIndexConstraint<Dim>>;
+}  // namespace Temporaries
+
+template <typename TensorType>
+void point_into_buffer(const gsl::not_null<TensorType*> tensor,
+                       const gsl::not_null<double**> buffer,
+                       const size_t number_of_grid_points) noexcept {
+  for (auto& component : *tensor) {
+    component.set_data_ref(*buffer, number_of_grid_points);
+    *buffer += number_of_grid_points;
+  }
+}
+
+// Point the temporaries into a single zeroed block of `arena`, laid out like
+// the data of a `Variables` holding all of them, so that the memory is reused
+// by every call on the thread instead of being allocated for each tensor.
+template <typename... TemporaryTags>
+void set_temporaries(
+    const gsl::not_null<tuples::TaggedTuple<TemporaryTags...>*> temporaries,
+    const gsl::not_null<ScratchArena*> arena,
+    const size_t number_of_grid_points) noexcept {
+  const std::array<size_t, sizeof...(TemporaryTags)> number_of_components{
+      {TemporaryTags::type::size()...}};
+  size_t buffer_size = 0;
+  for (const size_t components : number_of_components) {
+    buffer_size += components * number_of_grid_points;
+  }
+  double* buffer = arena->allocate(buffer_size);
+  std::fill(buffer, buffer + buffer_size, 0.0);
+  expand_pack((point_into_buffer(
+                   make_not_null(&tuples::get<TemporaryTags>(*temporaries)),
+                   make_not_null(&buffer), number_of_grid_points),
+               0)...);
+}
+}  // namespace
 
 /// \cond
 template <size_t Dim>
@@ -38,9 +140,16 @@ void ComputeDuDt<Dim>::apply(
     const tnsr::a<DataVector, Dim>& normal_spacetime_one_form) {
   const size_t n_pts = shift.begin()->size();
 
-  const DataVector gamma12 = gamma1.get() * gamma2.get();
+  auto& arena = ScratchArena::thread_local_instance();
+  const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+  tuples::tagged_tuple_from_typelist<Temporaries::tags<Dim>> temporaries{};
+  set_temporaries(make_not_null(&temporaries), make_not_null(&arena), n_pts);
+
+  DataVector& gamma12 =
+      get(tuples::get<Temporaries::Gamma1Gamma2>(temporaries));
+  gamma12 = gamma1.get() * gamma2.get();
 
-  tnsr::Iaa<DataVector, Dim> phi_1_up{DataVector(n_pts, 0.)};
+  auto& phi_1_up = tuples::get<Temporaries::PhiOneUp<Dim>>(temporaries);
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t n = 0; n < Dim; ++n) {
@@ -52,7 +161,7 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::abC<DataVector, Dim> phi_3_up{DataVector(n_pts, 0.)};
+  auto& phi_3_up = tuples::get<Temporaries::PhiThreeUp<Dim>>(temporaries);
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t nu = 0; nu < Dim + 1; ++nu) {
       for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
@@ -64,7 +173,7 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::aB<DataVector, Dim> pi_2_up{DataVector(n_pts, 0.)};
+  auto& pi_2_up = tuples::get<Temporaries::PiTwoUp<Dim>>(temporaries);
   for (size_t nu = 0; nu < Dim + 1; ++nu) {
     for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
       for (size_t beta = 0; beta < Dim + 1; ++beta) {
@@ -74,7 +183,8 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::abC<DataVector, Dim> christoffel_first_kind_3_up{DataVector(n_pts, 0.)};
+  auto& christoffel_first_kind_3_up =
+      tuples::get<Temporaries::ChristoffelFirstKindThreeUp<Dim>>(temporaries);
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     for (size_t nu = 0; nu < Dim + 1; ++nu) {
       for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
@@ -87,8 +197,8 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::a<DataVector, Dim> pi_dot_normal_spacetime_vector{
-      DataVector(n_pts, 0.)};
+  auto& pi_dot_normal_spacetime_vector =
+      tuples::get<Temporaries::PiDotNormalSpacetimeVector<Dim>>(temporaries);
   for (size_t nu = 0; nu < Dim + 1; ++nu) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       pi_dot_normal_spacetime_vector.get(mu) +=
@@ -96,15 +206,17 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  DataVector pi_contract_two_normal_spacetime_vectors{DataVector(n_pts, 0.)};
+  DataVector& pi_contract_two_normal_spacetime_vectors = get(
+      tuples::get<Temporaries::PiContractTwoNormalSpacetimeVectors>(
+          temporaries));
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     pi_contract_two_normal_spacetime_vectors +=
         normal_spacetime_vector.get(mu) *
         pi_dot_normal_spacetime_vector.get(mu);
   }
 
-  tnsr::ia<DataVector, Dim> phi_dot_normal_spacetime_vector{
-      DataVector(n_pts, 0.)};
+  auto& phi_dot_normal_spacetime_vector =
+      tuples::get<Temporaries::PhiDotNormalSpacetimeVector<Dim>>(temporaries);
   for (size_t n = 0; n < Dim; ++n) {
     for (size_t nu = 0; nu < Dim + 1; ++nu) {
       for (size_t mu = 0; mu < Dim + 1; ++mu) {
@@ -114,8 +226,9 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::a<DataVector, Dim> phi_contract_two_normal_spacetime_vectors{
-      DataVector(n_pts, 0.)};
+  auto& phi_contract_two_normal_spacetime_vectors =
+      tuples::get<Temporaries::PhiContractTwoNormalSpacetimeVectors<Dim>>(
+          temporaries);
   for (size_t n = 0; n < Dim; ++n) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       phi_contract_two_normal_spacetime_vectors.get(n) +=
@@ -124,7 +237,8 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::iaa<DataVector, Dim> three_index_constraint{DataVector(n_pts, 0.)};
+  auto& three_index_constraint =
+      tuples::get<Temporaries::ThreeIndexConstraint<Dim>>(temporaries);
   for (size_t n = 0; n < Dim; ++n) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t nu = mu; nu < Dim + 1; ++nu) {
@@ -134,22 +248,26 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::a<DataVector, Dim> one_index_constraint{DataVector(n_pts, 0.)};
+  auto& one_index_constraint =
+      tuples::get<Temporaries::OneIndexConstraint<Dim>>(temporaries);
   for (size_t nu = 0; nu < Dim + 1; ++nu) {
     one_index_constraint.get(nu) =
         gauge_function.get(nu) + trace_christoffel.get(nu);
   }
 
-  DataVector normal_dot_one_index_constraint{DataVector(n_pts, 0.)};
+  DataVector& normal_dot_one_index_constraint =
+      get(tuples::get<Temporaries::NormalDotOneIndexConstraint>(temporaries));
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     normal_dot_one_index_constraint +=
         normal_spacetime_vector.get(mu) * one_index_constraint.get(mu);
   }
 
-  const DataVector gamma1p1 = 1.0 + gamma1.get();
+  DataVector& gamma1p1 =
+      get(tuples::get<Temporaries::Gamma1Plus1>(temporaries));
+  gamma1p1 = 1.0 + gamma1.get();
 
-  tnsr::aa<DataVector, Dim> shift_dot_three_index_constraint{
-      DataVector(n_pts, 0.)};
+  auto& shift_dot_three_index_constraint =
+      tuples::get<Temporaries::ShiftDotThreeIndexConstraint<Dim>>(temporaries);
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t nu = mu; nu < Dim + 1; ++nu) {
@@ -37,6 +37,10 @@ namespace GeneralizedHarmonic {
    *
    * \details For the full form of the equations see "A New Generalized Harmonic
    * Evolution System" by Lindblom et. al, arxiv.org/abs/gr-qc/0512093.
+   *
+   * The intermediate tensors are stored in a single block taken from the
+   * `ScratchArena` of the calling thread, so the RHS does not allocate once
+   * the arena has grown to the size needed for the element.
    */
 template <size_t Dim>
 struct ComputeDuDt {
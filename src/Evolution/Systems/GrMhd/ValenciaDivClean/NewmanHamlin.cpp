@@ -7,8 +7,11 @@
 #include <array>
 #include <boost/none.hpp>
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -180,6 +183,274 @@ boost::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
     }
   }  // while loop
 }
+
+namespace {
+// Copies the entries of `vector` at the lanes for which `keep` is true to the
+// front of `vector`, preserving their order.
+template <typename VectorType>
+void compact(const gsl::not_null<VectorType*> vector,
+             const std::vector<bool>& keep) noexcept {
+  size_t kept = 0;
+  for (size_t lane = 0; lane < keep.size(); ++lane) {
+    if (keep[lane]) {
+      (*vector)[kept++] = (*vector)[lane];
+    }
+  }
+}
+}  // namespace
+
+template <size_t ThermodynamicDim>
+void NewmanHamlin::apply(
+    const gsl::not_null<BatchedPrimitiveRecoveryData*> primitive_data,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  const size_t number_of_points = total_energy_density.size();
+  primitive_data->initialize(number_of_points);
+
+  // The points that are still being iterated on are stored contiguously at
+  // the front of the following vectors, one lane per point, so that each step
+  // of the iteration is done with DataVector expressions over all lanes.
+  // Lanes are removed once the point has either converged or failed.
+  std::vector<size_t> point(number_of_points);
+  DataVector e(number_of_points);
+  DataVector m_squared(number_of_points);
+  DataVector t_squared(number_of_points);
+  DataVector b_squared(number_of_points);
+  DataVector rho_w(number_of_points);
+  DataVector d_in_cubic(number_of_points);
+  DataVector minimum_pressure(number_of_points);
+  DataVector current_pressure(number_of_points);
+  DataVector previous_pressure(number_of_points);
+  std::vector<std::array<double, 3>> aitken_pressure(number_of_points);
+  std::vector<size_t> valid_entries_in_aitken_pressure(number_of_points, 1);
+  std::vector<bool> converged(number_of_points, false);
+  // Temporaries of each iteration step
+  DataVector a_in_cubic(number_of_points);
+  DataVector root_of_cubic(number_of_points);
+  DataVector rho_h_w_squared(number_of_points);
+  DataVector v_squared(number_of_points);
+  DataVector current_lorentz_factor(number_of_points);
+  DataVector current_rest_mass_density(number_of_points);
+  DataVector current_specific_enthalpy(number_of_points);
+  std::vector<bool> keep(number_of_points);
+
+  // constant in cubic equation  f(eps) = eps^3 - a eps^2 + d
+  // whose root is being found at each point in the iteration below
+  size_t number_of_lanes = 0;
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double local_d_in_cubic =
+        0.5 * (momentum_density_squared[s] * magnetic_field_squared[s] -
+               square(momentum_density_dot_magnetic_field[s]));
+    if (UNLIKELY(-1e-12 * square(momentum_density_dot_magnetic_field[s]) >
+                 local_d_in_cubic)) {
+      continue;
+    }
+    point[number_of_lanes] = s;
+    e[number_of_lanes] = total_energy_density[s];
+    m_squared[number_of_lanes] = momentum_density_squared[s];
+    t_squared[number_of_lanes] = square(momentum_density_dot_magnetic_field[s]);
+    b_squared[number_of_lanes] = magnetic_field_squared[s];
+    rho_w[number_of_lanes] = rest_mass_density_times_lorentz_factor[s];
+    d_in_cubic[number_of_lanes] = std::max(0.0, local_d_in_cubic);
+    ++number_of_lanes;
+  }
+
+  const auto lanes = [&number_of_lanes](DataVector& vector) noexcept {
+    return DataVector(vector.data(), number_of_lanes);
+  };
+  if (number_of_lanes > 0) {
+    // bound needed so cubic equation has a positive root
+    lanes(minimum_pressure) = cbrt(6.75 * lanes(d_in_cubic)) - lanes(e) -
+                              0.5 * lanes(b_squared);
+  }
+  for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+    const double initial_guess_for_pressure{0.0};
+    minimum_pressure[lane] = std::max(0.0, minimum_pressure[lane]);
+    current_pressure[lane] =
+        std::max(minimum_pressure[lane], initial_guess_for_pressure);
+    aitken_pressure[lane] = {{current_pressure[lane],
+                              std::numeric_limits<double>::signaling_NaN(),
+                              std::numeric_limits<double>::signaling_NaN()}};
+  }
+
+  for (size_t iteration_step = 0; number_of_lanes > 0; ++iteration_step) {
+    // Once the maximum number of iterations is reached, only the lanes that
+    // converged in the previous step may finish.
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      keep[lane] = max_iterations_ != iteration_step or converged[lane];
+    }
+
+    // Lanes that fail are given harmless values for the remainder of the
+    // step so that no floating-point exceptions are raised, and are then
+    // removed.
+    auto current_pressure_lanes = lanes(current_pressure);
+    auto a_in_cubic_lanes = lanes(a_in_cubic);
+    auto rho_h_w_squared_lanes = lanes(rho_h_w_squared);
+    auto root_of_cubic_lanes = lanes(root_of_cubic);
+    auto v_squared_lanes = lanes(v_squared);
+    auto lorentz_factor_lanes = lanes(current_lorentz_factor);
+    auto rest_mass_density_lanes = lanes(current_rest_mass_density);
+    auto specific_enthalpy_lanes = lanes(current_specific_enthalpy);
+    const auto b_squared_lanes = lanes(b_squared);
+    const auto d_in_cubic_lanes = lanes(d_in_cubic);
+
+    lanes(previous_pressure) = current_pressure_lanes;
+    // enforces NH Eq.(5.9): d <= (4/27) a^3 so cubic has positive root
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      current_pressure[lane] =
+          std::max(current_pressure[lane], minimum_pressure[lane]);
+    }
+    a_in_cubic_lanes =
+        lanes(e) + current_pressure_lanes + 0.5 * b_squared_lanes;
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      if (UNLIKELY(a_in_cubic[lane] < 0.0)) {
+        keep[lane] = false;
+        a_in_cubic[lane] = 1.0;
+        d_in_cubic[lane] = 0.0;
+      }
+    }
+
+    // NH Eq. (5.10): d = (4/27) a^3 cos^2(phi)
+    // NH Eq. (5.11) with l=1 is desired positive root
+    root_of_cubic_lanes =
+        (a_in_cubic_lanes / 3.0) *
+        (1.0 -
+         2.0 * cos((2.0 / 3.0) *
+                   (M_PI + acos(sqrt(6.75 * d_in_cubic_lanes /
+                                     (a_in_cubic_lanes * a_in_cubic_lanes *
+                                      a_in_cubic_lanes))))));
+    // NH Eq. (5.5) with their script L being rho_h_w_squared
+    rho_h_w_squared_lanes = root_of_cubic_lanes - b_squared_lanes;
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      if (UNLIKELY(rho_h_w_squared[lane] <= 0.0)) {
+        keep[lane] = false;
+        rho_h_w_squared[lane] = 1.0;
+        root_of_cubic[lane] = 1.0;
+      }
+    }
+
+    // NH Eq. (5.2) with (5.5) substituted in denominator
+    v_squared_lanes =
+        (lanes(m_squared) * square(rho_h_w_squared_lanes) +
+         lanes(t_squared) * (b_squared_lanes + 2.0 * rho_h_w_squared_lanes)) /
+        square(rho_h_w_squared_lanes * root_of_cubic_lanes);
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      if (UNLIKELY(v_squared[lane] < 0.0 or v_squared[lane] >= 1.0)) {
+        keep[lane] = false;
+        v_squared[lane] = 0.0;
+      }
+    }
+
+    lorentz_factor_lanes = sqrt(1.0 / (1.0 - v_squared_lanes));
+    rest_mass_density_lanes = lanes(rho_w) / lorentz_factor_lanes;
+    specific_enthalpy_lanes =
+        rho_h_w_squared_lanes /
+        (rest_mass_density_lanes * square(lorentz_factor_lanes));
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      if (not keep[lane]) {
+        current_specific_enthalpy[lane] = 1.0;
+      } else if (converged[lane]) {
+        const size_t s = point[lane];
+        primitive_data->rest_mass_density[s] = current_rest_mass_density[lane];
+        primitive_data->lorentz_factor[s] = current_lorentz_factor[lane];
+        primitive_data->pressure[s] = current_pressure[lane];
+        primitive_data->rho_h_w_squared[s] = rho_h_w_squared[lane];
+        primitive_data->recovered[s] = true;
+        keep[lane] = false;
+      } else if (UNLIKELY(1.0 - 1.0e-12 > current_specific_enthalpy[lane])) {
+        keep[lane] = false;
+        current_specific_enthalpy[lane] = 1.0;
+      } else {
+        current_specific_enthalpy[lane] =
+            std::max(1.0, current_specific_enthalpy[lane]);
+      }
+    }
+
+    // Evaluate the equation of state for all lanes at once.  Lanes that are
+    // finished hold valid values and are discarded below.
+    Scalar<DataVector> rest_mass_density_scalar{};
+    get(rest_mass_density_scalar)
+        .set_data_ref(current_rest_mass_density.data(), number_of_lanes);
+    Scalar<DataVector> specific_enthalpy_scalar{};
+    get(specific_enthalpy_scalar)
+        .set_data_ref(current_specific_enthalpy.data(), number_of_lanes);
+    const auto new_pressure = make_overloader(
+        [&rest_mass_density_scalar](
+            const EquationsOfState::EquationOfState<true, 1>&
+                the_equation_of_state) noexcept {
+          return the_equation_of_state.pressure_from_density(
+              rest_mass_density_scalar);
+        },
+        [&rest_mass_density_scalar, &specific_enthalpy_scalar ](
+            const EquationsOfState::EquationOfState<true, 2>&
+                the_equation_of_state) noexcept {
+          return the_equation_of_state.pressure_from_density_and_enthalpy(
+              rest_mass_density_scalar, specific_enthalpy_scalar);
+        })(equation_of_state);
+
+    for (size_t lane = 0; lane < number_of_lanes; ++lane) {
+      if (not keep[lane]) {
+        continue;
+      }
+      current_pressure[lane] = get(new_pressure)[lane];
+      auto& lane_aitken_pressure = aitken_pressure[lane];
+      size_t& valid_entries = valid_entries_in_aitken_pressure[lane];
+      gsl::at(lane_aitken_pressure, valid_entries++) = current_pressure[lane];
+      if (3 == valid_entries) {
+        const double aitken_residual =
+            (lane_aitken_pressure[2] - lane_aitken_pressure[1]) /
+            (lane_aitken_pressure[1] - lane_aitken_pressure[0]);
+        if (0.0 <= aitken_residual and aitken_residual < 1.0) {
+          previous_pressure[lane] = current_pressure[lane];
+          current_pressure[lane] =
+              lane_aitken_pressure[1] +
+              (lane_aitken_pressure[2] - lane_aitken_pressure[1]) /
+                  (1.0 - aitken_residual);
+          lane_aitken_pressure = {
+              {current_pressure[lane],
+               std::numeric_limits<double>::signaling_NaN(),
+               std::numeric_limits<double>::signaling_NaN()}};
+          valid_entries = 1;
+        } else {
+          // Aitken extrapolation failed, retain latest 2 values for next
+          // attempt
+          lane_aitken_pressure[0] = lane_aitken_pressure[1];
+          lane_aitken_pressure[1] = lane_aitken_pressure[2];
+          valid_entries = 2;
+        }
+      }
+      if (fabs(current_pressure[lane] - previous_pressure[lane]) <
+          relative_tolerance_ *
+              (current_pressure[lane] + previous_pressure[lane])) {
+        converged[lane] = true;
+        // note primitives are recomputed in the next step before being
+        // stored
+      }
+    }
+
+    keep.resize(number_of_lanes);
+    compact(make_not_null(&point), keep);
+    compact(make_not_null(&e), keep);
+    compact(make_not_null(&m_squared), keep);
+    compact(make_not_null(&t_squared), keep);
+    compact(make_not_null(&b_squared), keep);
+    compact(make_not_null(&rho_w), keep);
+    compact(make_not_null(&d_in_cubic), keep);
+    compact(make_not_null(&minimum_pressure), keep);
+    compact(make_not_null(&current_pressure), keep);
+    compact(make_not_null(&aitken_pressure), keep);
+    compact(make_not_null(&valid_entries_in_aitken_pressure), keep);
+    compact(make_not_null(&converged), keep);
+    number_of_lanes = static_cast<size_t>(
+        std::count(keep.begin(), keep.end(), true));
+    keep.resize(number_of_points);
+  }
+}
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -198,8 +469,25 @@ boost::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&          \
           equation_of_state) noexcept;
 
+#define BATCHED_INSTANTIATION(_, data)                                  \
+  template void grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::      \
+      NewmanHamlin::apply<THERMODIM(data)>(                              \
+          const gsl::not_null<grmhd::ValenciaDivClean::                  \
+                                  PrimitiveRecoverySchemes::             \
+                                      BatchedPrimitiveRecoveryData*>     \
+              primitive_data,                                            \
+          const DataVector& total_energy_density,                        \
+          const DataVector& momentum_density_squared,                    \
+          const DataVector& momentum_density_dot_magnetic_field,         \
+          const DataVector& magnetic_field_squared,                      \
+          const DataVector& rest_mass_density_times_lorentz_factor,      \
+          const EquationsOfState::EquationOfState<true, THERMODIM(data)>& \
+              equation_of_state) noexcept;
+
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
+GENERATE_INSTANTIATIONS(BATCHED_INSTANTIATION, (1, 2))
 
+#undef BATCHED_INSTANTIATION
 #undef INSTANTIATION
 #undef THERMODIM
 /// \endcond
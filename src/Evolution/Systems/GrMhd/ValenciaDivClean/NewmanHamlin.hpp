@@ -9,6 +9,14 @@
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd {
@@ -16,6 +24,7 @@ namespace ValenciaDivClean {
 namespace PrimitiveRecoverySchemes {
 
 /// \cond
+struct BatchedPrimitiveRecoveryData;
 struct PrimitiveRecoveryData;
 /// \endcond
 
@@ -57,6 +66,22 @@ class NewmanHamlin {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) noexcept;
 
+  /// Recover the primitive variables at all points of a batch at once.  The
+  /// iteration is done simultaneously for all points that have neither
+  /// converged nor failed, so that the arithmetic and the equation of state
+  /// are evaluated on contiguous `DataVector`s.  The result at each point is
+  /// the same as that of the pointwise `apply`.
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<BatchedPrimitiveRecoveryData*> primitive_data,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
   static const std::string name() noexcept { return "Newman Hamlin"; }
 
  private:
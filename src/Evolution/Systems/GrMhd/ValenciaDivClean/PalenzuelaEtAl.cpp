@@ -4,12 +4,15 @@
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 
 #include <cmath>
+#include <cstddef>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Overloader.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
@@ -21,15 +24,31 @@ namespace PrimitiveRecoverySchemes {
 
 namespace {
 
+// Clamp v^2 to physical values.  This is needed because the bounds on x used
+// for the root solve do not guarantee a physical velocity.  Some work would be
+// needed to investigate whether better bounds could guarantee a physical
+// velocity.
+void clamp_velocity_squared(const gsl::not_null<double*> v_squared) noexcept {
+  static constexpr double v_maximum = 1.0 - 1.e-12;
+  *v_squared = cpp17::clamp(*v_squared, 0.0, square(v_maximum));
+}
+
+void clamp_velocity_squared(
+    const gsl::not_null<DataVector*> v_squared) noexcept {
+  for (auto& v_squared_at_point : *v_squared) {
+    clamp_velocity_squared(make_not_null(&v_squared_at_point));
+  }
+}
+
 // note q,r,s,t,x are defined in the documentation
-template <size_t ThermodynamicDim>
+template <size_t ThermodynamicDim, typename DataType>
 class FunctionOfX {
  public:
-  FunctionOfX(const double total_energy_density,
-              const double momentum_density_squared,
-              const double momentum_density_dot_magnetic_field,
-              const double magnetic_field_squared,
-              const double rest_mass_density_times_lorentz_factor,
+  FunctionOfX(const DataType& total_energy_density,
+              const DataType& momentum_density_squared,
+              const DataType& momentum_density_dot_magnetic_field,
+              const DataType& magnetic_field_squared,
+              const DataType& rest_mass_density_times_lorentz_factor,
               const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
                   equation_of_state) noexcept
       : q_(total_energy_density / rest_mass_density_times_lorentz_factor - 1.0),
@@ -42,46 +61,47 @@ class FunctionOfX {
             rest_mass_density_times_lorentz_factor),
         equation_of_state_(equation_of_state) {}
 
-  double lorentz_factor(const double x) const noexcept {
-    static constexpr double v_maximum = 1.0 - 1.e-12;
-    // Clamp v^2 to physical values.  This is needed because the bounds on
-    // x used for the root solve do not guarantee a physical velocity.  Some
-    // work would be needed to investigate whether better bounds could guarantee
-    // a physical velocity.
-    const double v_squared = cpp17::clamp(
-        (square(x) * r_ + (2 * x + s_) * t_squared_) / square(x * (x + s_)),
-        0.0, square(v_maximum));
+  DataType lorentz_factor(const DataType& x) const noexcept {
+    DataType v_squared =
+        (square(x) * r_ + (2.0 * x + s_) * t_squared_) / square(x * (x + s_));
+    clamp_velocity_squared(make_not_null(&v_squared));
     return 1.0 / sqrt(1.0 - v_squared);
   }
 
-  double specific_internal_energy(const double x,
-                                  const double lorentz_factor) const noexcept {
+  DataType specific_internal_energy(const DataType& x,
+                                    const DataType& lorentz_factor) const
+      noexcept {
     return lorentz_factor - 1.0 +
            x * (1.0 - square(lorentz_factor)) / lorentz_factor +
            lorentz_factor * (q_ - s_ + 0.5 * t_squared_ / square(x) +
                              0.5 * s_ / square(lorentz_factor));
   }
 
-  double operator()(const double x) const noexcept {
-    const double current_lorentz_factor = lorentz_factor(x);
-    const double current_rest_mass_density =
-        rest_mass_density_times_lorentz_factor_ / current_lorentz_factor;
-    const double current_specific_internal_energy =
-        specific_internal_energy(x, current_lorentz_factor);
-    const double current_pressure = get(make_overloader(
-        [&current_rest_mass_density](
-            const EquationsOfState::EquationOfState<true, 1>&
-                the_equation_of_state) noexcept {
+  DataType pressure(const DataType& rest_mass_density,
+                    const DataType& specific_internal_energy) const noexcept {
+    return get(make_overloader(
+        [&rest_mass_density](const EquationsOfState::EquationOfState<true, 1>&
+                                 the_equation_of_state) noexcept {
           return the_equation_of_state.pressure_from_density(
-              Scalar<double>(current_rest_mass_density));
+              Scalar<DataType>(rest_mass_density));
         },
-        [&current_rest_mass_density, &current_specific_internal_energy ](
+        [&rest_mass_density, &specific_internal_energy ](
             const EquationsOfState::EquationOfState<true, 2>&
                 the_equation_of_state) noexcept {
           return the_equation_of_state.pressure_from_density_and_energy(
-              Scalar<double>(current_rest_mass_density),
-              Scalar<double>(current_specific_internal_energy));
+              Scalar<DataType>(rest_mass_density),
+              Scalar<DataType>(specific_internal_energy));
         })(equation_of_state_));
+  }
+
+  DataType operator()(const DataType& x) const noexcept {
+    const DataType current_lorentz_factor = lorentz_factor(x);
+    const DataType current_rest_mass_density =
+        rest_mass_density_times_lorentz_factor_ / current_lorentz_factor;
+    const DataType current_specific_internal_energy =
+        specific_internal_energy(x, current_lorentz_factor);
+    const DataType current_pressure =
+        pressure(current_rest_mass_density, current_specific_internal_energy);
 
     return x - (1.0 + current_specific_internal_energy +
                 current_pressure / current_rest_mass_density) *
@@ -89,11 +109,11 @@ class FunctionOfX {
   }
 
  private:
-  const double q_;
-  const double r_;
-  const double s_;
-  const double t_squared_;
-  const double rest_mass_density_times_lorentz_factor_;
+  const DataType q_;
+  const DataType r_;
+  const DataType s_;
+  const DataType t_squared_;
+  const DataType rest_mass_density_times_lorentz_factor_;
   const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
       equation_of_state_;
 };
@@ -112,13 +132,13 @@ boost::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
   const double upper_bound =
       (2.0 * total_energy_density - magnetic_field_squared) /
       rest_mass_density_times_lorentz_factor;
-  const auto f_of_x =
-      FunctionOfX<ThermodynamicDim>{total_energy_density,
-                                    momentum_density_squared,
-                                    momentum_density_dot_magnetic_field,
-                                    magnetic_field_squared,
-                                    rest_mass_density_times_lorentz_factor,
-                                    equation_of_state};
+  const auto f_of_x = FunctionOfX<ThermodynamicDim, double>{
+      total_energy_density,
+      momentum_density_squared,
+      momentum_density_dot_magnetic_field,
+      magnetic_field_squared,
+      rest_mass_density_times_lorentz_factor,
+      equation_of_state};
 
   const double specific_enthalpy_times_lorentz_factor =
       // NOLINTNEXTLINE(clang-analyzer-core)
@@ -130,24 +150,56 @@ boost::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
       rest_mass_density_times_lorentz_factor / lorentz_factor;
   const double specific_internal_energy = f_of_x.specific_internal_energy(
       specific_enthalpy_times_lorentz_factor, lorentz_factor);
-  const double pressure = get(make_overloader(
-      [&rest_mass_density](const EquationsOfState::EquationOfState<true, 1>&
-                               the_equation_of_state) noexcept {
-        return the_equation_of_state.pressure_from_density(
-            Scalar<double>(rest_mass_density));
-      },
-      [&rest_mass_density, &specific_internal_energy ](
-          const EquationsOfState::EquationOfState<true, 2>&
-              the_equation_of_state) noexcept {
-        return the_equation_of_state.pressure_from_density_and_energy(
-            Scalar<double>(rest_mass_density),
-            Scalar<double>(specific_internal_energy));
-      })(equation_of_state));
+  const double pressure =
+      f_of_x.pressure(rest_mass_density, specific_internal_energy);
 
   return PrimitiveRecoveryData{rest_mass_density, lorentz_factor, pressure,
                                specific_enthalpy_times_lorentz_factor *
                                    rest_mass_density_times_lorentz_factor};
 }
+
+template <size_t ThermodynamicDim>
+void PalenzuelaEtAl::apply(
+    const gsl::not_null<BatchedPrimitiveRecoveryData*> primitive_data,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  primitive_data->initialize(total_energy_density.size());
+  const DataVector lower_bound =
+      (total_energy_density - magnetic_field_squared) /
+      rest_mass_density_times_lorentz_factor;
+  const DataVector upper_bound =
+      (2.0 * total_energy_density - magnetic_field_squared) /
+      rest_mass_density_times_lorentz_factor;
+  const auto f_of_x = FunctionOfX<ThermodynamicDim, DataVector>{
+      total_energy_density,
+      momentum_density_squared,
+      momentum_density_dot_magnetic_field,
+      magnetic_field_squared,
+      rest_mass_density_times_lorentz_factor,
+      equation_of_state};
+
+  // The root is found at all points simultaneously, so the equation of state
+  // is evaluated for all points at once.
+  const DataVector specific_enthalpy_times_lorentz_factor =
+      RootFinder::toms748(f_of_x, lower_bound, upper_bound, absolute_tolerance_,
+                          relative_tolerance_, max_iterations_);
+  primitive_data->lorentz_factor =
+      f_of_x.lorentz_factor(specific_enthalpy_times_lorentz_factor);
+  primitive_data->rest_mass_density =
+      rest_mass_density_times_lorentz_factor / primitive_data->lorentz_factor;
+  primitive_data->pressure = f_of_x.pressure(
+      primitive_data->rest_mass_density,
+      f_of_x.specific_internal_energy(specific_enthalpy_times_lorentz_factor,
+                                      primitive_data->lorentz_factor));
+  primitive_data->rho_h_w_squared = specific_enthalpy_times_lorentz_factor *
+                                    rest_mass_density_times_lorentz_factor;
+  primitive_data->recovered.assign(total_energy_density.size(), true);
+}
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -166,8 +218,25 @@ boost::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&          \
           equation_of_state) noexcept;
 
+#define BATCHED_INSTANTIATION(_, data)                                  \
+  template void grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::      \
+      PalenzuelaEtAl::apply<THERMODIM(data)>(                            \
+          const gsl::not_null<grmhd::ValenciaDivClean::                  \
+                                  PrimitiveRecoverySchemes::             \
+                                      BatchedPrimitiveRecoveryData*>     \
+              primitive_data,                                            \
+          const DataVector& total_energy_density,                        \
+          const DataVector& momentum_density_squared,                    \
+          const DataVector& momentum_density_dot_magnetic_field,         \
+          const DataVector& magnetic_field_squared,                      \
+          const DataVector& rest_mass_density_times_lorentz_factor,      \
+          const EquationsOfState::EquationOfState<true, THERMODIM(data)>& \
+              equation_of_state) noexcept;
+
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
+GENERATE_INSTANTIATIONS(BATCHED_INSTANTIATION, (1, 2))
 
+#undef BATCHED_INSTANTIATION
 #undef INSTANTIATION
 #undef THERMODIM
 /// \endcond
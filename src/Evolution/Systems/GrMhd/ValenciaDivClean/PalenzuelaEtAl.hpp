@@ -10,6 +10,14 @@
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd {
@@ -17,6 +25,7 @@ namespace ValenciaDivClean {
 namespace PrimitiveRecoverySchemes {
 
 /// \cond
+struct BatchedPrimitiveRecoveryData;
 struct PrimitiveRecoveryData;
 /// \endcond
 
@@ -58,6 +67,19 @@ class PalenzuelaEtAl {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) noexcept;
 
+  /// Recover the primitive variables at all points of a batch.  Points at
+  /// which the scheme fails are marked as not recovered in `primitive_data`.
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<BatchedPrimitiveRecoveryData*> primitive_data,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
   static const std::string name() noexcept { return "PalenzuelaEtAl"; }
 
  private:
@@ -3,11 +3,12 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
-#include <boost/none.hpp>
-#include <boost/optional/optional.hpp>
+#include <cstddef>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <ostream>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
@@ -76,60 +77,89 @@ void PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   const DataVector rest_mass_density_times_lorentz_factor =
       get(tilde_d) / get(sqrt_det_spatial_metric);
 
-  for (size_t s = 0; s < total_energy_density.size(); ++s) {
-    boost::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
-        primitive_data = boost::none;
-    tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>(
-        [&primitive_data, &total_energy_density, &momentum_density_squared,
-         &momentum_density_dot_magnetic_field, &magnetic_field_squared,
-         &rest_mass_density_times_lorentz_factor,
-         &equation_of_state, &s](auto scheme) noexcept {
-          using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
-          if (not primitive_data) {
-            primitive_data =
-                primitive_recovery_scheme::template apply<ThermodynamicDim>(
-                    total_energy_density[s], momentum_density_squared[s],
-                    momentum_density_dot_magnetic_field[s],
-                    magnetic_field_squared[s],
-                    rest_mass_density_times_lorentz_factor[s],
-                    equation_of_state);
-          }
-        });
+  // Each scheme is applied to all points at once.  The points at which a
+  // scheme fails are gathered and passed on to the next scheme.
+  const size_t number_of_points = total_energy_density.size();
+  DataVector rho_h_w_squared(number_of_points);
+  std::vector<size_t> remaining_points(number_of_points);
+  std::iota(remaining_points.begin(), remaining_points.end(), 0);
+  PrimitiveRecoverySchemes::BatchedPrimitiveRecoveryData primitive_data{};
+  tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>([
+    &remaining_points, &primitive_data, &rest_mass_density, &lorentz_factor,
+    &pressure, &rho_h_w_squared, &total_energy_density,
+    &momentum_density_squared, &momentum_density_dot_magnetic_field,
+    &magnetic_field_squared, &rest_mass_density_times_lorentz_factor,
+    &equation_of_state, &number_of_points
+  ](auto scheme) noexcept {
+    using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
+    if (remaining_points.empty()) {
+      return;
+    }
+    if (remaining_points.size() == number_of_points) {
+      primitive_recovery_scheme::template apply<ThermodynamicDim>(
+          make_not_null(&primitive_data), total_energy_density,
+          momentum_density_squared, momentum_density_dot_magnetic_field,
+          magnetic_field_squared, rest_mass_density_times_lorentz_factor,
+          equation_of_state);
+    } else {
+      const auto gather = [&remaining_points](const DataVector& v) noexcept {
+        DataVector result(remaining_points.size());
+        for (size_t i = 0; i < remaining_points.size(); ++i) {
+          result[i] = v[remaining_points[i]];
+        }
+        return result;
+      };
+      primitive_recovery_scheme::template apply<ThermodynamicDim>(
+          make_not_null(&primitive_data), gather(total_energy_density),
+          gather(momentum_density_squared),
+          gather(momentum_density_dot_magnetic_field),
+          gather(magnetic_field_squared),
+          gather(rest_mass_density_times_lorentz_factor), equation_of_state);
+    }
 
-    if (primitive_data) {
-      get(*rest_mass_density)[s] = primitive_data.get().rest_mass_density;
-      const double coefficient_of_b =
-          momentum_density_dot_magnetic_field[s] /
-          (primitive_data.get().rho_h_w_squared *
-           (primitive_data.get().rho_h_w_squared + magnetic_field_squared[s]));
-      const double coefficient_of_s =
-          1.0 /
-          (get(sqrt_det_spatial_metric)[s] *
-           (primitive_data.get().rho_h_w_squared + magnetic_field_squared[s]));
-      for (size_t i = 0; i < 3; ++i) {
-        spatial_velocity->get(i)[s] =
-            coefficient_of_b * magnetic_field->get(i)[s] +
-            coefficient_of_s * tilde_s_upper.get(i)[s];
+    size_t number_of_failed_points = 0;
+    for (size_t i = 0; i < remaining_points.size(); ++i) {
+      const size_t s = remaining_points[i];
+      if (primitive_data.recovered[i]) {
+        get(*rest_mass_density)[s] = primitive_data.rest_mass_density[i];
+        get(*lorentz_factor)[s] = primitive_data.lorentz_factor[i];
+        get(*pressure)[s] = primitive_data.pressure[i];
+        rho_h_w_squared[s] = primitive_data.rho_h_w_squared[i];
+      } else {
+        remaining_points[number_of_failed_points++] = s;
       }
-      get(*lorentz_factor)[s] = primitive_data.get().lorentz_factor;
-      get(*pressure)[s] = primitive_data.get().pressure;
-    } else {
-      ERROR("All primitive inversion schemes failed at s = "
-            << s << ".\n"
-            << std::setprecision(std::numeric_limits<double>::digits10 + 1)
-            << "total_energy_density = " << total_energy_density[s] << "\n"
-            << "momentum_density_squared = " << momentum_density_squared[s]
-            << "\n"
-            << "momentum_density_dot_magnetic_field = "
-            << momentum_density_dot_magnetic_field[s] << "\n"
-            << "magnetic_field_squared = " << magnetic_field_squared[s] << "\n"
-            << "rest_mass_density_times_lorentz_factor = "
-            << rest_mass_density_times_lorentz_factor[s] << "\n"
-            << "previous_rest_mass_density = " << get(*rest_mass_density)[s]
-            << "\n"
-            << "previous_pressure = " << get(*pressure)[s] << "\n"
-            << "previous_lorentz_factor = " << get(*lorentz_factor)[s] << "\n");
     }
+    remaining_points.resize(number_of_failed_points);
+  });
+
+  if (UNLIKELY(not remaining_points.empty())) {
+    const size_t s = remaining_points.front();
+    ERROR("All primitive inversion schemes failed at s = "
+          << s << ".\n"
+          << std::setprecision(std::numeric_limits<double>::digits10 + 1)
+          << "total_energy_density = " << total_energy_density[s] << "\n"
+          << "momentum_density_squared = " << momentum_density_squared[s]
+          << "\n"
+          << "momentum_density_dot_magnetic_field = "
+          << momentum_density_dot_magnetic_field[s] << "\n"
+          << "magnetic_field_squared = " << magnetic_field_squared[s] << "\n"
+          << "rest_mass_density_times_lorentz_factor = "
+          << rest_mass_density_times_lorentz_factor[s] << "\n"
+          << "previous_rest_mass_density = " << get(*rest_mass_density)[s]
+          << "\n"
+          << "previous_pressure = " << get(*pressure)[s] << "\n"
+          << "previous_lorentz_factor = " << get(*lorentz_factor)[s] << "\n");
+  }
+
+  const DataVector coefficient_of_b =
+      momentum_density_dot_magnetic_field /
+      (rho_h_w_squared * (rho_h_w_squared + magnetic_field_squared));
+  const DataVector coefficient_of_s =
+      1.0 / (get(sqrt_det_spatial_metric) *
+             (rho_h_w_squared + magnetic_field_squared));
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_velocity->get(i) = coefficient_of_b * magnetic_field->get(i) +
+                               coefficient_of_s * tilde_s_upper.get(i);
   }
   *specific_internal_energy = make_overloader(
       [&rest_mass_density](const EquationsOfState::EquationOfState<true, 1>&
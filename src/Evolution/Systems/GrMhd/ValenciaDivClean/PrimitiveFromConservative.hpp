@@ -40,6 +40,11 @@ namespace ValenciaDivClean {
  * [Siegel {\em et al}, The Astrophysical Journal 859:71(2018)]
  * (http://iopscience.iop.org/article/10.3847/1538-4357/aabcc5/meta)
  * compares several inversion methods.
+ *
+ * The schemes in `OrderedListOfPrimitiveRecoverySchemes` are tried in order.
+ * Each scheme is applied to a batch of grid points at once, and only the
+ * points at which it fails are passed on to the next scheme.  It is an error
+ * if all schemes fail at any point.
  */
 template <typename OrderedListOfPrimitiveRecoverySchemes,
           size_t ThermodynamicDim>
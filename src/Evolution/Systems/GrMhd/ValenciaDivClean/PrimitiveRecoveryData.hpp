@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+
 namespace grmhd {
 namespace ValenciaDivClean {
 
@@ -22,6 +27,34 @@ struct PrimitiveRecoveryData {
   double pressure;
   double rho_h_w_squared;
 };
+
+/*!
+ * \brief Data determined by PrimitiveRecoverySchemes for a batch of grid
+ * points.
+ *
+ * The members other than `recovered` hold the values of the members of
+ * PrimitiveRecoveryData at each point.  `recovered[s]` is `true` if the scheme
+ * succeeded at point `s`; otherwise the other members are unspecified at `s`.
+ */
+struct BatchedPrimitiveRecoveryData {
+  /// Sets the number of points to `number_of_points` and marks all points as
+  /// not recovered.
+  void initialize(const size_t number_of_points) noexcept {
+    if (rest_mass_density.size() != number_of_points) {
+      rest_mass_density = DataVector(number_of_points);
+      lorentz_factor = DataVector(number_of_points);
+      pressure = DataVector(number_of_points);
+      rho_h_w_squared = DataVector(number_of_points);
+    }
+    recovered.assign(number_of_points, false);
+  }
+
+  DataVector rest_mass_density{};
+  DataVector lorentz_factor{};
+  DataVector pressure{};
+  DataVector rho_h_w_squared{};
+  std::vector<bool> recovered{};
+};
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
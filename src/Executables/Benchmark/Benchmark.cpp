@@ -1,23 +1,41 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <array>
 #include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/IdPair.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainHelpers.hpp"
 #include "Domain/Element.hpp"
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/Mesh.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
+#include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ScratchArena.hpp"
+#include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
@@ -103,6 +121,276 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
 BENCHMARK(bench_all_gradient);
 }  // namespace
 
+namespace {
+// In this anonymous namespace is a comparison of differentiating the GH
+// variables of many low-resolution 3D elements one element at a time with
+// differentiating them all in one batch.  The number of points per dimension
+// is given by the benchmark argument.
+
+constexpr size_t batched_number_of_elements = 64;
+
+// clang-tidy: don't pass be non-const reference
+void bench_gradient_per_element(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  using DerivVars = Variables<
+      db::wrap_tags_in<Tags::deriv, VarTags, tmpl::size_t<Dim>, Frame::Grid>>;
+  using InvJac = InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Grid>;
+  const Mesh<Dim> mesh{static_cast<size_t>(state.range(0)),
+                       Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const size_t n = mesh.number_of_grid_points();
+  const std::vector<Variables<VarTags>> vars(batched_number_of_elements,
+                                             Variables<VarTags>(n, 0.1));
+  const std::vector<InvJac> inv_jacs(batched_number_of_elements,
+                                     InvJac(n, 1.0));
+  std::vector<DerivVars> du(batched_number_of_elements, DerivVars(n));
+
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < batched_number_of_elements; ++i) {
+      partial_derivatives<VarTags>(make_not_null(&du[i]), vars[i], mesh,
+                                   inv_jacs[i]);
+    }
+    benchmark::DoNotOptimize(du.front().data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_gradient_per_element)->DenseRange(2, 8, 1);
+
+// clang-tidy: don't pass be non-const reference
+void bench_gradient_batched(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  using DerivVars = Variables<
+      db::wrap_tags_in<Tags::deriv, VarTags, tmpl::size_t<Dim>, Frame::Grid>>;
+  using InvJac = InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Grid>;
+  const Mesh<Dim> mesh{static_cast<size_t>(state.range(0)),
+                       Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const size_t n = mesh.number_of_grid_points();
+  const std::vector<Variables<VarTags>> vars(batched_number_of_elements,
+                                             Variables<VarTags>(n, 0.1));
+  const std::vector<InvJac> inv_jacs(batched_number_of_elements,
+                                     InvJac(n, 1.0));
+  std::vector<DerivVars> du(batched_number_of_elements, DerivVars(n));
+
+  std::vector<gsl::not_null<DerivVars*>> du_pointers{};
+  std::vector<std::reference_wrapper<const Variables<VarTags>>> vars_refs{};
+  std::vector<std::reference_wrapper<const InvJac>> inv_jac_refs{};
+  for (size_t i = 0; i < batched_number_of_elements; ++i) {
+    du_pointers.emplace_back(&du[i]);
+    vars_refs.emplace_back(vars[i]);
+    inv_jac_refs.emplace_back(inv_jacs[i]);
+  }
+
+  while (state.KeepRunning()) {
+    batched_partial_derivatives<VarTags>(du_pointers, vars_refs, mesh,
+                                         inv_jac_refs);
+    benchmark::DoNotOptimize(du.front().data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_gradient_batched)->DenseRange(2, 8, 1);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a comparison of the sum-factorization
+// kernel used by apply_matrices at low resolution with the BLAS and
+// transpose implementation used at high resolution.  Both apply a
+// differentiation matrix in each dimension of a 3D mesh with the number
+// of points per dimension given by the benchmark argument.
+
+std::array<Matrix, 3> differentiation_matrices(const Mesh<3>& mesh) noexcept {
+  std::array<Matrix, 3> matrices{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(matrices, d) =
+        Spectral::differentiation_matrix(mesh.slice_through(d));
+  }
+  return matrices;
+}
+
+constexpr size_t apply_matrices_number_of_components = 50;
+
+// clang-tidy: don't pass be non-const reference
+void bench_apply_matrices_blas(benchmark::State& state) {  // NOLINT
+  const Mesh<3> mesh{static_cast<size_t>(state.range(0)),
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto matrices = differentiation_matrices(mesh);
+  const DataVector data(
+      apply_matrices_number_of_components * mesh.number_of_grid_points(), 1.0);
+  DataVector result(data.size());
+  while (state.KeepRunning()) {
+    apply_matrices_detail::Impl<3>::apply(
+        result.data(), matrices, data.data(), mesh.extents(),
+        apply_matrices_number_of_components);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_apply_matrices_blas)->DenseRange(2, 16, 2);
+
+// clang-tidy: don't pass be non-const reference
+void bench_apply_matrices_sum_factorized(benchmark::State& state) {  // NOLINT
+  const Mesh<3> mesh{static_cast<size_t>(state.range(0)),
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto matrices = differentiation_matrices(mesh);
+  const DataVector data(
+      apply_matrices_number_of_components * mesh.number_of_grid_points(), 1.0);
+  DataVector result(data.size());
+  while (state.KeepRunning()) {
+    apply_matrices_detail::sum_factorized_apply(
+        result.data(), matrices, data.data(), mesh.extents(),
+        apply_matrices_number_of_components);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_apply_matrices_sum_factorized)->DenseRange(2, 16, 2);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a benchmark of the right hand side of the
+// Generalized Harmonic system, with the number of points per dimension of a
+// 3D element given by the benchmark argument.  The input tensors only need to
+// hold finite values, so they are filled with a constant.
+
+// clang-tidy: don't pass be non-const reference
+void bench_gh_rhs(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const size_t pts_1d = static_cast<size_t>(state.range(0));
+  const size_t n = pts_1d * pts_1d * pts_1d;
+
+  tnsr::aa<DataVector, Dim> dt_spacetime_metric(n);
+  tnsr::aa<DataVector, Dim> dt_pi(n);
+  tnsr::iaa<DataVector, Dim> dt_phi(n);
+  const tnsr::aa<DataVector, Dim> spacetime_metric(n, 0.1);
+  const tnsr::aa<DataVector, Dim> pi(n, 0.2);
+  const tnsr::iaa<DataVector, Dim> phi(n, 0.3);
+  const tnsr::iaa<DataVector, Dim> d_spacetime_metric(n, 0.4);
+  const tnsr::iaa<DataVector, Dim> d_pi(n, 0.5);
+  const tnsr::ijaa<DataVector, Dim> d_phi(n, 0.6);
+  const Scalar<DataVector> gamma0(n, 1.0);
+  const Scalar<DataVector> gamma1(n, -1.0);
+  const Scalar<DataVector> gamma2(n, 1.0);
+  const tnsr::a<DataVector, Dim> gauge_function(n, 0.7);
+  const tnsr::ab<DataVector, Dim> spacetime_deriv_gauge_function(n, 0.8);
+  const Scalar<DataVector> lapse(n, 1.0);
+  const tnsr::I<DataVector, Dim> shift(n, 0.1);
+  const tnsr::II<DataVector, Dim> inverse_spatial_metric(n, 0.9);
+  const tnsr::AA<DataVector, Dim> inverse_spacetime_metric(n, 1.1);
+  const tnsr::a<DataVector, Dim> trace_christoffel(n, 1.2);
+  const tnsr::abb<DataVector, Dim> christoffel_first_kind(n, 1.3);
+  const tnsr::Abb<DataVector, Dim> christoffel_second_kind(n, 1.4);
+  const tnsr::A<DataVector, Dim> normal_spacetime_vector(n, 1.5);
+  const tnsr::a<DataVector, Dim> normal_spacetime_one_form(n, 1.6);
+
+  // The temporaries are taken from the thread's scratch arena, so after the
+  // first iteration the RHS should not allocate.
+  const auto& arena = ScratchArena::thread_local_instance();
+  const size_t initial_heap_allocations = arena.number_of_heap_allocations();
+  while (state.KeepRunning()) {
+    GeneralizedHarmonic::ComputeDuDt<Dim>::apply(
+        make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
+        make_not_null(&dt_phi), spacetime_metric, pi, phi, d_spacetime_metric,
+        d_pi, d_phi, gamma0, gamma1, gamma2, gauge_function,
+        spacetime_deriv_gauge_function, lapse, shift, inverse_spatial_metric,
+        inverse_spacetime_metric, trace_christoffel, christoffel_first_kind,
+        christoffel_second_kind, normal_spacetime_vector,
+        normal_spacetime_one_form);
+    benchmark::DoNotOptimize(get<0, 0>(dt_pi).data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+  state.counters["ScratchArenaHeapAllocations"] = static_cast<double>(
+      arena.number_of_heap_allocations() - initial_heap_allocations);
+}
+BENCHMARK(bench_gh_rhs)->DenseRange(4, 12, 2);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a benchmark of locating points in a 3D
+// domain of N x N x N cubical blocks, with N given by the benchmark argument.
+// Candidate blocks are found with the domain's BlockSearchTree, so the cost
+// per point should stay nearly constant as the number of blocks grows instead
+// of growing linearly with it.
+
+constexpr size_t block_logical_coordinates_number_of_points = 1000;
+
+// clang-tidy: don't pass be non-const reference
+void bench_block_logical_coordinates(benchmark::State& state) {  // NOLINT
+  const size_t blocks_per_dim = static_cast<size_t>(state.range(0));
+  std::vector<double> demarcations(blocks_per_dim + 1);
+  for (size_t i = 0; i <= blocks_per_dim; ++i) {
+    demarcations[i] = static_cast<double>(i);
+  }
+  const Index<3> domain_extents{blocks_per_dim};
+  const Domain<3, Frame::Inertial> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          domain_extents, std::array<std::vector<double>, 3>{
+                              {demarcations, demarcations, demarcations}}),
+      corners_for_rectilinear_domains(domain_extents));
+
+  std::uniform_real_distribution<double> dist(
+      0.0, static_cast<double>(blocks_per_dim));
+  std::mt19937 gen;
+  tnsr::I<DataVector, 3, Frame::Inertial> points(
+      block_logical_coordinates_number_of_points);
+  for (size_t d = 0; d < 3; ++d) {
+    for (auto& point : points.get(d)) {
+      point = dist(gen);
+    }
+  }
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(block_logical_coordinates(domain, points));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(
+      state.iterations() * block_logical_coordinates_number_of_points));
+}
+BENCHMARK(bench_block_logical_coordinates)->DenseRange(1, 5, 1);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a benchmark of evaluating the Kerr-Schild
+// solution at the points of a 3D element with the number of points per
+// dimension given by the benchmark argument. The quantities shared by the
+// variables are computed once per call, so the cost of requesting only the
+// lapse, shift and spatial metric (as the Fishbone-Moncrief disk does) should
+// be well below that of requesting all variables.
+
+using kerr_schild_metric_tags =
+    tmpl::list<gr::Tags::Lapse<DataVector>,
+               gr::Tags::Shift<3, Frame::Inertial, DataVector>,
+               gr::Tags::SpatialMetric<3, Frame::Inertial, DataVector>>;
+
+// clang-tidy: don't pass be non-const reference
+template <typename Tags>
+void bench_kerr_schild_variables(benchmark::State& state) {  // NOLINT
+  const size_t pts_1d = static_cast<size_t>(state.range(0));
+  const size_t n = pts_1d * pts_1d * pts_1d;
+  const gr::Solutions::KerrSchild solution(1.2, {{0.1, 0.2, 0.3}},
+                                           {{0.0, 0.0, 0.0}});
+  tnsr::I<DataVector, 3> x(n);
+  for (size_t s = 0; s < n; ++s) {
+    get<0>(x)[s] = 2.0 + static_cast<double>(s % pts_1d);
+    get<1>(x)[s] = 3.0 + static_cast<double>((s / pts_1d) % pts_1d);
+    get<2>(x)[s] = 4.0 + static_cast<double>(s / (pts_1d * pts_1d));
+  }
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(solution.variables(x, 0.0, Tags{}));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK_TEMPLATE(bench_kerr_schild_variables,
+                   gr::Solutions::KerrSchild::tags<DataVector>)
+    ->DenseRange(4, 12, 4);
+BENCHMARK_TEMPLATE(bench_kerr_schild_variables, kerr_schild_metric_tags)
+    ->DenseRange(4, 12, 4);
+}  // namespace
+
 BENCHMARK_MAIN()
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
@@ -63,11 +63,13 @@ struct HelloWorld {
 
 template <class Metavariables>
 void HelloWorld<Metavariables>::execute_next_phase(
-    const typename Metavariables::Phase /* next_phase */,
+    const typename Metavariables::Phase next_phase,
     Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
-  Parallel::simple_action<Actions::PrintMessage>(
-      Parallel::get_parallel_component<HelloWorld>(
-          *(global_cache.ckLocalBranch())));
+  if (next_phase == Metavariables::Phase::Execute) {
+    Parallel::simple_action<Actions::PrintMessage>(
+        Parallel::get_parallel_component<HelloWorld>(
+            *(global_cache.ckLocalBranch())));
+  }
 }
 /// [executable_example_singleton]
 
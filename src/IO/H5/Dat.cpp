@@ -156,16 +156,15 @@ void Dat::append(const std::vector<std::vector<double>>& data) {
   }
   const std::vector<double> contiguous_data =
       [](const std::vector<std::vector<double>>& ldata) {
-        std::vector<double> result(ldata.size() * ldata[0].size());
+        std::vector<double> result{};
+        result.reserve(ldata.size() * ldata[0].size());
         for (size_t i = 0; i < ldata.size(); ++i) {
           if (ldata[i].size() != ldata[0].size()) {
             ERROR(
                 "Each member of the vector<vector<double>> must be of the same "
                 "size, ie the number of columns must be the same.");
           }
-          result.insert(
-              result.begin() + static_cast<std::ptrdiff_t>(i * ldata[i].size()),
-              ldata[i].begin(), ldata[i].end());
+          result.insert(result.end(), ldata[i].begin(), ldata[i].end());
         }
         return result;
       }(data);
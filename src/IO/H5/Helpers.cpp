@@ -9,6 +9,7 @@
 #include <string>
 #include <type_traits>
 
+#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
@@ -59,6 +60,43 @@ void write_data(const hid_t group_id, const DataVector& data,
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
 
+template <typename T>
+void write_chunked_data(const hid_t group_id, const T* const data,
+                        const size_t size, const std::string& name,
+                        const size_t chunk_size,
+                        const int compression_level) noexcept {
+  ASSERT(chunk_size > 0, "The chunk size must be positive.");
+  ASSERT(compression_level >= 0 and compression_level <= 9,
+         "The compression level must be between 0 and 9, not "
+             << compression_level);
+  const hsize_t dims = size;
+  const hid_t space_id = H5Screate_simple(1, &dims, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list, "Failed to create property list");
+  // HDF5 does not allow chunks larger than the dataset or of zero size.
+  const hsize_t chunk_dims = std::max(std::min(chunk_size, size), size_t{1});
+  CHECK_H5(H5Pset_chunk(property_list, 1, &chunk_dims),
+           "Failed to set chunk size");
+  if (compression_level > 0 and H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+    CHECK_H5(H5Pset_deflate(property_list,
+                            static_cast<unsigned>(compression_level)),
+             "Failed to set compression level");
+  }
+  const hid_t dataset_id =
+      H5Dcreate2(group_id, name.c_str(), h5_type<T>(), space_id, h5p_default(),
+                 property_list, h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset '" << name << "'");
+  if (size > 0) {
+    CHECK_H5(H5Dwrite(dataset_id, h5_type<T>(), h5s_all(), h5s_all(),
+                      h5p_default(), static_cast<const void*>(data)),
+             "Failed to write data to dataset '" << name << "'");
+  }
+  CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
 template <size_t Dim>
 void write_extents(const hid_t group_id, const Index<Dim>& extents,
                    const std::string& name) {
@@ -359,6 +397,52 @@ DataVector read_data(const hid_t group_id, const std::string& dataset_name) {
   return data;
 }
 
+DataVector read_data(const hid_t group_id, const std::string& dataset_name,
+                     const size_t offset, const size_t size) noexcept {
+  const hid_t dataset_id =
+      H5Dopen2(group_id, dataset_name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "could not open dataset '" << dataset_name << "'");
+  const hid_t space_id = H5Dget_space(dataset_id);
+  CHECK_H5(space_id, "Failed to open dataspace");
+  const hsize_t start = offset;
+  const hsize_t count = size;
+  CHECK_H5(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, &start, nullptr,
+                               &count, nullptr),
+           "Failed to select " << size << " points starting at " << offset
+                               << " in dataset '" << dataset_name << "'");
+  const hid_t memspace_id = H5Screate_simple(1, &count, nullptr);
+  CHECK_H5(memspace_id, "Failed to create memory space");
+  DataVector data(size);
+  CHECK_H5(H5Dread(dataset_id, h5_type<double>(), memspace_id, space_id,
+                   h5p_default(), static_cast<void*>(data.data())),
+           "Failed to read data");
+  CHECK_H5(H5Sclose(memspace_id), "Failed to close memory space");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return data;
+}
+
+template <typename T>
+std::vector<T> read_rank1_data(const hid_t group_id,
+                               const std::string& dataset_name) noexcept {
+  const hid_t dataset_id =
+      H5Dopen2(group_id, dataset_name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "could not open dataset '" << dataset_name << "'");
+  const hid_t space_id = H5Dget_space(dataset_id);
+  CHECK_H5(space_id, "Failed to open dataspace");
+  const hssize_t number_of_points = H5Sget_simple_extent_npoints(space_id);
+  CHECK_H5(number_of_points, "Failed to get number of points");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  std::vector<T> data(static_cast<size_t>(number_of_points));
+  if (not data.empty()) {
+    CHECK_H5(H5Dread(dataset_id, h5_type<T>(), h5s_all(), h5s_all(),
+                     h5p_default(), static_cast<void*>(data.data())),
+             "Failed to read data");
+  }
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return data;
+}
+
 template <size_t Dim>
 Index<Dim> read_extents(const hid_t group_id, const std::string& extents_name) {
   const hid_t attr_id = H5Aopen(group_id, extents_name.c_str(), h5p_default());
@@ -410,6 +494,19 @@ template Index<3> read_extents<3>(const hid_t group_id,
 GENERATE_INSTANTIATIONS(INSTANTIATE, (double, unsigned int, unsigned long, int))
 
 #undef INSTANTIATE
+
+#define INSTANTIATE_DATASETS(_, DATA)                                      \
+  template void write_chunked_data<TYPE(DATA)>(                            \
+      const hid_t group_id, const TYPE(DATA) * const data,                 \
+      const size_t size, const std::string& name, const size_t chunk_size, \
+      const int compression_level) noexcept;                               \
+  template std::vector<TYPE(DATA)> read_rank1_data<TYPE(DATA)>(            \
+      const hid_t group_id, const std::string& dataset_name) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_DATASETS,
+                        (double, char, unsigned long, int))
+
+#undef INSTANTIATE_DATASETS
 #undef TYPE
 }  // namespace h5
 
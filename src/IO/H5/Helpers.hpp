@@ -32,6 +32,21 @@ void write_data(hid_t group_id, const DataVector& data,
                 const std::vector<size_t>& extents,
                 const std::string& name = "scalar") noexcept;
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the `size` elements at `data` as a rank-1 dataset named `name`
+ * to the group `group_id`.
+ *
+ * The dataset is split into chunks of at most `chunk_size` elements, which are
+ * compressed with the deflate filter if `compression_level` is between 1 and 9.
+ * Compression is skipped if `compression_level` is 0 or the HDF5 library was
+ * built without the deflate filter.
+ */
+template <typename T>
+void write_chunked_data(hid_t group_id, const T* data, size_t size,
+                        const std::string& name, size_t chunk_size,
+                        int compression_level) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief Write the extents as an attribute named `name` to the group
@@ -117,6 +132,22 @@ bool contains_attribute(hid_t file_id, const std::string& group_name,
  */
 DataVector read_data(hid_t group_id, const std::string& dataset_name);
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Read `size` elements starting at `offset` from a rank-1 dataset in
+ * a group
+ */
+DataVector read_data(hid_t group_id, const std::string& dataset_name,
+                     size_t offset, size_t size) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Read a rank-1 dataset of type `T` from a group
+ */
+template <typename T>
+std::vector<T> read_rank1_data(hid_t group_id,
+                               const std::string& dataset_name) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief Read the HDF5 attribute representing extents from a group
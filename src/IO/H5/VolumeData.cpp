@@ -5,9 +5,13 @@
 
 #include <algorithm>
 #include <boost/iterator/transform_iterator.hpp>
+#include <functional>
 #include <hdf5.h>
+#include <iterator>
 #include <memory>
+#include <numeric>
 #include <ostream>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -20,10 +24,83 @@
 #include "IO/H5/Version.hpp"
 
 /// \cond HIDDEN_SYMBOLS
+namespace {
+std::string observation_group_name(const size_t observation_id) noexcept {
+  return "ObservationId" + std::to_string(observation_id);
+}
+
+std::string grid_name_of(const TensorComponent& tensor_component) noexcept {
+  ASSERT(tensor_component.name.find_last_of('/') != std::string::npos,
+         "The expected format of the tensor component names is "
+         "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
+             << tensor_component.name << "'.");
+  return tensor_component.name.substr(
+      0, tensor_component.name.find_last_of('/'));
+}
+
+std::string component_name_of(
+    const TensorComponent& tensor_component) noexcept {
+  ASSERT(tensor_component.name.find_last_of('/') != std::string::npos,
+         "The expected format of the tensor component names is "
+         "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
+             << tensor_component.name << "'.");
+  return tensor_component.name.substr(tensor_component.name.find_last_of('/') +
+                                      1);
+}
+
+// The datasets in an observation group of the contiguous layout that are not
+// tensor components.
+bool is_contiguous_index(const std::string& name) noexcept {
+  return name == "grid_names" or name == "grid_extents" or
+         name == "grid_offsets" or name == "connectivity";
+}
+
+// The grid names are stored as a single array of characters with each name
+// terminated by a '\0'.
+std::vector<std::string> read_grid_names(
+    const hid_t observation_group_id) noexcept {
+  const auto characters =
+      h5::read_rank1_data<char>(observation_group_id, "grid_names");
+  std::vector<std::string> grid_names{};
+  auto name_begin = characters.begin();
+  for (auto it = characters.begin(); it != characters.end(); ++it) {
+    if (*it == '\0') {
+      grid_names.emplace_back(name_begin, it);
+      name_begin = it + 1;
+    }
+  }
+  return grid_names;
+}
+
+// Returns the offset into the concatenated data and the extents of the grid
+// `grid_name` stored with the contiguous layout.
+std::pair<size_t, std::vector<size_t>> read_grid_offset_and_extents(
+    const hid_t observation_group_id, const std::string& grid_name) noexcept {
+  const auto grid_names = read_grid_names(observation_group_id);
+  const auto grid_it =
+      std::find(grid_names.begin(), grid_names.end(), grid_name);
+  if (grid_it == grid_names.end()) {
+    ERROR("Could not find the grid '" << grid_name << "'.");
+  }
+  const auto grid_index =
+      static_cast<size_t>(std::distance(grid_names.begin(), grid_it));
+  const auto grid_extents =
+      h5::read_rank1_data<size_t>(observation_group_id, "grid_extents");
+  const size_t dim = grid_extents.size() / grid_names.size();
+  const auto grid_offsets =
+      h5::read_rank1_data<size_t>(observation_group_id, "grid_offsets");
+  return {grid_offsets[grid_index],
+          {grid_extents.begin() + static_cast<std::ptrdiff_t>(grid_index * dim),
+           grid_extents.begin() +
+               static_cast<std::ptrdiff_t>((grid_index + 1) * dim)}};
+}
+}  // namespace
+
 namespace h5 {
 VolumeData::VolumeData(const bool exists, detail::OpenGroup&& group,
                        const hid_t /*location*/, const std::string& name,
-                       const uint32_t version) noexcept
+                       const uint32_t version, const Layout layout,
+                       const int compression_level) noexcept
     : group_(std::move(group)),
       name_(name.size() > extension().size()
                 ? (extension() == name.substr(name.size() - extension().size())
@@ -31,7 +108,12 @@ VolumeData::VolumeData(const bool exists, detail::OpenGroup&& group,
                        : name + extension())
                 : name + extension()),
       version_(version),
+      layout_(layout),
+      compression_level_(compression_level),
       volume_file_root_group_(group_.id(), name_, h5::AccessType::ReadWrite) {
+  ASSERT(compression_level_ >= 0 and compression_level_ <= 9,
+         "The compression level must be between 0 and 9, not "
+             << compression_level_);
   if (exists) {
     // We treat this as an internal version for now. We'll need to deal with
     // proper versioning later.
@@ -41,6 +123,12 @@ VolumeData::VolumeData(const bool exists, detail::OpenGroup&& group,
     const Header header(true, detail::OpenGroup{}, volume_file_root_group_.id(),
                         "header");
     header_ = header.get_header();
+    // Subfiles written before the layout was stored use the per-grid layout.
+    layout_ =
+        contains_attribute(volume_file_root_group_.id(), "", "layout")
+            ? static_cast<Layout>(h5::read_value_attribute<unsigned int>(
+                  volume_file_root_group_.id(), "layout"))
+            : Layout::PerGrid;
   } else {  // file does not exist
     {
       Version open_version(false, detail::OpenGroup{},
@@ -51,13 +139,21 @@ VolumeData::VolumeData(const bool exists, detail::OpenGroup&& group,
                     "header");
       header_ = header.get_header();
     }
+    h5::write_to_attribute(volume_file_root_group_.id(), "layout",
+                           static_cast<unsigned int>(layout_));
   }
 }
 
 void VolumeData::insert_tensor_data(
     const size_t observation_id, const double observation_value,
     const ExtentsAndTensorVolumeData& extents_and_tensors) noexcept {
-  const std::string path = "ObservationId" + std::to_string(observation_id);
+  if (layout_ != Layout::PerGrid) {
+    ERROR("Cannot insert the data of a single grid into the volume file '"
+          << name_
+          << "' because it uses the contiguous layout. Use write_volume_data "
+             "to write all grids at an observation instead.");
+  }
+  const std::string path = observation_group_name(observation_id);
   detail::OpenGroup observation_group(volume_file_root_group_.id(), path,
                                       AccessType::ReadWrite);
   if (not contains_attribute(observation_group.id(), "", "observation_value")) {
@@ -117,6 +213,114 @@ void VolumeData::insert_tensor_data(
   }
 }
 
+void VolumeData::write_volume_data(
+    const size_t observation_id, const double observation_value,
+    const std::vector<ExtentsAndTensorVolumeData>& grids) noexcept {
+  if (layout_ == Layout::Contiguous) {
+    write_contiguous(observation_id, observation_value, grids);
+    return;
+  }
+  for (const auto& grid : grids) {
+    insert_tensor_data(observation_id, observation_value, grid);
+  }
+}
+
+void VolumeData::write_contiguous(
+    const size_t observation_id, const double observation_value,
+    const std::vector<ExtentsAndTensorVolumeData>& grids) noexcept {
+  const std::string path = observation_group_name(observation_id);
+  if (h5::contains_dataset_or_group(volume_file_root_group_.id(), "", path)) {
+    ERROR("Trying to write observation '"
+          << path << "' which already exists in HDF5 file in group '" << name_
+          << "'. With the contiguous layout all grids at an observation must "
+             "be written at once.");
+  }
+  detail::OpenGroup observation_group(volume_file_root_group_.id(), path,
+                                      AccessType::ReadWrite);
+  h5::write_to_attribute(observation_group.id(), "observation_value",
+                         observation_value);
+
+  // Build the index of the grids.
+  std::vector<std::string> component_names{};
+  if (not grids.empty()) {
+    for (const auto& tensor_component : grids.front().tensor_components) {
+      component_names.push_back(component_name_of(tensor_component));
+      ASSERT(not is_contiguous_index(component_names.back()),
+             "The tensor component name '"
+                 << component_names.back()
+                 << "' is reserved for the index of the grids.");
+    }
+  }
+  std::vector<char> grid_names{};
+  std::vector<size_t> grid_extents{};
+  std::vector<size_t> grid_offsets{};
+  std::vector<int> connectivity{};
+  size_t number_of_points = 0;
+  for (const auto& grid : grids) {
+    ASSERT(grid.extents.size() == grids.front().extents.size(),
+           "All grids must have the same dimension.");
+    ASSERT(grid.tensor_components.size() == component_names.size(),
+           "All grids must have the same tensor components.");
+    ASSERT(not grid.tensor_components.empty(),
+           "Each grid must have at least one tensor component, which names "
+           "the grid.");
+    const std::string grid_name = grid_name_of(grid.tensor_components.front());
+    grid_names.insert(grid_names.end(), grid_name.begin(), grid_name.end());
+    grid_names.push_back('\0');
+    grid_extents.insert(grid_extents.end(), grid.extents.begin(),
+                        grid.extents.end());
+    grid_offsets.push_back(number_of_points);
+    for (const auto& cell : vis::detail::compute_cells(grid.extents)) {
+      for (const auto& bounding_index : cell.bounding_indices) {
+        connectivity.push_back(
+            static_cast<int>(bounding_index + number_of_points));
+      }
+    }
+    number_of_points += grid.tensor_components.front().data.size();
+  }
+  h5::write_chunked_data(observation_group.id(), grid_names.data(),
+                         grid_names.size(), "grid_names", chunk_size,
+                         compression_level_);
+  h5::write_chunked_data(observation_group.id(), grid_extents.data(),
+                         grid_extents.size(), "grid_extents", chunk_size,
+                         compression_level_);
+  h5::write_chunked_data(observation_group.id(), grid_offsets.data(),
+                         grid_offsets.size(), "grid_offsets", chunk_size,
+                         compression_level_);
+  h5::write_chunked_data(observation_group.id(), connectivity.data(),
+                         connectivity.size(), "connectivity", chunk_size,
+                         compression_level_);
+
+  // Concatenate and write the tensor components one at a time.
+  DataVector buffer(number_of_points);
+  for (size_t component = 0; component < component_names.size();
+       ++component) {
+    size_t offset = 0;
+    for (const auto& grid : grids) {
+      const auto& tensor_component = grid.tensor_components[component];
+      ASSERT(component_name_of(tensor_component) == component_names[component],
+             "All grids must have the same tensor components in the same "
+             "order, but found '"
+                 << tensor_component.name << "' where '"
+                 << component_names[component] << "' was expected.");
+      ASSERT(grid_name_of(tensor_component) ==
+                 grid_name_of(grid.tensor_components.front()),
+             "All tensor components of a grid must have the same grid name, "
+             "but found '"
+                 << tensor_component.name << "'.");
+      ASSERT(tensor_component.data.size() ==
+                 grid.tensor_components.front().data.size(),
+             "All tensor components of a grid must have the same size.");
+      std::copy(tensor_component.data.begin(), tensor_component.data.end(),
+                buffer.begin() + static_cast<std::ptrdiff_t>(offset));
+      offset += tensor_component.data.size();
+    }
+    h5::write_chunked_data(observation_group.id(), buffer.data(),
+                           number_of_points, component_names[component],
+                           chunk_size, compression_level_);
+  }
+}
+
 std::vector<size_t> VolumeData::list_observation_ids() const noexcept {
   const auto names = get_group_names(volume_file_root_group_.id(), "");
   const auto helper = [](const std::string& s) noexcept {
@@ -137,14 +341,29 @@ double VolumeData::get_observation_value(const size_t observation_id) const
 
 std::vector<std::string> VolumeData::list_grids(
     const size_t observation_id) const noexcept {
-  detail::OpenGroup observation_group(
-      volume_file_root_group_.id(),
-      "ObservationId" + std::to_string(observation_id), AccessType::ReadOnly);
+  detail::OpenGroup observation_group(volume_file_root_group_.id(),
+                                      observation_group_name(observation_id),
+                                      AccessType::ReadOnly);
+  if (layout_ == Layout::Contiguous) {
+    return read_grid_names(observation_group.id());
+  }
   return get_group_names(observation_group.id(), "");
 }
 
 std::vector<std::string> VolumeData::list_tensor_components(
     size_t observation_id, const std::string& grid_name) const noexcept {
+  if (layout_ == Layout::Contiguous) {
+    // All grids have the same tensor components.
+    detail::OpenGroup observation_group(volume_file_root_group_.id(),
+                                        observation_group_name(observation_id),
+                                        AccessType::ReadOnly);
+    auto tensor_components = get_group_names(observation_group.id(), "");
+    tensor_components.erase(
+        std::remove_if(tensor_components.begin(), tensor_components.end(),
+                       is_contiguous_index),
+        tensor_components.end());
+    return tensor_components;
+  }
   detail::OpenGroup spatial_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id) + "/" + grid_name,
@@ -159,6 +378,18 @@ std::vector<std::string> VolumeData::list_tensor_components(
 DataVector VolumeData::get_tensor_component(
     size_t observation_id, const std::string& grid_name,
     const std::string& tensor_component) const noexcept {
+  if (layout_ == Layout::Contiguous) {
+    detail::OpenGroup observation_group(volume_file_root_group_.id(),
+                                        observation_group_name(observation_id),
+                                        AccessType::ReadOnly);
+    const auto offset_and_extents =
+        read_grid_offset_and_extents(observation_group.id(), grid_name);
+    const size_t number_of_points = std::accumulate(
+        offset_and_extents.second.begin(), offset_and_extents.second.end(),
+        size_t{1}, std::multiplies<size_t>{});
+    return h5::read_data(observation_group.id(), tensor_component,
+                         offset_and_extents.first, number_of_points);
+  }
   detail::OpenGroup spatial_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id) + "/" + grid_name,
@@ -169,6 +400,13 @@ DataVector VolumeData::get_tensor_component(
 std::vector<size_t> VolumeData::get_extents(size_t observation_id,
                                             const std::string& grid_name) const
     noexcept {
+  if (layout_ == Layout::Contiguous) {
+    detail::OpenGroup observation_group(volume_file_root_group_.id(),
+                                        observation_group_name(observation_id),
+                                        AccessType::ReadOnly);
+    return read_grid_offset_and_extents(observation_group.id(), grid_name)
+        .second;
+  }
   detail::OpenGroup spatial_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id) + "/" + grid_name,
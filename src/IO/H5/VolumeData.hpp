@@ -41,6 +41,25 @@ namespace h5 {
  * in the case of a dG evolution where the spatial IDs are `ElementId`s, the
  * grid names would be of the form `[B0,(L2I3,L2I3,L2I3)]`.
  *
+ * The subfile can store the grids in one of two layouts, chosen with the
+ * `VolumeData::Layout` passed when the subfile is created:
+ * - `Layout::PerGrid` (the default) writes one dataset per grid per tensor
+ *   component, named `ObservationIdN/GRID_NAME/COMPONENT_NAME`. With many
+ *   grids this creates a very large number of tiny datasets, so writing and
+ *   reading are bound by the HDF5 metadata.
+ * - `Layout::Contiguous` concatenates the data of all grids at an observation
+ *   into one chunked and, if a `compression_level` is given, compressed
+ *   dataset per tensor component, named `ObservationIdN/COMPONENT_NAME`. The
+ *   grid names, extents and offsets into the concatenated data are stored in
+ *   the datasets `grid_names`, `grid_extents` and `grid_offsets` of the
+ *   observation group, and the connectivity of all grids in `connectivity`.
+ *   All grids at an observation must be written with a single call to
+ *   `write_volume_data()` and must have the same, non-empty list of tensor
+ *   components, since the grid name is read from the component names.
+ *
+ * The layout is stored in the subfile, and the methods reading data work on
+ * both layouts.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -48,10 +67,22 @@ namespace h5 {
  */
 class VolumeData : public h5::Object {
  public:
+  /// How the grids are stored in the subfile
+  enum class Layout : unsigned int { PerGrid = 0, Contiguous = 1 };
+
   static std::string extension() noexcept { return ".vol"; }
 
+  /// The number of points in each chunk of the datasets written with
+  /// `Layout::Contiguous`
+  static constexpr size_t chunk_size = 65536;
+
+  /// The `layout` and `compression_level` (between 0 and 9, with 0 meaning no
+  /// compression) are only used when the subfile is created. When opening an
+  /// existing subfile its layout is read from the file.
   VolumeData(bool exists, detail::OpenGroup&& group, hid_t location,
-             const std::string& name, uint32_t version = 1) noexcept;
+             const std::string& name, uint32_t version = 1,
+             Layout layout = Layout::PerGrid,
+             int compression_level = 0) noexcept;
 
   VolumeData(const VolumeData& /*rhs*/) = delete;
   VolumeData& operator=(const VolumeData& /*rhs*/) = delete;
@@ -73,15 +104,34 @@ class VolumeData : public h5::Object {
    */
   uint32_t get_version() const noexcept { return version_; }
 
+  /// The layout in which the grids are stored
+  Layout get_layout() const noexcept { return layout_; }
+
   /// Insert tensor components at `observation_id` with floating point value
   /// `observation_value`
   ///
   /// \requires The names of the tensor components is of the form
-  /// `GRID_NAME/TENSOR_NAME_COMPONENT`, e.g. `Element0/T_xx`
+  /// `GRID_NAME/TENSOR_NAME_COMPONENT`, e.g. `Element0/T_xx`, and the subfile
+  /// uses `Layout::PerGrid`.
   void insert_tensor_data(
       size_t observation_id, double observation_value,
       const ExtentsAndTensorVolumeData& extents_and_tensors) noexcept;
 
+  /// Write the tensor components of all `grids` at `observation_id` with
+  /// floating point value `observation_value`
+  ///
+  /// With `Layout::PerGrid` this is equivalent to calling
+  /// `insert_tensor_data()` for each grid.
+  ///
+  /// \requires The names of the tensor components is of the form
+  /// `GRID_NAME/TENSOR_NAME_COMPONENT`, e.g. `Element0/T_xx`. With
+  /// `Layout::Contiguous` no data may have been written at `observation_id`
+  /// yet and all grids must have the same tensor components in the same
+  /// order.
+  void write_volume_data(
+      size_t observation_id, double observation_value,
+      const std::vector<ExtentsAndTensorVolumeData>& grids) noexcept;
+
   /// List all the integral observation ids in the subfile
   std::vector<size_t> list_observation_ids() const noexcept;
 
@@ -111,9 +161,15 @@ class VolumeData : public h5::Object {
                                   const std::string& grid_name) const noexcept;
 
  private:
+  void write_contiguous(
+      size_t observation_id, double observation_value,
+      const std::vector<ExtentsAndTensorVolumeData>& grids) noexcept;
+
   detail::OpenGroup group_{};
   std::string name_{};
   uint32_t version_{};
+  Layout layout_{Layout::PerGrid};
+  int compression_level_{0};
   detail::OpenGroup volume_file_root_group_{};
   std::string header_{};
 };
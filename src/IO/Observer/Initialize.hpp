@@ -9,7 +9,6 @@
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
-#include "Parallel/NodeLock.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -70,7 +69,9 @@ template <class Metavariables>
 struct InitializeWriter {
   using simple_tags = tmpl::append<
       db::AddSimpleTags<Tags::TensorData, Tags::VolumeObserversContributed,
-                        Tags::ReductionObserversContributed, Tags::H5FileLock>,
+                        Tags::ReductionObserversContributed,
+                        Tags::ReductionFileWriter, Tags::VolumeFileWriter,
+                        Tags::ActionProfiles, Tags::ActionProfilesContributed>,
       typename Metavariables::reduction_data_tags,
       tmpl::transform<
           typename Metavariables::reduction_data_tags,
@@ -97,7 +98,10 @@ struct InitializeWriter {
         db::item_type<Tags::TensorData>{},
         db::item_type<Tags::VolumeObserversContributed>{},
         db::item_type<Tags::ReductionObserversContributed>{},
-        Parallel::create_lock(), db::item_type<ReductionTags>{}...,
+        db::item_type<Tags::ReductionFileWriter>{},
+        db::item_type<Tags::VolumeFileWriter>{},
+        db::item_type<Tags::ActionProfiles>{}, size_t{0},
+        db::item_type<ReductionTags>{}...,
         db::item_type<
             detail::reduction_data_to_reduction_names<ReductionTags>>{}...));
   }
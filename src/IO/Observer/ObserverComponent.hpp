@@ -7,11 +7,21 @@
 #include "AlgorithmNodegroup.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ProfilingActions.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "Utilities/Requires.hpp"
 
 namespace observers {
+/// \cond
+namespace ThreadedActions {
+struct FlushReductionData;
+struct FlushVolumeData;
+}  // namespace ThreadedActions
+/// \endcond
+
 /*!
  * \ingroup ObserversGroup
  * \brief The group parallel component that is responsible for reducing data
@@ -20,6 +30,10 @@ namespace observers {
  * Once the data from all elements on the processing element (usually a core)
  * has been collected, it is copied (not sent over the network) to the local
  * nodegroup parallel component, `ObserverWriter`, for writing to disk.
+ *
+ * In the `Exit` phase the profile of the actions executed on each processing
+ * element is written to the reduction file, see
+ * `observers::Actions::ContributeActionProfile`.
  */
 template <class Metavariables>
 struct Observer {
@@ -41,9 +55,15 @@ struct Observer {
   }
 
   static void execute_next_phase(
-      const typename Metavariables::Phase /*next_phase*/,
-      Parallel::CProxy_ConstGlobalCache<
-          Metavariables>& /*global_cache*/) noexcept {}
+      const typename Metavariables::Phase next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    // Write the profile of the actions executed on each processing element
+    if (next_phase == Metavariables::Phase::Exit) {
+      auto& local_cache = *(global_cache.ckLocalBranch());
+      Parallel::simple_action<Actions::ContributeActionProfile>(
+          Parallel::get_parallel_component<Observer>(local_cache));
+    }
+  }
 };
 
 /*!
@@ -55,7 +75,8 @@ template <class Metavariables>
 struct ObserverWriter {
   using chare_type = Parallel::Algorithms::Nodegroup;
   using const_global_cache_tag_list =
-      tmpl::list<OptionTags::ReductionFileName, OptionTags::VolumeFileName>;
+      tmpl::list<OptionTags::ReductionFileName, OptionTags::VolumeFileName,
+                 OptionTags::ContiguousVolumeData>;
   using metavariables = Metavariables;
   using action_list = tmpl::list<>;
 
@@ -72,8 +93,36 @@ struct ObserverWriter {
   }
 
   static void execute_next_phase(
-      const typename Metavariables::Phase /*next_phase*/,
-      Parallel::CProxy_ConstGlobalCache<
-          Metavariables>& /*global_cache*/) noexcept {}
+      const typename Metavariables::Phase next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    // Reduction data is buffered and volume data is written in the
+    // background, so write whatever is left before exiting, and before a
+    // checkpoint so that the files on disk are complete up to the checkpoint.
+    if (next_phase == Metavariables::Phase::Exit or
+        is_write_checkpoint_phase(next_phase)) {
+      auto& local_cache = *(global_cache.ckLocalBranch());
+      Parallel::threaded_action<ThreadedActions::FlushReductionData>(
+          Parallel::get_parallel_component<ObserverWriter>(local_cache));
+      Parallel::threaded_action<ThreadedActions::FlushVolumeData>(
+          Parallel::get_parallel_component<ObserverWriter>(local_cache));
+    }
+  }
+
+ private:
+  template <typename PhaseType,
+            Requires<not Parallel::has_write_checkpoint_phase_v<PhaseType>> =
+                nullptr>
+  static constexpr bool is_write_checkpoint_phase(
+      const PhaseType /*phase*/) noexcept {
+    return false;
+  }
+
+  template <
+      typename PhaseType,
+      Requires<Parallel::has_write_checkpoint_phase_v<PhaseType>> = nullptr>
+  static constexpr bool is_write_checkpoint_phase(
+      const PhaseType phase) noexcept {
+    return phase == PhaseType::WriteCheckpoint;
+  }
 };
 }  // namespace observers
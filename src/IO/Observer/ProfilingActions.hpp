@@ -0,0 +1,170 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/ReductionFileWriter.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "IO/Observer/VolumeFileWriter.hpp"
+#include "Parallel/ActionProfiler.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+namespace observers {
+template <class Metavariables>
+struct ObserverWriter;
+}  // namespace observers
+/// \endcond
+
+namespace observers {
+namespace ThreadedActions {
+/// \cond
+struct WriteActionProfile;
+/// \endcond
+}  // namespace ThreadedActions
+
+namespace Actions {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Send the `Parallel::ActionProfile`s recorded by the
+ * `Parallel::ActionProfiler` of this processing element to the local
+ * `ObserverWriter`, which writes the profiles of all processing elements to
+ * the reduction file.
+ *
+ * This action is invoked on all elements of the `Observer` group, which has
+ * one element on each processing element. The `Observer` does so in the
+ * `Exit` phase, but the action may also be invoked at any other time to write
+ * the profiles accumulated so far.
+ */
+struct ContributeActionProfile {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(const db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    auto& local_writer = *Parallel::get_parallel_component<
+                              ObserverWriter<Metavariables>>(cache)
+                              .ckLocalBranch();
+    Parallel::threaded_action<ThreadedActions::WriteActionProfile>(
+        local_writer, size_t{1},
+        Parallel::ActionProfiler::thread_local_instance().summary());
+  }
+};
+}  // namespace Actions
+
+namespace ThreadedActions {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Combine the `Parallel::ActionProfile`s of the processing elements on
+ * the node and send them to node 0, which writes the profiles of all
+ * processing elements to the reduction file.
+ *
+ * `number_of_contributions` is the number of processing elements whose
+ * profiles are combined in `action_profiles`. Each action is written to the
+ * `h5::Dat` subfile `/ActionProfile/<component>/<action>` as a row of the
+ * wall time on node 0, the number of calls, the inclusive time and the time
+ * spent waiting for data, summed over all processing elements. The reduction
+ * file is closed afterwards so that the profile is on disk even if it is
+ * written after the `ObserverWriter` flushed its buffers in the `Exit` phase.
+ */
+struct WriteActionProfile {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock,
+                    const size_t number_of_contributions,
+                    std::map<std::string, Parallel::ActionProfile>&&
+                        action_profiles) noexcept {
+    const auto node_id = Parallel::my_node();
+    ReductionFileWriter* reduction_file_writer = nullptr;
+    size_t number_of_combined_contributions = 0;
+    std::map<std::string, Parallel::ActionProfile> combined_profiles{};
+    Parallel::lock(node_lock);
+    db::mutate<Tags::ActionProfiles, Tags::ActionProfilesContributed,
+               Tags::ReductionFileWriter>(
+        make_not_null(&box),
+        [
+          &action_profiles, &combined_profiles, node_id,
+          &number_of_combined_contributions, number_of_contributions,
+          &reduction_file_writer
+        ](const gsl::not_null<std::map<std::string, Parallel::ActionProfile>*>
+              profiles,
+          const gsl::not_null<size_t*> contributed,
+          const gsl::not_null<ReductionFileWriter*> writer) noexcept {
+          reduction_file_writer = writer.get();
+          for (const auto& name_and_profile : action_profiles) {
+            (*profiles)[name_and_profile.first] += name_and_profile.second;
+          }
+          *contributed += number_of_contributions;
+          // Node 0 waits for all processing elements, the other nodes for
+          // their own processing elements.
+          const auto expected_contributions = static_cast<size_t>(
+              node_id == 0 ? Parallel::number_of_procs()
+                           : Parallel::procs_on_node(node_id));
+          if (*contributed == expected_contributions) {
+            number_of_combined_contributions = *contributed;
+            combined_profiles = std::move(*profiles);
+            profiles->clear();
+            *contributed = 0;
+          }
+        });
+    Parallel::unlock(node_lock);
+
+    if (number_of_combined_contributions == 0) {
+      return;
+    }
+    if (node_id != 0) {
+      Parallel::threaded_action<WriteActionProfile>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          number_of_combined_contributions, std::move(combined_profiles));
+      return;
+    }
+
+    const std::vector<std::string> legend{"WallTime", "NumberOfCalls",
+                                          "InclusiveTime", "WaitingTime"};
+    const double wall_time = Parallel::wall_time();
+    const std::string file_name =
+        Parallel::get<OptionTags::ReductionFileName>(cache) + ".h5";
+    // The reduction file writer is shared by all threads on the node, and
+    // the volume data may be written concurrently by the I/O thread.
+    const std::lock_guard<std::mutex> hdf5_lock(hdf5_mutex());
+    for (const auto& name_and_profile : combined_profiles) {
+      const auto& profile = name_and_profile.second;
+      reduction_file_writer->append(
+          file_name, "/ActionProfile/" + name_and_profile.first, legend,
+          {wall_time, static_cast<double>(profile.number_of_calls),
+           profile.inclusive_time, profile.waiting_time});
+    }
+    reduction_file_writer->close();
+  }
+};
+}  // namespace ThreadedActions
+}  // namespace observers
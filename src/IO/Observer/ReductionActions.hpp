@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -12,12 +13,11 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "ErrorHandling/Assert.hpp"
-#include "IO/H5/AccessType.hpp"
-#include "IO/H5/Dat.hpp"
-#include "IO/H5/File.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ReductionFileWriter.hpp"
 #include "IO/Observer/Tags.hpp"
+#include "IO/Observer/VolumeFileWriter.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -136,20 +136,17 @@ namespace ThreadedActions {
 struct WriteReductionData {
  private:
   template <typename... Ts, size_t... Is>
-  static void write_data(std::vector<std::string>&& legend,
-                         std::tuple<Ts...>&& data,
-                         const std::string& file_prefix,
-                         std::index_sequence<Is...> /*meta*/) noexcept {
+  static void write_data(
+      const gsl::not_null<ReductionFileWriter*> reduction_file_writer,
+      std::vector<std::string>&& legend, std::tuple<Ts...>&& data,
+      const std::string& file_prefix,
+      std::index_sequence<Is...> /*meta*/) noexcept {
     static_assert(sizeof...(Ts) > 0,
                   "Must be reducing at least one piece of data");
     std::vector<double> data_to_append{
         static_cast<double>(std::get<Is>(data))...};
-
-    h5::H5File<h5::AccessType::ReadWrite> h5file(file_prefix + ".h5", true);
-    constexpr size_t version_number = 0;
-    auto& time_series_file = h5file.try_insert<h5::Dat>(
-        "/element_data", std::move(legend), version_number);
-    time_series_file.append(data_to_append);
+    reduction_file_writer->append(file_prefix + ".h5", "/element_data",
+                                  std::move(legend), std::move(data_to_append));
   }
 
  public:
@@ -168,17 +165,17 @@ struct WriteReductionData {
                     std::vector<std::string>&& reduction_names,
                     Parallel::ReductionData<ReductionDatums...>&&
                         in_reduction_data) noexcept {
-    CmiNodeLock file_lock;
+    ReductionFileWriter* reduction_file_writer = nullptr;
     bool write_to_disk = false;
     std::vector<std::string> legend{};
     Parallel::lock(node_lock);
     db::mutate<Tags::ReductionData<ReductionDatums...>,
                Tags::ReductionDataNames<ReductionDatums...>,
-               Tags::ReductionObserversContributed, Tags::H5FileLock>(
+               Tags::ReductionObserversContributed, Tags::ReductionFileWriter>(
         make_not_null(&box),
         [
-          &cache, &file_lock, &in_reduction_data, &legend, &observation_id,
-          &reduction_names, &write_to_disk
+          &cache, &in_reduction_data, &legend, &observation_id,
+          &reduction_file_writer, &reduction_names, &write_to_disk
         ](const gsl::not_null<
               db::item_type<Tags::ReductionData<ReductionDatums...>>*>
               reduction_data,
@@ -188,7 +185,8 @@ struct WriteReductionData {
           const gsl::not_null<
               std::unordered_map<observers::ObservationId, size_t>*>
               reduction_observers_contributed,
-          const gsl::not_null<CmiNodeLock*> reduction_file_lock) noexcept {
+          const gsl::not_null<ReductionFileWriter*> writer) noexcept {
+          reduction_file_writer = writer.get();
           auto& contribute_count =
               (*reduction_observers_contributed)[observation_id];
           const auto node_id = Parallel::my_node();
@@ -204,7 +202,6 @@ struct WriteReductionData {
 
           if (UNLIKELY(procs_on_node == 1 and number_of_nodes == 1)) {
             write_to_disk = true;
-            file_lock = *reduction_file_lock;
             legend = std::move(reduction_names_map->operator[](observation_id));
             reduction_names_map->erase(observation_id);
           } else if (reduction_data->count(observation_id) == 0) {
@@ -225,7 +222,6 @@ struct WriteReductionData {
             reduction_data->erase(observation_id);
             reduction_observers_contributed->erase(observation_id);
             write_to_disk = true;
-            file_lock = *reduction_file_lock;
             legend = std::move(reduction_names_map->operator[](observation_id));
             reduction_names_map->erase(observation_id);
           } else {
@@ -250,15 +246,53 @@ struct WriteReductionData {
     Parallel::unlock(node_lock);
 
     if (write_to_disk) {
-      Parallel::lock(&file_lock);
       in_reduction_data.finalize();
+      // The reduction file writer is shared by all threads on the node, and
+      // the volume data may be written concurrently by the I/O thread.
+      const std::lock_guard<std::mutex> hdf5_lock(hdf5_mutex());
       WriteReductionData::write_data(
-          std::move(legend), std::move(in_reduction_data.data()),
+          make_not_null(reduction_file_writer), std::move(legend),
+          std::move(in_reduction_data.data()),
           Parallel::get<OptionTags::ReductionFileName>(cache),
           std::make_index_sequence<sizeof...(ReductionDatums)>{});
-      Parallel::unlock(&file_lock);
     }
   }
 };
+
+/*!
+ * \ingroup ObserverGroup
+ * \brief Write all reduction data buffered by the ObserverWriter nodegroup to
+ * disk and close the reduction file.
+ *
+ * `WriteReductionData` buffers rows in the `Tags::ReductionFileWriter`, so
+ * this action must be invoked before the reduction file is read, e.g. before
+ * exiting.
+ */
+struct FlushReductionData {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock) noexcept {
+    ReductionFileWriter* reduction_file_writer = nullptr;
+    Parallel::lock(node_lock);
+    db::mutate<Tags::ReductionFileWriter>(
+        make_not_null(&box),
+        [&reduction_file_writer](
+            const gsl::not_null<ReductionFileWriter*> writer) noexcept {
+          reduction_file_writer = writer.get();
+        });
+    Parallel::unlock(node_lock);
+
+    const std::lock_guard<std::mutex> hdf5_lock(hdf5_mutex());
+    reduction_file_writer->close();
+  }
+};
 }  // namespace ThreadedActions
 }  // namespace observers
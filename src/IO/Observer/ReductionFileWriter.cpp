@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/ReductionFileWriter.hpp"
+
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+
+#include "ErrorHandling/Assert.hpp"
+#include "IO/H5/Dat.hpp"
+
+namespace observers {
+ReductionFileWriter::ReductionFileWriter(const size_t rows_per_flush) noexcept
+    : rows_per_flush_(rows_per_flush) {
+  ASSERT(rows_per_flush_ > 0, "Must buffer at least one row before writing.");
+}
+
+ReductionFileWriter::~ReductionFileWriter() noexcept { close(); }
+
+void ReductionFileWriter::append(const std::string& file_name,
+                                 const std::string& subfile_path,
+                                 std::vector<std::string> legend,
+                                 std::vector<double> row) noexcept {
+  if (file_name != file_name_) {
+    close();
+    file_name_ = file_name;
+  }
+  auto& subfile = buffers_[subfile_path];
+  if (subfile.legend.empty()) {
+    subfile.legend = std::move(legend);
+  }
+  subfile.rows.push_back(std::move(row));
+  if (subfile.rows.size() >= rows_per_flush_) {
+    write(subfile_path, make_not_null(&subfile));
+  }
+}
+
+void ReductionFileWriter::flush() noexcept {
+  for (auto& path_and_subfile : buffers_) {
+    write(path_and_subfile.first, make_not_null(&path_and_subfile.second));
+  }
+}
+
+void ReductionFileWriter::close() noexcept {
+  flush();
+  open_subfile_ = nullptr;
+  open_subfile_path_.clear();
+  file_.reset();
+}
+
+size_t ReductionFileWriter::number_of_buffered_rows() const noexcept {
+  size_t result = 0;
+  for (const auto& path_and_subfile : buffers_) {
+    result += path_and_subfile.second.rows.size();
+  }
+  return result;
+}
+
+void ReductionFileWriter::pup(PUP::er& p) noexcept {
+  // The open file cannot be serialized, so only the buffered rows are. The file
+  // is reopened by the next write.
+  p | rows_per_flush_;
+  p | file_name_;
+  p | buffers_;
+}
+
+void ReductionFileWriter::Subfile::pup(PUP::er& p) noexcept {
+  p | legend;
+  p | rows;
+}
+
+void ReductionFileWriter::write(
+    const std::string& subfile_path,
+    const gsl::not_null<Subfile*> subfile) noexcept {
+  if (subfile->rows.empty()) {
+    return;
+  }
+  if (file_ == nullptr) {
+    file_ = std::make_unique<h5::H5File<h5::AccessType::ReadWrite>>(file_name_,
+                                                                    true);
+    open_subfile_ = nullptr;
+  }
+  if (open_subfile_ == nullptr or open_subfile_path_ != subfile_path) {
+    constexpr size_t version_number = 0;
+    open_subfile_ = &file_->try_insert<h5::Dat>(subfile_path, subfile->legend,
+                                                version_number);
+    open_subfile_path_ = subfile_path;
+  }
+  open_subfile_->append(subfile->rows);
+  subfile->rows.clear();
+}
+}  // namespace observers
@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace h5 {
+class Dat;
+}  // namespace h5
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Keeps the reduction H5 file and its `h5::Dat` subfiles open across
+ * observations and writes rows to disk in chunks.
+ *
+ * Reductions such as error norms are typically observed every few steps and
+ * consist of a single row. Opening the H5 file and the subfile for each row
+ * dominates the cost of writing them, so instead the rows passed to `append`
+ * are buffered in memory and a subfile's rows are written once
+ * `rows_per_flush` of them have accumulated. Buffered rows are also written by
+ * `flush`, `close` and the destructor. Serializing the writer keeps the
+ * buffered rows but not the open file, which is reopened by the next write.
+ *
+ * \warning Since the file is kept open, it must not be opened elsewhere until
+ * `close` has been called.
+ */
+class ReductionFileWriter {
+ public:
+  static constexpr size_t default_rows_per_flush = 32;
+
+  ReductionFileWriter() = default;
+  explicit ReductionFileWriter(size_t rows_per_flush) noexcept;
+  ReductionFileWriter(const ReductionFileWriter& /*rhs*/) = delete;
+  ReductionFileWriter& operator=(const ReductionFileWriter& /*rhs*/) = delete;
+  ReductionFileWriter(ReductionFileWriter&& /*rhs*/) = default;
+  ReductionFileWriter& operator=(ReductionFileWriter&& /*rhs*/) = default;
+  ~ReductionFileWriter() noexcept;
+
+  /*!
+   * \brief Buffer `row` for the `h5::Dat` subfile at `subfile_path` in the H5
+   * file `file_name`.
+   *
+   * The `legend` is used when the subfile has to be created. If `file_name`
+   * differs from the file currently in use, that file is flushed and closed
+   * first.
+   */
+  void append(const std::string& file_name, const std::string& subfile_path,
+              std::vector<std::string> legend,
+              std::vector<double> row) noexcept;
+
+  /// Write all buffered rows to disk, keeping the file open.
+  void flush() noexcept;
+
+  /// Write all buffered rows to disk and close the file.
+  void close() noexcept;
+
+  /// The number of rows that have not yet been written to disk.
+  size_t number_of_buffered_rows() const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  struct Subfile {
+    std::vector<std::string> legend{};
+    std::vector<std::vector<double>> rows{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) noexcept;
+  };
+
+  void write(const std::string& subfile_path,
+             gsl::not_null<Subfile*> subfile) noexcept;
+
+  size_t rows_per_flush_{default_rows_per_flush};
+  std::string file_name_{};
+  std::unique_ptr<h5::H5File<h5::AccessType::ReadWrite>> file_{};
+  // The H5File only holds one object open at a time, so we track which subfile
+  // that is to avoid reopening it for every write.
+  std::string open_subfile_path_{};
+  h5::Dat* open_subfile_{nullptr};
+  std::map<std::string, Subfile> buffers_{};
+};
+}  // namespace observers
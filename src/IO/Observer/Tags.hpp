@@ -4,7 +4,7 @@
 #pragma once
 
 #include <cstddef>
-#include <lrtslock.h>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -15,7 +15,10 @@
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ReductionFileWriter.hpp"
+#include "IO/Observer/VolumeFileWriter.hpp"
 #include "Options/Options.hpp"
+#include "Parallel/ActionProfiler.hpp"
 #include "Parallel/Reduction.hpp"
 
 namespace observers {
@@ -97,14 +100,32 @@ struct ReductionObserversContributed : db::SimpleTag {
   using type = std::unordered_map<observers::ObservationId, size_t>;
 };
 
-/// Node lock used when needing to read/write to H5 files on disk.
+/// Keeps the reduction data file open and buffers the rows written to it.
 ///
-/// The reason for only having one lock for all files is that we currently don't
-/// require a thread-safe HDF5 installation. In the future we will need to
-/// experiment with different HDF5 configurations.
-struct H5FileLock : db::SimpleTag {
-  static std::string name() noexcept { return "H5FileLock"; }
-  using type = CmiNodeLock;
+/// Must only be accessed while holding `observers::hdf5_mutex()`.
+struct ReductionFileWriter : db::SimpleTag {
+  static std::string name() noexcept { return "ReductionFileWriter"; }
+  using type = observers::ReductionFileWriter;
+};
+
+/// The `Parallel::ActionProfile`s that have been collected for the next
+/// report, keyed by the component and action they belong to.
+struct ActionProfiles : db::SimpleTag {
+  static std::string name() noexcept { return "ActionProfiles"; }
+  using type = std::map<std::string, Parallel::ActionProfile>;
+};
+
+/// The number of processing elements whose `Parallel::ActionProfile`s are
+/// included in `Tags::ActionProfiles`.
+struct ActionProfilesContributed : db::SimpleTag {
+  static std::string name() noexcept { return "ActionProfilesContributed"; }
+  using type = size_t;
+};
+
+/// Writes the volume data to disk on a dedicated I/O thread.
+struct VolumeFileWriter : db::SimpleTag {
+  static std::string name() noexcept { return "VolumeFileWriter"; }
+  using type = observers::VolumeFileWriter;
 };
 }  // namespace Tags
 
@@ -118,6 +139,20 @@ struct VolumeFileName {
   static type default_value() noexcept { return "./VolumeData"; }
 };
 
+/// \ingroup ObserversGroup
+/// Whether to write the volume data with `h5::VolumeData::Layout::Contiguous`
+/// instead of the default `h5::VolumeData::Layout::PerGrid`.
+///
+/// The contiguous layout writes far fewer datasets, but `GenerateXdmf.py` can
+/// only read the per-grid layout.
+struct ContiguousVolumeData {
+  using type = bool;
+  static constexpr OptionString help = {
+      "Write all grids of an observation into one dataset per tensor\n"
+      "component. Not supported by GenerateXdmf.py."};
+  static type default_value() noexcept { return false; }
+};
+
 /// \ingroup ObserversGroup
 /// The name of the H5 file on disk to which all reduction data is written.
 struct ReductionFileName {
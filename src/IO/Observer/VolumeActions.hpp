@@ -5,23 +5,25 @@
 
 #include <cstddef>
 #include <iterator>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
-#include "IO/H5/AccessType.hpp"
-#include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
+#include "IO/Observer/VolumeFileWriter.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -173,6 +175,11 @@ namespace ThreadedActions {
 /*!
  * \ingroup ObserverGroup
  * \brief Writes volume data at the `observation_id` to disk.
+ *
+ * The data is handed to the `Tags::VolumeFileWriter`, which writes it on a
+ * dedicated I/O thread, so this action only blocks if the writer's queue is
+ * full. The data is written with `h5::VolumeData::Layout::PerGrid` unless
+ * `OptionTags::ContiguousVolumeData` is set.
  */
 struct WriteVolumeData {
   template <typename... DbTags, typename... InboxTags, typename Metavariables,
@@ -191,40 +198,69 @@ struct WriteVolumeData {
     Parallel::lock(node_lock);
     std::unordered_map<observers::ArrayComponentId, ExtentsAndTensorVolumeData>
         volume_data{};
-    CmiNodeLock file_lock;
-    db::mutate<Tags::H5FileLock, Tags::TensorData>(
+    VolumeFileWriter* volume_file_writer = nullptr;
+    db::mutate<Tags::TensorData, Tags::VolumeFileWriter>(
         make_not_null(&box),
-        [&observation_id, &file_lock, &volume_data ](
-            const gsl::not_null<CmiNodeLock*> in_file_lock,
+        [&observation_id, &volume_data, &volume_file_writer ](
             const gsl::not_null<db::item_type<Tags::TensorData>*>
-                in_volume_data) noexcept {
+                in_volume_data,
+            const gsl::not_null<VolumeFileWriter*> writer) noexcept {
           volume_data = std::move((*in_volume_data)[observation_id]);
           in_volume_data->erase(observation_id);
-          file_lock = *in_file_lock;
+          volume_file_writer = writer.get();
         });
     Parallel::unlock(node_lock);
 
-    // Write to file. We use a separate node lock because writing can be very
-    // time consuming (it's network dependent, depends on how full the disks
-    // are, what other users are doing, etc.) and we want to be able to continue
-    // to work on the nodegroup while we are writing data to disk.
-    Parallel::lock(&file_lock);
-    {
-      // Scoping is for closing HDF5 file before we release the lock.
-      const auto& file_prefix =
-          Parallel::get<OptionTags::VolumeFileName>(cache);
-      h5::H5File<h5::AccessType::ReadWrite> h5file(
-          file_prefix + std::to_string(Parallel::my_node()) + ".h5", true);
-      constexpr size_t version_number = 0;
-      auto& volume_file =
-          h5file.try_insert<h5::VolumeData>("/element_data", version_number);
-      for (const auto& id_and_tensor_data_for_grid : volume_data) {
-        const auto& extents_and_tensors = id_and_tensor_data_for_grid.second;
-        volume_file.insert_tensor_data(
-            observation_id.hash(), observation_id.value(), extents_and_tensors);
-      }
+    // Writing can be very time consuming (it's network dependent, depends on
+    // how full the disks are, what other users are doing, etc.), so we queue
+    // the data for the I/O thread and continue to work on the nodegroup. The
+    // writer is thread-safe, so no lock is needed here.
+    std::vector<ExtentsAndTensorVolumeData> grids{};
+    grids.reserve(volume_data.size());
+    for (auto& id_and_tensor_data_for_grid : volume_data) {
+      grids.push_back(std::move(id_and_tensor_data_for_grid.second));
     }
-    Parallel::unlock(&file_lock);
+    const auto& file_prefix = Parallel::get<OptionTags::VolumeFileName>(cache);
+    volume_file_writer->push(
+        file_prefix + std::to_string(Parallel::my_node()) + ".h5",
+        Parallel::get<OptionTags::ContiguousVolumeData>(cache)
+            ? h5::VolumeData::Layout::Contiguous
+            : h5::VolumeData::Layout::PerGrid,
+        observation_id.hash(), observation_id.value(), std::move(grids));
+  }
+};
+
+/*!
+ * \ingroup ObserverGroup
+ * \brief Block until all volume data queued on the ObserverWriter nodegroup
+ * has been written to disk.
+ *
+ * `WriteVolumeData` writes in the background, so this action must be invoked
+ * before the volume files are read, e.g. before exiting.
+ */
+struct FlushVolumeData {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock) noexcept {
+    VolumeFileWriter* volume_file_writer = nullptr;
+    Parallel::lock(node_lock);
+    db::mutate<Tags::VolumeFileWriter>(
+        make_not_null(&box),
+        [&volume_file_writer](
+            const gsl::not_null<VolumeFileWriter*> writer) noexcept {
+          volume_file_writer = writer.get();
+        });
+    Parallel::unlock(node_lock);
+
+    volume_file_writer->wait();
   }
 };
 }  // namespace ThreadedActions
@@ -0,0 +1,132 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/VolumeFileWriter.hpp"
+
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+
+namespace observers {
+std::mutex& hdf5_mutex() noexcept {
+  static std::mutex mutex{};
+  return mutex;
+}
+
+VolumeFileWriter::VolumeFileWriter() noexcept
+    : queue_(std::make_unique<Queue>()) {}
+
+VolumeFileWriter::VolumeFileWriter(const size_t max_queued_bytes) noexcept
+    : max_queued_bytes_(max_queued_bytes), queue_(std::make_unique<Queue>()) {
+  ASSERT(max_queued_bytes_ > 0, "Must allow at least one byte to be queued.");
+}
+
+void VolumeFileWriter::push(
+    std::string file_name, const h5::VolumeData::Layout layout,
+    const size_t observation_id, const double observation_value,
+    std::vector<ExtentsAndTensorVolumeData> grids) noexcept {
+  ASSERT(queue_ != nullptr, "Cannot push to a moved-from VolumeFileWriter.");
+  size_t number_of_bytes = 0;
+  for (const auto& grid : grids) {
+    number_of_bytes += grid.extents.size() * sizeof(size_t);
+    for (const auto& tensor_component : grid.tensor_components) {
+      number_of_bytes += tensor_component.name.size() +
+                         tensor_component.data.size() * sizeof(double);
+    }
+  }
+
+  Queue& queue = *queue_;
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  queue.changed.wait(lock, [this, &queue, number_of_bytes ]() noexcept {
+    return queue.number_of_queued_bytes == 0 or
+           queue.number_of_queued_bytes + number_of_bytes <= max_queued_bytes_;
+  });
+  queue.observations.push_back(Observation{
+      std::move(file_name), layout, observation_id, observation_value,
+      std::move(grids), number_of_bytes});
+  queue.number_of_queued_bytes += number_of_bytes;
+  if (not queue.thread.joinable()) {
+    queue.thread = std::thread(&Queue::write_observations, &queue);
+  }
+  lock.unlock();
+  queue.changed.notify_all();
+}
+
+void VolumeFileWriter::wait() noexcept {
+  if (queue_ == nullptr) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(queue_->mutex);
+  queue_->changed.wait(
+      lock, [this]() noexcept { return queue_->observations.empty(); });
+}
+
+void VolumeFileWriter::close() noexcept {
+  // Destroying the queue writes the remaining observations and joins the
+  // thread.
+  queue_ = std::make_unique<Queue>();
+}
+
+size_t VolumeFileWriter::number_of_queued_bytes() const noexcept {
+  if (queue_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard<std::mutex> lock(queue_->mutex);
+  return queue_->number_of_queued_bytes;
+}
+
+void VolumeFileWriter::pup(PUP::er& p) noexcept {
+  // The queued observations are being written by the I/O thread, so we finish
+  // writing them instead of serializing them.
+  if (not p.isUnpacking()) {
+    wait();
+  }
+  p | max_queued_bytes_;
+}
+
+VolumeFileWriter::Queue::~Queue() noexcept {
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  changed.notify_all();
+  if (thread.joinable()) {
+    thread.join();
+  }
+}
+
+void VolumeFileWriter::Queue::write_observations() noexcept {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    changed.wait(
+        lock, [this]() noexcept { return stop or not observations.empty(); });
+    if (observations.empty()) {
+      return;
+    }
+    // The observation stays in the queue until it has been written so that it
+    // counts towards the bound and `wait` does not return early. References to
+    // the elements of a deque stay valid when other elements are pushed.
+    const Observation& observation = observations.front();
+    lock.unlock();
+    {
+      const std::lock_guard<std::mutex> hdf5_lock(hdf5_mutex());
+      h5::H5File<h5::AccessType::ReadWrite> h5file(observation.file_name, true);
+      constexpr size_t version_number = 0;
+      auto& volume_file = h5file.try_insert<h5::VolumeData>(
+          "/element_data", version_number, observation.layout);
+      volume_file.write_volume_data(observation.observation_id,
+                                    observation.observation_value,
+                                    observation.grids);
+    }
+    lock.lock();
+    number_of_queued_bytes -= observation.number_of_bytes;
+    observations.pop_front();
+    changed.notify_all();
+  }
+}
+}  // namespace observers
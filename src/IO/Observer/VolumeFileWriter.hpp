@@ -0,0 +1,125 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief The mutex that serializes all HDF5 calls made by the observers on a
+ * process.
+ *
+ * We do not require a thread-safe HDF5 installation, so the I/O thread of the
+ * `VolumeFileWriter` and any other code that accesses H5 files while it may be
+ * running must hold this mutex.
+ */
+std::mutex& hdf5_mutex() noexcept;
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Writes volume data to disk on a dedicated I/O thread.
+ *
+ * Writing large volume dumps can take a long time, and doing so on a Charm++
+ * worker stalls all the work scheduled on it. Instead, `push` hands the data
+ * of an observation to a background thread and returns immediately, so the
+ * evolution continues while the data is written. The observations are written
+ * in the order they were pushed, each to the `/element_data` subfile of its
+ * file using the `h5::VolumeData::Layout` it was pushed with.
+ *
+ * The queue is bounded by `max_queued_bytes`, which counts the observations
+ * that have not finished writing. Once it is reached `push` blocks until enough
+ * data has been written, applying backpressure to the caller. An observation
+ * larger than the bound is still accepted once the queue is empty.
+ *
+ * `wait` blocks until everything pushed so far has been written, and must be
+ * called before the files are read, e.g. before exiting. Serializing the writer
+ * waits for the pending writes and only keeps the bound. The I/O thread is
+ * started by the first `push` and stopped by `close` or the destructor after
+ * the queue has drained.
+ */
+class VolumeFileWriter {
+ public:
+  static constexpr size_t default_max_queued_bytes = 1073741824;
+
+  VolumeFileWriter() noexcept;
+  explicit VolumeFileWriter(size_t max_queued_bytes) noexcept;
+  VolumeFileWriter(const VolumeFileWriter& /*rhs*/) = delete;
+  VolumeFileWriter& operator=(const VolumeFileWriter& /*rhs*/) = delete;
+  VolumeFileWriter(VolumeFileWriter&& /*rhs*/) = default;
+  VolumeFileWriter& operator=(VolumeFileWriter&& /*rhs*/) = default;
+  ~VolumeFileWriter() = default;
+
+  /// Queue the `grids` observed at `observation_id` with value
+  /// `observation_value` for writing to the H5 file `file_name` with the
+  /// given `layout`, blocking while the queue is full.
+  ///
+  /// The layout is only used when the subfile is created, so all
+  /// observations written to a file should use the same layout. May be
+  /// called from several threads at once.
+  void push(std::string file_name, h5::VolumeData::Layout layout,
+            size_t observation_id, double observation_value,
+            std::vector<ExtentsAndTensorVolumeData> grids) noexcept;
+
+  /// Block until all observations pushed so far have been written.
+  void wait() noexcept;
+
+  /// Write all queued observations and stop the I/O thread.
+  ///
+  /// The writer can be used again afterwards, but `close` must not be called
+  /// concurrently with `push`.
+  void close() noexcept;
+
+  /// The size of the observations that have not finished writing.
+  size_t number_of_queued_bytes() const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
+ private:
+  struct Observation {
+    std::string file_name{};
+    h5::VolumeData::Layout layout{h5::VolumeData::Layout::PerGrid};
+    size_t observation_id{};
+    double observation_value{};
+    std::vector<ExtentsAndTensorVolumeData> grids{};
+    size_t number_of_bytes{};
+  };
+
+  // The state shared with the I/O thread. It lives on the heap so that the
+  // writer can be moved while the thread is running.
+  struct Queue {
+    ~Queue() noexcept;
+
+    // Runs on the I/O thread.
+    void write_observations() noexcept;
+
+    mutable std::mutex mutex{};
+    std::condition_variable changed{};
+    std::deque<Observation> observations{};
+    size_t number_of_queued_bytes{0};
+    bool stop{false};
+    std::thread thread{};
+  };
+
+  size_t max_queued_bytes_{default_max_queued_bytes};
+  std::unique_ptr<Queue> queue_{};
+};
+}  // namespace observers
@@ -0,0 +1,329 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines the actions of the dg::FluxAggregator parallel component
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/ElementId.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregationCounters.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Printf.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace dg {
+template <class Metavariables>
+struct FluxAggregator;
+}  // namespace dg
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace dg {
+namespace Actions {
+namespace FluxAggregation_detail {
+template <typename Metavariables>
+using fluxes_tag =
+    typename FluxCommunicationTypes<Metavariables>::FluxesTag;
+
+template <typename Metavariables>
+using buffer_tag = Tags::FluxAggregationBuffer<
+    fluxes_tag<Metavariables>, Metavariables::system::volume_dim>;
+
+template <typename Metavariables>
+using Message = typename buffer_tag<Metavariables>::Message;
+}  // namespace FluxAggregation_detail
+
+/// \cond
+template <typename ElementComponent>
+struct FlushAggregatedFluxData;
+template <typename ElementComponent>
+struct ReceiveAggregatedFluxData;
+/// \endcond
+
+namespace FluxAggregation_detail {
+template <typename ElementComponent, typename Metavariables>
+void send_batch(
+    Parallel::ConstGlobalCache<Metavariables>& cache, const int destination,
+    const typename fluxes_tag<Metavariables>::temporal_id& temporal_id,
+    std::vector<Message<Metavariables>>&& batch,
+    const gsl::not_null<FluxAggregationCounters*> counters) noexcept {
+  PUP::sizer sizer{};
+  sizer | batch;
+  ++counters->number_of_batches;
+  counters->number_of_bytes += sizer.size();
+  Parallel::simple_action<ReceiveAggregatedFluxData<ElementComponent>>(
+      Parallel::get_parallel_component<FluxAggregator<Metavariables>>(
+          cache)[destination],
+      temporal_id, std::move(batch));
+}
+}  // namespace FluxAggregation_detail
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Initializes the DataBox of `dg::FluxAggregator`
+template <typename Metavariables>
+struct InitializeFluxAggregator {
+  using simple_tags =
+      db::AddSimpleTags<FluxAggregation_detail::buffer_tag<Metavariables>,
+                        Tags::FluxAggregationCounters>;
+  using compute_tags = db::AddComputeTags<>;
+
+  template <typename... InboxTags, typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(const db::DataBox<tmpl::list<>>& /*box*/,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    return std::make_tuple(db::create<simple_tags, compute_tags>(
+        db::item_type<FluxAggregation_detail::buffer_tag<Metavariables>>{},
+        FluxAggregationCounters{}));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Buffers boundary data that an element on this processor sends to
+/// an element of `ElementComponent`.
+///
+/// The `message` holds the id of the receiving element and the data that is
+/// inserted into its `dg::FluxCommunicationTypes::FluxesTag` inbox.
+///
+/// The data is added to the batch for the processor the receiver was last
+/// known to be on and the temporal id. The
+/// batch is sent as soon as it holds `OptionTags::FluxAggregationMaxMessages`
+/// messages. When the buffer was empty and still holds an incomplete batch, a
+/// `FlushAggregatedFluxData` message is sent to this processor so the
+/// remaining batches are sent once the work that is already queued is done.
+///
+/// Invoked by `dg::Actions::SendDataForFluxes` on the local branch of the
+/// group, so no message is created for the call. Data for elements on the
+/// same processor is not passed to this action.
+///
+/// Uses:
+/// - ConstGlobalCache:
+///   - OptionTags::FluxAggregationMaxMessages
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - Tags::FluxAggregationBuffer
+///   - Tags::FluxAggregationCounters
+template <typename ElementComponent>
+struct AggregateFluxData {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl::list_contains_v<
+                DbTags, Tags::FluxAggregationCounters>> = nullptr>
+  static void apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/,
+      const typename FluxAggregation_detail::fluxes_tag<
+          Metavariables>::temporal_id& temporal_id,
+      FluxAggregation_detail::Message<Metavariables>&& message) noexcept {
+    using fluxes_tag = FluxAggregation_detail::fluxes_tag<Metavariables>;
+    using buffer_tag = FluxAggregation_detail::buffer_tag<Metavariables>;
+    auto& element_proxy =
+        Parallel::get_parallel_component<ElementComponent>(cache);
+    const auto& receiver = message.first;
+    const int destination = element_proxy.ckLocMgr()->lastKnown(
+        element_proxy[receiver].ckGetIndex());
+    if (destination == Parallel::my_proc()) {
+      // The receiver migrated away from this processor and the location
+      // manager has not been updated yet, so Charm++ forwards the data.
+      Parallel::receive_data<fluxes_tag>(element_proxy[receiver], temporal_id,
+                                         std::move(message.second));
+      return;
+    }
+
+    const size_t max_messages =
+        Parallel::get<OptionTags::FluxAggregationMaxMessages>(cache);
+    db::mutate<buffer_tag, Tags::FluxAggregationCounters>(
+        make_not_null(&box),
+        [&cache, &destination, &max_messages, &message, &temporal_id ](
+            const gsl::not_null<db::item_type<buffer_tag>*> buffer,
+            const gsl::not_null<FluxAggregationCounters*> counters) noexcept {
+          const bool flush_is_queued = not buffer->empty();
+          ++counters->number_of_messages;
+          const auto key = std::make_pair(destination, temporal_id);
+          auto& batch = (*buffer)[key];
+          batch.push_back(std::move(message));
+          if (batch.size() >= max_messages) {
+            FluxAggregation_detail::send_batch<ElementComponent>(
+                cache, destination, temporal_id, std::move(batch), counters);
+            buffer->erase(key);
+          }
+          if (not flush_is_queued and not buffer->empty()) {
+            Parallel::simple_action<FlushAggregatedFluxData<ElementComponent>>(
+                Parallel::get_parallel_component<
+                    FluxAggregator<Metavariables>>(
+                    cache)[Parallel::my_proc()]);
+          }
+        });
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Sends all batches buffered by `AggregateFluxData`.
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - Tags::FluxAggregationBuffer
+///   - Tags::FluxAggregationCounters
+template <typename ElementComponent>
+struct FlushAggregatedFluxData {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl::list_contains_v<
+                DbTags, Tags::FluxAggregationCounters>> = nullptr>
+  static void apply(db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    using buffer_tag = FluxAggregation_detail::buffer_tag<Metavariables>;
+    db::mutate<buffer_tag, Tags::FluxAggregationCounters>(
+        make_not_null(&box),
+        [&cache](
+            const gsl::not_null<db::item_type<buffer_tag>*> buffer,
+            const gsl::not_null<FluxAggregationCounters*> counters) noexcept {
+          for (auto& key_and_batch : *buffer) {
+            FluxAggregation_detail::send_batch<ElementComponent>(
+                cache, key_and_batch.first.first, key_and_batch.first.second,
+                std::move(key_and_batch.second), counters);
+          }
+          buffer->clear();
+        });
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Delivers a batch of boundary data to the inboxes of the receiving
+/// elements.
+///
+/// The receivers are on this processor unless they migrated after the batch
+/// was sent, in which case Charm++ forwards the data to them.
+template <typename ElementComponent>
+struct ReceiveAggregatedFluxData {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl::list_contains_v<
+                DbTags, Tags::FluxAggregationCounters>> = nullptr>
+  static void apply(
+      const db::DataBox<DbTags>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/,
+      const typename FluxAggregation_detail::fluxes_tag<
+          Metavariables>::temporal_id& temporal_id,
+      std::vector<FluxAggregation_detail::Message<Metavariables>>&&
+          batch) noexcept {
+    auto& element_proxy =
+        Parallel::get_parallel_component<ElementComponent>(cache);
+    for (auto& message : batch) {
+      Parallel::receive_data<FluxAggregation_detail::fluxes_tag<Metavariables>>(
+          element_proxy[message.first], temporal_id, std::move(message.second));
+    }
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Prints the `dg::FluxAggregationCounters` summed over all processors
+/// if any messages were aggregated.
+///
+/// Invoked on processor 0 by the reduction of
+/// `dg::Actions::ContributeFluxAggregationCounters`.
+struct PrintFluxAggregationCounters {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static void apply(const db::DataBox<DbTags>& /*box*/,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const size_t number_of_messages,
+                    const size_t number_of_batches,
+                    const size_t number_of_bytes) noexcept {
+    if (number_of_messages > 0) {
+      Parallel::printf(
+          "Flux aggregation on %d processors: %s\n",
+          Parallel::number_of_procs(),
+          FluxAggregationCounters{number_of_messages, number_of_batches,
+                                  number_of_bytes});
+    }
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Contributes the `dg::FluxAggregationCounters` of this processor to
+/// a reduction to processor 0, where they are printed by
+/// `dg::Actions::PrintFluxAggregationCounters`.
+///
+/// Invoked on all elements of `dg::FluxAggregator` in the `Exit` phase if
+/// `OptionTags::PrintFluxAggregationCounters` is set.
+struct ContributeFluxAggregationCounters {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl::list_contains_v<
+                DbTags, Tags::FluxAggregationCounters>> = nullptr>
+  static void apply(const db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    const auto& counters = db::get<Tags::FluxAggregationCounters>(box);
+    auto& aggregator_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::contribute_to_reduction<PrintFluxAggregationCounters>(
+        Parallel::ReductionData<
+            Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+            Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+            Parallel::ReductionDatum<size_t, funcl::Plus<>>>{
+            counters.number_of_messages, counters.number_of_batches,
+            counters.number_of_bytes},
+        aggregator_proxy[Parallel::my_proc()], aggregator_proxy[0]);
+  }
+};
+}  // namespace Actions
+}  // namespace dg
@@ -2,32 +2,46 @@
 // See LICENSE.txt for details.
 
 /// \file
-/// Defines actions SendDataForFluxes and ReceiveDataForFluxes
+/// Defines actions SendDataForFluxes, RecordOverlappedWork and
+/// ReceiveDataForFluxes
 
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
-#include "DataStructures/VariablesHelpers.hpp"
 #include "Domain/FaceNormal.hpp"
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxAggregation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/InterfaceActionHelpers.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/ProcessorLocalFluxBuffer.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits.hpp"
 
 /// \cond
+namespace dg {
+template <class Metavariables>
+struct FluxAggregator;
+}  // namespace dg
 namespace Tags {
 template <typename Tag>
 struct Magnitude;
@@ -39,12 +53,121 @@ struct Next;
 
 namespace dg {
 namespace Actions {
+namespace FluxCommunication_detail {
+// The timing is only measured if the tag was added to the DataBox, so the
+// wall clock is not read otherwise.
+template <typename DbTags, typename F,
+          Requires<not tmpl::list_contains_v<
+              DbTags, Tags::FluxCommunicationTiming>> = nullptr>
+void update_timing(const gsl::not_null<db::DataBox<DbTags>*> /*box*/,
+                   F&& /*f*/) noexcept {}
+
+template <typename DbTags, typename F,
+          Requires<tmpl::list_contains_v<DbTags,
+                                         Tags::FluxCommunicationTiming>> =
+              nullptr>
+void update_timing(const gsl::not_null<db::DataBox<DbTags>*> box,
+                   F&& f) noexcept {
+  db::mutate<Tags::FluxCommunicationTiming>(
+      box, [&f](const gsl::not_null<FluxCommunicationTiming*>
+                    timing) noexcept { f(timing, Parallel::wall_time()); });
+}
+
+// Without a dg::FluxAggregator the data is sent to the neighbor directly.
+template <typename ParallelComponent, typename Metavariables, size_t VolumeDim,
+          typename TemporalId, typename Data>
+void send_data(Parallel::ConstGlobalCache<Metavariables>& cache,
+               const ElementId<VolumeDim>& neighbor,
+               const TemporalId& temporal_id, Data&& data,
+               std::false_type /*aggregate*/) noexcept {
+  Parallel::receive_data<
+      typename FluxCommunicationTypes<Metavariables>::FluxesTag>(
+      Parallel::get_parallel_component<ParallelComponent>(cache)[neighbor],
+      temporal_id, std::forward<Data>(data));
+}
+
+// With a dg::FluxAggregator the data for a neighbor on this processor is
+// moved into the dg::ProcessorLocalFluxBuffer and the neighbor is only sent a
+// notification. The data for other neighbors is batched by the local branch
+// of the aggregator.
+template <typename ParallelComponent, typename Metavariables, size_t VolumeDim,
+          typename TemporalId, typename Data>
+void send_data(Parallel::ConstGlobalCache<Metavariables>& cache,
+               const ElementId<VolumeDim>& neighbor,
+               const TemporalId& temporal_id, Data&& data,
+               std::true_type /*aggregate*/) noexcept {
+  using flux_comm_types = FluxCommunicationTypes<Metavariables>;
+  auto& receiver_proxy =
+      Parallel::get_parallel_component<ParallelComponent>(cache);
+  if (receiver_proxy[neighbor].ckLocal() != nullptr) {
+    ProcessorLocalFluxBuffer<typename flux_comm_types::FluxesTag, VolumeDim>::
+        instance()
+            .insert(neighbor, data.first, temporal_id,
+                    std::move(data.second.second));
+    Parallel::receive_data<typename flux_comm_types::FluxesTag>(
+        receiver_proxy[neighbor], temporal_id,
+        std::make_pair(
+            data.first,
+            std::make_pair(data.second.first,
+                           typename flux_comm_types::PackagedData{})));
+    return;
+  }
+  Parallel::simple_action<AggregateFluxData<ParallelComponent>>(
+      *Parallel::get_parallel_component<FluxAggregator<Metavariables>>(cache)
+           .ckLocalBranch(),
+      temporal_id, std::make_pair(neighbor, std::forward<Data>(data)));
+}
+
+// The action tests replace the dg::FluxAggregator by a mock that names it in
+// `component_being_mocked`.
+template <typename Component, typename Metavariables,
+          typename = cpp17::void_t<>>
+struct is_flux_aggregator
+    : std::is_same<Component, FluxAggregator<Metavariables>> {};
+
+template <typename Component, typename Metavariables>
+struct is_flux_aggregator<
+    Component, Metavariables,
+    cpp17::void_t<typename Component::component_being_mocked>>
+    : std::is_same<typename Component::component_being_mocked,
+                   FluxAggregator<Metavariables>> {};
+
+template <typename Metavariables>
+using aggregate_fluxes = std::integral_constant<
+    bool, tmpl::any<typename Metavariables::component_list,
+                    is_flux_aggregator<tmpl::_1,
+                                       tmpl::pin<Metavariables>>>::value>;
+
+inline void finish_exchange(
+    const gsl::not_null<FluxCommunicationTiming*> timing,
+    const double now) noexcept {
+  // Without RecordOverlappedWork in the action list no work is considered to
+  // be overlapped with the communication.
+  if (not std::isnan(timing->send_time)) {
+    const double overlap_end = std::isnan(timing->overlapped_work_end_time)
+                                   ? timing->send_time
+                                   : timing->overlapped_work_end_time;
+    timing->overlapped_time += overlap_end - timing->send_time;
+    timing->waiting_time += now - overlap_end;
+    ++timing->number_of_exchanges;
+  }
+  timing->send_time = std::numeric_limits<double>::quiet_NaN();
+  timing->overlapped_work_end_time = std::numeric_limits<double>::quiet_NaN();
+}
+}  // namespace FluxCommunication_detail
+
 /// \ingroup ActionsGroup
 /// \ingroup DiscontinuousGalerkinGroup
 /// \brief Receive boundary data needed for fluxes from neighbors.
 ///
+/// Data that neighbors send for later steps stays in the inbox, which is
+/// keyed by the temporal id, until it is needed. Received data without any
+/// grid points is a notification that the data was passed through the
+/// `dg::ProcessorLocalFluxBuffer`, from which it is then extracted.
+///
 /// Uses:
 /// - DataBox:
+///   - Tags::Element<volume_dim>
 ///   - Metavariables::temporal_id
 ///   - Tags::Next<Metavariables::temporal_id>
 /// DataBox changes:
@@ -53,6 +176,7 @@ namespace Actions {
 /// - Modifies:
 ///   - Tags::Mortars<Tags::Next<Metavariables::temporal_id>, volume_dim>
 ///   - Tags::VariablesBoundaryData
+///   - Tags::FluxCommunicationTiming (if present)
 ///
 /// \see SendDataForFluxes
 template <typename Metavariables>
@@ -78,15 +202,17 @@ struct ReceiveDataForFluxes {
     using temporal_id_tag = typename Metavariables::temporal_id;
     using neighbor_temporal_id_tag =
         Tags::Mortars<Tags::Next<temporal_id_tag>, volume_dim>;
+    const auto& element_id = db::get<Tags::Element<volume_dim>>(box).id();
     db::mutate<Tags::VariablesBoundaryData, neighbor_temporal_id_tag>(
         make_not_null(&box),
-        [&inboxes](const gsl::not_null<
-                       db::item_type<Tags::VariablesBoundaryData, DbTags>*>
-                       mortar_data,
-                   const gsl::not_null<db::item_type<neighbor_temporal_id_tag>*>
-                       neighbor_next_temporal_ids,
-                   const db::item_type<Tags::Next<temporal_id_tag>>&
-                       local_next_temporal_id) noexcept {
+        [&element_id, &inboxes ](
+            const gsl::not_null<
+                db::item_type<Tags::VariablesBoundaryData, DbTags>*>
+                mortar_data,
+            const gsl::not_null<db::item_type<neighbor_temporal_id_tag>*>
+                neighbor_next_temporal_ids,
+            const db::item_type<Tags::Next<temporal_id_tag>>&
+                local_next_temporal_id) noexcept {
           auto& inbox =
               tuples::get<typename flux_comm_types::FluxesTag>(inboxes);
           for (auto received_data = inbox.begin();
@@ -103,9 +229,16 @@ struct ReceiveDataForFluxes {
                      << " but received at " << receive_temporal_id);
               neighbor_next_temporal_ids->at(mortar_id) =
                   received_mortar_data.second.first;
+              auto& remote_data = received_mortar_data.second.second;
+              if (remote_data.number_of_grid_points() == 0) {
+                // The data was passed through the processor-local buffer
+                using local_buffer = ProcessorLocalFluxBuffer<
+                    typename flux_comm_types::FluxesTag, volume_dim>;
+                remote_data = local_buffer::instance().extract(
+                    element_id, mortar_id, receive_temporal_id);
+              }
               mortar_data->at(mortar_id).remote_insert(
-                  receive_temporal_id,
-                  std::move(received_mortar_data.second.second));
+                  receive_temporal_id, std::move(remote_data));
             }
           }
 
@@ -133,6 +266,8 @@ struct ReceiveDataForFluxes {
               << " while stepping to " << local_next_temporal_id);
         },
         db::get<Tags::Next<temporal_id_tag>>(box));
+    FluxCommunication_detail::update_timing(
+        make_not_null(&box), FluxCommunication_detail::finish_exchange);
 
     return std::forward_as_tuple(std::move(box));
   }
@@ -178,6 +313,17 @@ struct ReceiveDataForFluxes {
 /// \ingroup DiscontinuousGalerkinGroup
 /// \brief Send local boundary data needed for fluxes to neighbors.
 ///
+/// The data is sent to all neighbors before the local copies are stored, so
+/// the messages are in flight as early as possible. Actions placed between
+/// this action and `ReceiveDataForFluxes`, such as the computation of the
+/// volume time derivative, overlap with the communication.
+///
+/// If the Metavariables list a `dg::FluxAggregator` component, the data for
+/// neighbors on the same processor is moved into the
+/// `dg::ProcessorLocalFluxBuffer` and the neighbors are only sent an empty
+/// notification. The data for the other neighbors is batched with the data of
+/// the other elements on the processor instead of being sent directly.
+///
 /// With:
 /// - `Interface<Tag> =
 ///   Tags::Interface<Tags::InternalDirections<volume_dim>, Tag>`
@@ -198,7 +344,9 @@ struct ReceiveDataForFluxes {
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
-/// - Modifies: Tags::VariablesBoundaryData
+/// - Modifies:
+///   - Tags::VariablesBoundaryData
+///   - Tags::FluxCommunicationTiming (if present)
 ///
 /// \see ReceiveDataForFluxes
 template <typename Metavariables>
@@ -227,14 +375,16 @@ struct SendDataForFluxes {
     const auto& normal_dot_numerical_flux_computer =
         get<typename Metavariables::normal_dot_numerical_flux>(cache);
 
-    auto& receiver_proxy =
-        Parallel::get_parallel_component<ParallelComponent>(cache);
-
     const auto& element = db::get<Tags::Element<volume_dim>>(box);
     const auto& temporal_id = db::get<typename Metavariables::temporal_id>(box);
     const auto& next_temporal_id =
         db::get<Tags::Next<typename Metavariables::temporal_id>>(box);
 
+    using mortar_id_type =
+        std::pair<Direction<volume_dim>, ElementId<volume_dim>>;
+    std::vector<std::pair<mortar_id_type, typename flux_comm_types::LocalData>>
+        all_local_data{};
+    typename flux_comm_types::PackagedData projection_buffer{};
     for (const auto& direction_neighbors : element.neighbors()) {
       const auto& direction = direction_neighbors.first;
       const size_t dimension = direction.dimension();
@@ -265,8 +415,13 @@ struct SendDataForFluxes {
             Tags::Mortars<Tags::MortarSize<volume_dim - 1>, volume_dim>>(box)
                 .at(mortar_id);
 
-        auto projected_packaged_data = project_to_mortar(
-            packaged_data, boundary_mesh, mortar_mesh, mortar_size);
+        // The data sent to the neighbor is projected and oriented straight
+        // into the message, and we keep the unoriented projection.
+        typename flux_comm_types::PackagedData neighbor_packaged_data{};
+        const auto& projected_packaged_data = project_and_orient_to_mortar(
+            make_not_null(&neighbor_packaged_data),
+            make_not_null(&projection_buffer), packaged_data, boundary_mesh,
+            mortar_mesh, mortar_size, dimension, orientation);
 
         typename flux_comm_types::LocalData local_data{};
         local_data.magnitude_of_face_normal = db::get<Tags::Interface<
@@ -292,31 +447,72 @@ struct SendDataForFluxes {
                                       mortar_mesh, mortar_size));
         }
 
-        if (not orientation.is_aligned()) {
-          projected_packaged_data = orient_variables_on_slice(
-              projected_packaged_data, mortar_mesh.extents(), dimension,
-              orientation);
-        }
-
-        Parallel::receive_data<typename flux_comm_types::FluxesTag>(
-            receiver_proxy[neighbor], temporal_id,
+        FluxCommunication_detail::send_data<ParallelComponent>(
+            cache, neighbor, temporal_id,
             std::make_pair(
                 std::make_pair(direction_from_neighbor, element.id()),
                 std::make_pair(next_temporal_id,
-                               std::move(projected_packaged_data))));
-
-        db::mutate<Tags::VariablesBoundaryData>(
-            make_not_null(&box),
-            [&mortar_id, &temporal_id, &local_data](
-                const gsl::not_null<
-                    db::item_type<Tags::VariablesBoundaryData, DbTags>*>
-                    mortar_data) noexcept {
-              mortar_data->at(mortar_id).local_insert(temporal_id,
-                                                      std::move(local_data));
-            });
+                               std::move(neighbor_packaged_data))),
+            FluxCommunication_detail::aggregate_fluxes<Metavariables>{});
+
+        all_local_data.emplace_back(mortar_id, std::move(local_data));
       }  // loop over neighbors_in_direction
     }    // loop over element.neighbors()
 
+    FluxCommunication_detail::update_timing(
+        make_not_null(&box),
+        [](const gsl::not_null<FluxCommunicationTiming*> timing,
+           const double now) noexcept { timing->send_time = now; });
+
+    db::mutate<Tags::VariablesBoundaryData>(
+        make_not_null(&box),
+        [&all_local_data, &temporal_id ](
+            const gsl::not_null<
+                db::item_type<Tags::VariablesBoundaryData, DbTags>*>
+                mortar_data) noexcept {
+          for (auto& mortar_id_and_local_data : all_local_data) {
+            mortar_data->at(mortar_id_and_local_data.first)
+                .local_insert(temporal_id,
+                              std::move(mortar_id_and_local_data.second));
+          }
+        });
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Marks the end of the work that overlaps the communication of the
+/// boundary data.
+///
+/// Place this action right before `ReceiveDataForFluxes`. The time between
+/// `SendDataForFluxes` and this action is recorded as overlapped and the time
+/// from this action until all boundary data has been received is recorded as
+/// waiting. Does nothing unless Tags::FluxCommunicationTiming is in the
+/// DataBox.
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - Tags::FluxCommunicationTiming (if present)
+struct RecordOverlappedWork {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    FluxCommunication_detail::update_timing(
+        make_not_null(&box),
+        [](const gsl::not_null<FluxCommunicationTiming*> timing,
+           const double now) noexcept {
+          timing->overlapped_work_end_time = now;
+        });
     return std::forward_as_tuple(std::move(box));
   }
 };
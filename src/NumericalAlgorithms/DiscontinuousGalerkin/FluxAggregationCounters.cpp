@@ -0,0 +1,34 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregationCounters.hpp"
+
+#include <ostream>
+#include <pup.h>
+
+namespace dg {
+void FluxAggregationCounters::pup(PUP::er& p) noexcept {
+  p | number_of_messages;
+  p | number_of_batches;
+  p | number_of_bytes;
+}
+
+bool operator==(const FluxAggregationCounters& lhs,
+                const FluxAggregationCounters& rhs) noexcept {
+  return lhs.number_of_messages == rhs.number_of_messages and
+         lhs.number_of_batches == rhs.number_of_batches and
+         lhs.number_of_bytes == rhs.number_of_bytes;
+}
+
+bool operator!=(const FluxAggregationCounters& lhs,
+                const FluxAggregationCounters& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const FluxAggregationCounters& counters) noexcept {
+  return os << counters.number_of_messages << " messages in "
+            << counters.number_of_batches << " batches of "
+            << counters.number_of_bytes << " bytes";
+}
+}  // namespace dg
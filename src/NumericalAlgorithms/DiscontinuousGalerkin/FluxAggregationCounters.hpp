@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace dg {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Counts the boundary data messages `dg::FluxAggregator` batched on a
+ * processor.
+ *
+ * The ratio of `number_of_messages` to `number_of_batches` is the number of
+ * Charm++ messages saved by the aggregation.
+ */
+struct FluxAggregationCounters {
+  /// The number of boundary data messages sent by the elements on the
+  /// processor to elements on other processors
+  size_t number_of_messages{0};
+  /// The number of batches the messages were sent in
+  size_t number_of_batches{0};
+  /// The total size of the batches in bytes
+  size_t number_of_bytes{0};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+};
+
+bool operator==(const FluxAggregationCounters& lhs,
+                const FluxAggregationCounters& rhs) noexcept;
+
+bool operator!=(const FluxAggregationCounters& lhs,
+                const FluxAggregationCounters& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os,
+                         const FluxAggregationCounters& counters) noexcept;
+}  // namespace dg
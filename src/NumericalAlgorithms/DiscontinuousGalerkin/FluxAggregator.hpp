@@ -0,0 +1,62 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "AlgorithmGroup.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxAggregation.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace dg {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief The group parallel component that batches the boundary data sent
+ * between elements on different processors.
+ *
+ * Adding this component to the `component_list` of the Metavariables makes
+ * `dg::Actions::SendDataForFluxes` hand its data to the local branch of the
+ * group instead of sending one Charm++ message for each mortar. The data is
+ * batched by the processor of the receiving element and the temporal id with
+ * `dg::Actions::AggregateFluxData`, and delivered to the inboxes of the
+ * receiving elements by `dg::Actions::ReceiveAggregatedFluxData`. If
+ * `OptionTags::PrintFluxAggregationCounters` is set, the
+ * `dg::FluxAggregationCounters` summed over all processors are printed on
+ * processor 0 in the `Exit` phase.
+ */
+template <class Metavariables>
+struct FluxAggregator {
+  using chare_type = Parallel::Algorithms::Group;
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::FluxAggregationMaxMessages,
+                 OptionTags::PrintFluxAggregationCounters>;
+  using metavariables = Metavariables;
+  using action_list = tmpl::list<>;
+
+  using initial_databox = db::compute_databox_type<
+      typename Actions::InitializeFluxAggregator<Metavariables>::simple_tags>;
+
+  using options = tmpl::list<>;
+
+  static void initialize(
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    Parallel::simple_action<Actions::InitializeFluxAggregator<Metavariables>>(
+        Parallel::get_parallel_component<FluxAggregator>(local_cache));
+  }
+
+  static void execute_next_phase(
+      const typename Metavariables::Phase next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    if (next_phase == Metavariables::Phase::Exit and
+        Parallel::get<OptionTags::PrintFluxAggregationCounters>(local_cache)) {
+      Parallel::simple_action<Actions::ContributeFluxAggregationCounters>(
+          Parallel::get_parallel_component<FluxAggregator>(local_cache));
+    }
+  }
+};
+}  // namespace dg
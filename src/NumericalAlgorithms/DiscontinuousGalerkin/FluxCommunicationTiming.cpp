@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
+
+#include <ostream>
+#include <pup.h>
+
+namespace dg {
+double FluxCommunicationTiming::overlap_fraction() const noexcept {
+  const double window = overlapped_time + waiting_time;
+  return window > 0.0 ? overlapped_time / window : 1.0;
+}
+
+void FluxCommunicationTiming::pup(PUP::er& p) noexcept {
+  p | send_time;
+  p | overlapped_work_end_time;
+  p | overlapped_time;
+  p | waiting_time;
+  p | number_of_exchanges;
+}
+
+bool operator==(const FluxCommunicationTiming& lhs,
+                const FluxCommunicationTiming& rhs) noexcept {
+  // The time stamps of the current step are not compared since they are
+  // NaNs while they are not set.
+  return lhs.overlapped_time == rhs.overlapped_time and
+         lhs.waiting_time == rhs.waiting_time and
+         lhs.number_of_exchanges == rhs.number_of_exchanges;
+}
+
+bool operator!=(const FluxCommunicationTiming& lhs,
+                const FluxCommunicationTiming& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const FluxCommunicationTiming& timing) noexcept {
+  return os << timing.number_of_exchanges << " exchanges, "
+            << timing.overlapped_time << "s overlapped, "
+            << timing.waiting_time << "s waiting ("
+            << 100.0 * timing.overlap_fraction() << "% overlap)";
+}
+}  // namespace dg
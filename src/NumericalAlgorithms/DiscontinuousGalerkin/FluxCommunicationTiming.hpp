@@ -0,0 +1,63 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <limits>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace dg {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Measures how well an element overlaps the communication of boundary
+ * data with local work.
+ *
+ * \details The communication window of a step starts when
+ * `dg::Actions::SendDataForFluxes` has sent the boundary data to all
+ * neighbors. The work done until `dg::Actions::RecordOverlappedWork` runs,
+ * such as computing the volume time derivative, is overlapped with the
+ * messages in flight. The time from then until
+ * `dg::Actions::ReceiveDataForFluxes` has all boundary data is spent waiting
+ * for the neighbors.
+ *
+ * The time stamps of the current step are quiet NaNs while they are not set.
+ * They are checked with `std::isnan`, which would raise a floating point
+ * exception for signaling NaNs.
+ */
+struct FluxCommunicationTiming {
+  /// The wall time at which the boundary data of the current step was sent
+  double send_time{std::numeric_limits<double>::quiet_NaN()};
+  /// The wall time at which the work overlapping the communication of the
+  /// current step was done
+  double overlapped_work_end_time{std::numeric_limits<double>::quiet_NaN()};
+  /// The total time of work that overlapped the communication
+  double overlapped_time{0.0};
+  /// The total time spent waiting for boundary data from neighbors
+  double waiting_time{0.0};
+  /// The number of completed boundary data exchanges
+  size_t number_of_exchanges{0};
+
+  /// The fraction of the communication windows that was overlapped with
+  /// work, or one if no time was spent in communication windows
+  double overlap_fraction() const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+};
+
+bool operator==(const FluxCommunicationTiming& lhs,
+                const FluxCommunicationTiming& rhs) noexcept;
+
+bool operator!=(const FluxCommunicationTiming& lhs,
+                const FluxCommunicationTiming& rhs) noexcept;
+
+std::ostream& operator<<(std::ostream& os,
+                         const FluxCommunicationTiming& timing) noexcept;
+}  // namespace dg
@@ -14,7 +14,9 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Variables.hpp"
+#include "DataStructures/VariablesHelpers.hpp"
 #include "Domain/Mesh.hpp"
+#include "Domain/OrientationMap.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/LiftFlux.hpp"
 #include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
@@ -25,8 +27,6 @@
 /// \cond
 template <size_t VolumeDim>
 class ElementId;
-template <size_t VolumeDim>
-class OrientationMap;
 // IWYU pragma: no_forward_declare Variables
 /// \endcond
 
@@ -48,13 +48,31 @@ std::array<Spectral::MortarSize, Dim - 1> mortar_size(
     const ElementId<Dim>& self, const ElementId<Dim>& neighbor,
     size_t dimension, const OrientationMap<Dim>& orientation) noexcept;
 
+/// \ingroup DiscontinuousGalerkinGroup
+/// Whether data on a face has to be projected to represent it on a mortar,
+/// i.e. whether the mortar does not cover the full face or has a different
+/// mesh.
+template <size_t Dim>
+bool needs_projection(
+    const Mesh<Dim>& face_mesh, const Mesh<Dim>& mortar_mesh,
+    const std::array<Spectral::MortarSize, Dim>& mortar_size) noexcept {
+  return face_mesh != mortar_mesh or
+         std::any_of(mortar_size.begin(), mortar_size.end(),
+                     [](const Spectral::MortarSize s) noexcept {
+                       return s != Spectral::MortarSize::Full;
+                     });
+}
+
 /// \ingroup DiscontinuousGalerkinGroup
 /// Project variables from a face to a mortar.
+///
+/// The overload taking a `gsl::not_null` writes into `result`, which is only
+/// reallocated if it does not have the number of grid points of the mortar.
+//@{
 template <typename Tags, size_t Dim>
-Variables<Tags> project_to_mortar(
-    const Variables<Tags>& vars,
-    const Mesh<Dim>& face_mesh,
-    const Mesh<Dim>& mortar_mesh,
+void project_to_mortar(
+    const gsl::not_null<Variables<Tags>*> result, const Variables<Tags>& vars,
+    const Mesh<Dim>& face_mesh, const Mesh<Dim>& mortar_mesh,
     const std::array<Spectral::MortarSize, Dim>& mortar_size) noexcept {
   const Matrix identity{};
   auto projection_matrices = make_array<Dim>(std::cref(identity));
@@ -71,7 +89,73 @@ Variables<Tags> project_to_mortar(
           slice_size, mortar_slice_mesh, face_slice_mesh);
     }
   }
-  return apply_matrices(projection_matrices, vars, face_mesh.extents());
+  if (result->number_of_grid_points() !=
+      mortar_mesh.number_of_grid_points()) {
+    result->initialize(mortar_mesh.number_of_grid_points());
+  }
+  apply_matrices(result, projection_matrices, vars, face_mesh.extents());
+}
+
+template <typename Tags, size_t Dim>
+Variables<Tags> project_to_mortar(
+    const Variables<Tags>& vars,
+    const Mesh<Dim>& face_mesh,
+    const Mesh<Dim>& mortar_mesh,
+    const std::array<Spectral::MortarSize, Dim>& mortar_size) noexcept {
+  Variables<Tags> result(mortar_mesh.number_of_grid_points());
+  project_to_mortar(make_not_null(&result), vars, face_mesh, mortar_mesh,
+                    mortar_size);
+  return result;
+}
+//@}
+
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Project variables from a face to a mortar and orient them to the
+ * data-storage order of the neighbor, writing the result into
+ * `oriented_mortar_vars`.
+ *
+ * \details This fuses `project_to_mortar` and `orient_variables_on_slice`
+ * for packaging the data sent to a neighbor.  The projection is skipped if it
+ * is the identity (see `dg::needs_projection`), and the reorientation is done
+ * as an index permutation while copying into `oriented_mortar_vars`, so that
+ * a conforming face only costs a single copy into the outgoing buffer.
+ * `projection_buffer` is only used if the face data has to be both projected
+ * and reoriented.  Buffers are only reallocated if their number of grid
+ * points changes, so they can be reused across mortars.
+ *
+ * Returns a reference to the projected but unoriented data on the mortar,
+ * which is needed on this side of the mortar.  This is one of `vars`,
+ * `*oriented_mortar_vars` or `*projection_buffer`, so it is only valid until
+ * the next use of the buffers.
+ */
+template <typename Tags, size_t Dim>
+const Variables<Tags>& project_and_orient_to_mortar(
+    const gsl::not_null<Variables<Tags>*> oriented_mortar_vars,
+    const gsl::not_null<Variables<Tags>*> projection_buffer,
+    const Variables<Tags>& vars, const Mesh<Dim>& face_mesh,
+    const Mesh<Dim>& mortar_mesh,
+    const std::array<Spectral::MortarSize, Dim>& mortar_size,
+    const size_t sliced_dim,
+    const OrientationMap<Dim + 1>& orientation) noexcept {
+  const bool project = needs_projection(face_mesh, mortar_mesh, mortar_size);
+  if (orientation.is_aligned()) {
+    if (project) {
+      project_to_mortar(oriented_mortar_vars, vars, face_mesh, mortar_mesh,
+                        mortar_size);
+      return *oriented_mortar_vars;
+    }
+    *oriented_mortar_vars = vars;
+    return vars;
+  }
+  if (project) {
+    project_to_mortar(projection_buffer, vars, face_mesh, mortar_mesh,
+                      mortar_size);
+  }
+  const Variables<Tags>& mortar_vars = project ? *projection_buffer : vars;
+  orient_variables_on_slice(oriented_mortar_vars, mortar_vars,
+                            mortar_mesh.extents(), sliced_dim, orientation);
+  return mortar_vars;
 }
 
 /// \ingroup DiscontinuousGalerkinGroup
@@ -167,17 +251,11 @@ auto compute_boundary_flux_contribution(
         }
       });
 
-  const bool refining =
-      face_mesh != mortar_mesh or
-      std::any_of(mortar_size.begin(), mortar_size.end(),
-                  [](const Spectral::MortarSize s) noexcept {
-                    return s != Spectral::MortarSize::Full;
-                  });
-
   return dg::lift_flux(
-      refining ? project_from_mortar(normal_dot_numerical_fluxes, face_mesh,
-                                     mortar_mesh, mortar_size)
-               : std::move(normal_dot_numerical_fluxes),
+      needs_projection(face_mesh, mortar_mesh, mortar_size)
+          ? project_from_mortar(normal_dot_numerical_fluxes, face_mesh,
+                                mortar_mesh, mortar_size)
+          : std::move(normal_dot_numerical_fluxes),
       extent_perpendicular_to_boundary,
       std::forward<LocalData>(local_data).magnitude_of_face_normal);
 }
@@ -0,0 +1,109 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/functional/hash.hpp>  // IWYU pragma: keep
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+#include "Domain/Direction.hpp"  // IWYU pragma: keep
+#include "Domain/ElementId.hpp"  // IWYU pragma: keep
+#include "ErrorHandling/Error.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace dg {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Boundary data passed between elements on the same processor without
+ * serializing it.
+ *
+ * \details The sending element inserts the data it sends with `FluxesTag`,
+ * keyed by the receiving element, the mortar and the temporal id, and then
+ * sends an empty `PackagedData` to the receiver to notify it. The receiver
+ * takes ownership of the data with `extract` when it processes the
+ * notification. Only the notification is serialized, not the data.
+ *
+ * There is one buffer for each processor (i.e. each thread), so it can only
+ * pass data between elements whose local pointer (`ckLocal()`) the sender can
+ * get, and needs no lock. The data is not serialized with the elements, so
+ * each exchange has to be completed before the receiving element migrates or
+ * is checkpointed.
+ */
+template <typename FluxesTag, size_t VolumeDim>
+class ProcessorLocalFluxBuffer {
+ public:
+  using temporal_id = typename FluxesTag::temporal_id;
+  using MortarId = std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>;
+  using PackagedData =
+      typename FluxesTag::type::mapped_type::mapped_type::second_type;
+
+  /// The buffer of the calling processor
+  static ProcessorLocalFluxBuffer& instance() noexcept {
+    thread_local ProcessorLocalFluxBuffer buffer{};
+    return buffer;
+  }
+
+  ProcessorLocalFluxBuffer(const ProcessorLocalFluxBuffer&) = delete;
+  ProcessorLocalFluxBuffer(ProcessorLocalFluxBuffer&&) = delete;
+  ProcessorLocalFluxBuffer& operator=(const ProcessorLocalFluxBuffer&) =
+      delete;
+  ProcessorLocalFluxBuffer& operator=(ProcessorLocalFluxBuffer&&) = delete;
+  ~ProcessorLocalFluxBuffer() = default;
+
+  /// Store the `data` sent to the mortar `mortar_id` of `receiver` at
+  /// `temporal_id`
+  void insert(const ElementId<VolumeDim>& receiver, const MortarId& mortar_id,
+              const temporal_id& temporal_id, PackagedData&& data) noexcept {
+    const bool inserted = data_[temporal_id]
+                              .emplace(std::make_pair(receiver, mortar_id),
+                                       std::move(data))
+                              .second;
+    if (not inserted) {
+      ERROR("Data for mortar " << mortar_id << " of " << receiver << " at "
+                               << temporal_id << " was already inserted.");
+    }
+  }
+
+  /// Take ownership of the data stored by `insert`
+  PackagedData extract(const ElementId<VolumeDim>& receiver,
+                       const MortarId& mortar_id,
+                       const temporal_id& temporal_id) noexcept {
+    const auto data_at_time = data_.find(temporal_id);
+    if (data_at_time == data_.end() or
+        data_at_time->second.count(std::make_pair(receiver, mortar_id)) ==
+            0) {
+      ERROR("No data for mortar " << mortar_id << " of " << receiver
+                                  << " at " << temporal_id
+                                  << " in the processor-local buffer.");
+    }
+    const auto entry =
+        data_at_time->second.find(std::make_pair(receiver, mortar_id));
+    PackagedData data = std::move(entry->second);
+    data_at_time->second.erase(entry);
+    if (data_at_time->second.empty()) {
+      data_.erase(data_at_time);
+    }
+    return data;
+  }
+
+  /// The number of messages in the buffer
+  size_t size() const noexcept {
+    size_t result = 0;
+    for (const auto& time_and_data : data_) {
+      result += time_and_data.second.size();
+    }
+    return result;
+  }
+
+ private:
+  ProcessorLocalFluxBuffer() = default;
+
+  using Key = std::pair<ElementId<VolumeDim>, MortarId>;
+  std::map<temporal_id,
+           std::unordered_map<Key, PackagedData, boost::hash<Key>>>
+      data_;
+};
+}  // namespace dg
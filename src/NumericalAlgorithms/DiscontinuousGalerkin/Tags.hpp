@@ -6,13 +6,17 @@
 #include <array>
 #include <boost/functional/hash.hpp>  // IWYU pragma: keep
 #include <cstddef>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "Domain/Direction.hpp"  // IWYU pragma: keep
 #include "Domain/ElementId.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregationCounters.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/SimpleBoundaryData.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Options/Options.hpp"
@@ -47,6 +51,42 @@ struct MortarSize : db::SimpleTag {
   static std::string name() noexcept { return "MortarSize"; }
   using type = std::array<Spectral::MortarSize, Dim>;
 };
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// Timing of the overlap of the boundary data exchange with local work.  The
+/// flux communication actions only update it if it is in the DataBox.
+struct FluxCommunicationTiming : db::SimpleTag {
+  static std::string name() noexcept { return "FluxCommunicationTiming"; }
+  using type = dg::FluxCommunicationTiming;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Boundary data buffered by `dg::FluxAggregator`
+///
+/// The data sent with `FluxesTag` is batched by the processor it is sent to
+/// and its temporal id. Each message holds the receiving element and the data
+/// it is sent.
+template <typename FluxesTag, size_t VolumeDim>
+struct FluxAggregationBuffer : db::SimpleTag {
+  static std::string name() noexcept { return "FluxAggregationBuffer"; }
+  using temporal_id = typename FluxesTag::temporal_id;
+  using mortar_data_type = typename FluxesTag::type::mapped_type;
+  using Message = std::pair<
+      ::ElementId<VolumeDim>,
+      std::pair<typename mortar_data_type::key_type,
+                typename mortar_data_type::mapped_type>>;
+  using type = std::map<std::pair<int, temporal_id>, std::vector<Message>>;
+};
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// The number of messages and bytes aggregated by `dg::FluxAggregator`
+struct FluxAggregationCounters : db::SimpleTag {
+  static std::string name() noexcept { return "FluxAggregationCounters"; }
+  using type = dg::FluxAggregationCounters;
+};
 }  // namespace Tags
 
 namespace OptionTags {
@@ -60,4 +100,32 @@ struct NumericalFluxParams {
   static constexpr OptionString help = "The options for the numerical flux";
   using type = NumericalFluxType;
 };
+
+/*!
+ * \ingroup OptionTagsGroup
+ * \brief The number of boundary data messages `dg::FluxAggregator` buffers for
+ * a processor and temporal id before it sends them as one message.
+ *
+ * Batches that are not full are sent once the messages that were queued on
+ * the processor when their first message was buffered have been processed.
+ */
+struct FluxAggregationMaxMessages {
+  using type = size_t;
+  static constexpr OptionString help = {
+      "Maximum number of boundary data messages sent in one batch"};
+  static type default_value() noexcept { return 64; }
+  static type lower_bound() noexcept { return 1; }
+};
+
+/*!
+ * \ingroup OptionTagsGroup
+ * \brief Whether `dg::FluxAggregator` prints the number of boundary data
+ * messages it aggregated on all processors in the `Exit` phase.
+ */
+struct PrintFluxAggregationCounters {
+  using type = bool;
+  static constexpr OptionString help = {
+      "Print the number of aggregated boundary data messages at exit"};
+  static type default_value() noexcept { return false; }
+};
 }  // namespace OptionTags
@@ -8,13 +8,16 @@
 #include <unordered_set>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp" // IWYU pragma: keep
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/BlockId.hpp" // IWYU pragma: keep
+#include "Domain/ElementId.hpp"
+#include "Domain/Mesh.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 
 /// \cond
-template <size_t VolumeDim>
-class ElementId;
 template <typename TagsList>
 class Variables;
 /// \endcond
@@ -61,11 +64,35 @@ struct Info {
   /// already been done for this `Info`.
   std::unordered_set<ElementId<VolumeDim>>
       interpolation_is_done_for_these_elements{};
+  /// Holds the `ElementId`s of the `Element`s that contain some of the
+  /// points in `block_coord_holders`, i.e. whose `CachedInterpolant`s were
+  /// used for this `Info`.
+  std::unordered_set<ElementId<VolumeDim>> elements_with_points{};
+};
+
+/// \brief An interpolant from the `Mesh` of an `Element` to the points of
+/// an `InterpolationTarget` in that `Element`.
+///
+/// Constructing the interpolation matrix is much more expensive than
+/// applying it, so an `Interpolator` keeps the interpolant of each
+/// `Element` and reuses it at later `temporal_id`s as long as the `mesh`
+/// and the `element_logical_coords` of the points are unchanged, e.g.
+/// for a target whose points are fixed in a static grid.
+///
+/// When the `Info` of a `temporal_id` is erased, the `CachedInterpolant`s of
+/// the `Element`s that contained none of its points are erased as well, so
+/// the cache only holds the interpolants of the most recent points.
+template <size_t VolumeDim>
+struct CachedInterpolant {
+  Mesh<VolumeDim> mesh{};
+  tnsr::I<DataVector, VolumeDim, Frame::Logical> element_logical_coords{};
+  Irregular<VolumeDim> interpolant{};
 };
 
 /// Holds `Info`s at all `temporal_id`s for a given
 /// `InterpolationTargetTag`.  Also holds `temporal_id`s when data has
-/// been interpolated; this is used for cleanup purposes.  All
+/// been interpolated; this is used for cleanup purposes, and the
+/// `CachedInterpolant`s of the local `Element`s.  All
 /// `Holder`s for all `InterpolationTargetTags` are held in a single
 /// `TaggedTuple` that is in the `Interpolator`'s `DataBox` with the
 /// tag `Tags::InterpolatedVarsHolders`.
@@ -77,6 +104,8 @@ struct Holder {
       infos;
   std::unordered_set<typename Metavariables::temporal_id>
       temporal_ids_when_data_has_been_interpolated;
+  std::unordered_map<ElementId<VolumeDim>, CachedInterpolant<VolumeDim>>
+      cached_interpolants{};
 };
 
 /// Indexes a particular `Holder` in the `TaggedTuple` that is
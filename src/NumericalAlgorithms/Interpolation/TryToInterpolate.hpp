@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Variables.hpp"
@@ -32,6 +35,53 @@ namespace intrp {
 
 namespace interpolator_detail {
 
+// The number of `Irregular` interpolants built by `interpolate_data` on this
+// thread. Only used by the tests to check that cached interpolants are
+// reused.
+inline size_t& number_of_interpolants_built() noexcept {
+  thread_local size_t number_of_interpolants_built = 0;
+  return number_of_interpolants_built;
+}
+
+// Computes the variables to interpolate from the source variables, using a
+// DataBox to evaluate the compute items on the source.
+template <typename InterpolationTargetTag, typename SourceTags>
+void compute_vars_to_interpolate(
+    const gsl::not_null<Variables<
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>*>
+        local_vars,
+    const Variables<SourceTags>& source_vars,
+    std::false_type /*no_compute_items_on_source*/) noexcept {
+  const auto new_box = db::create<
+      db::AddSimpleTags<::Tags::Variables<SourceTags>>,
+      db::AddComputeTags<
+          typename InterpolationTargetTag::compute_items_on_source>>(
+      source_vars);
+  tmpl::for_each<
+      typename InterpolationTargetTag::vars_to_interpolate_to_target>(
+      [&new_box, &local_vars](auto x) noexcept {
+        using tag = typename decltype(x)::type;
+        get<tag>(*local_vars) = db::get<tag>(new_box);
+      });
+}
+
+// Without compute items on the source all the variables to interpolate are
+// source variables, so we copy them without creating a DataBox.
+template <typename InterpolationTargetTag, typename SourceTags>
+void compute_vars_to_interpolate(
+    const gsl::not_null<Variables<
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>*>
+        local_vars,
+    const Variables<SourceTags>& source_vars,
+    std::true_type /*no_compute_items_on_source*/) noexcept {
+  tmpl::for_each<
+      typename InterpolationTargetTag::vars_to_interpolate_to_target>(
+      [&source_vars, &local_vars](auto x) noexcept {
+        using tag = typename decltype(x)::type;
+        get<tag>(*local_vars) = get<tag>(source_vars);
+      });
+}
+
 // Interpolates data onto a set of points desired by an InterpolationTarget.
 template <typename InterpolationTargetTag, typename Metavariables,
           size_t VolumeDim, typename DbTags>
@@ -47,10 +97,9 @@ void interpolate_data(
               holders,
           const db::item_type<Tags::VolumeVarsInfo<Metavariables, VolumeDim>>&
               volume_vars_info) noexcept {
-        auto& interp_info =
-            get<Vars::HolderTag<InterpolationTargetTag, Metavariables,
-                                VolumeDim>>(*holders)
-                .infos.at(temporal_id);
+        auto& holder = get<Vars::HolderTag<InterpolationTargetTag,
+                                           Metavariables, VolumeDim>>(*holders);
+        auto& interp_info = holder.infos.at(temporal_id);
 
         for (const auto& volume_info_outer : volume_vars_info) {
           // Are we at the right time?
@@ -87,29 +136,33 @@ void interpolate_data(
             // derived from volume_info.vars plus an arbitrary set
             // of compute items in
             // InterpolationTargetTag::compute_items_on_source.
-
-            auto new_box = db::create<
-                db::AddSimpleTags<::Tags::Variables<
-                    typename Metavariables::interpolator_source_vars>>,
-                db::AddComputeTags<
-                    typename InterpolationTargetTag::compute_items_on_source>>(
-                volume_info.vars);
-
             Variables<
                 typename InterpolationTargetTag::vars_to_interpolate_to_target>
                 local_vars(volume_info.mesh.number_of_grid_points());
-
-            tmpl::for_each<
-                typename InterpolationTargetTag::vars_to_interpolate_to_target>(
-                [&new_box, &local_vars](auto x) noexcept {
-                  using tag = typename decltype(x)::type;
-                  get<tag>(local_vars) = db::get<tag>(new_box);
-                });
-
-            // Now interpolate.
-            intrp::Irregular<VolumeDim> interpolator(
-                volume_info.mesh, element_coord_holder.element_logical_coords);
-            interp_info.vars.emplace_back(interpolator.interpolate(local_vars));
+            compute_vars_to_interpolate<InterpolationTargetTag>(
+                make_not_null(&local_vars), volume_info.vars,
+                std::integral_constant<
+                    bool, tmpl::size<typename InterpolationTargetTag::
+                                         compute_items_on_source>::value ==
+                              0>{});
+
+            // Now interpolate, reusing the interpolant from an earlier
+            // temporal_id if the mesh and the points are the same.
+            auto& cached = holder.cached_interpolants[element_id];
+            if (cached.mesh != volume_info.mesh or
+                cached.element_logical_coords !=
+                    element_coord_holder.element_logical_coords) {
+              cached.mesh = volume_info.mesh;
+              cached.element_logical_coords =
+                  element_coord_holder.element_logical_coords;
+              cached.interpolant = intrp::Irregular<VolumeDim>(
+                  volume_info.mesh,
+                  element_coord_holder.element_logical_coords);
+              ++number_of_interpolants_built();
+            }
+            interp_info.elements_with_points.insert(element_id);
+            interp_info.vars.emplace_back(
+                cached.interpolant.interpolate(local_vars));
             interp_info.global_offsets.emplace_back(
                 element_coord_holder.offsets);
           }
@@ -160,15 +213,27 @@ void try_to_interpolate(
                                               info.global_offsets);
     }
 
-    // Clear interpolated data, since we don't need it anymore.
+    // Clear interpolated data, since we don't need it anymore, and the
+    // cached interpolants of the elements that had no points.
     db::mutate<Tags::InterpolatedVarsHolders<Metavariables, VolumeDim>>(
         box, [&temporal_id](
                  const gsl::not_null<db::item_type<
                      Tags::InterpolatedVarsHolders<Metavariables, VolumeDim>>*>
                      holders_l) noexcept {
-          get<Vars::HolderTag<InterpolationTargetTag, Metavariables,
-                              VolumeDim>>(*holders_l)
-              .infos.erase(temporal_id);
+          auto& holder = get<Vars::HolderTag<InterpolationTargetTag,
+                                             Metavariables, VolumeDim>>(
+              *holders_l);
+          const auto& elements_with_points =
+              holder.infos.at(temporal_id).elements_with_points;
+          for (auto it = holder.cached_interpolants.begin();
+               it != holder.cached_interpolants.end();) {
+            if (elements_with_points.count(it->first) == 0) {
+              it = holder.cached_interpolants.erase(it);
+            } else {
+              ++it;
+            }
+          }
+          holder.infos.erase(temporal_id);
         });
   }
 }
@@ -6,7 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
-#include <vector>
+#include <utility>
 
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
@@ -14,6 +14,7 @@
 #include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/ScratchArena.hpp"
 
 namespace {
 void multiply_in_first_dimension(const gsl::not_null<double*> result,
@@ -42,14 +43,16 @@ void do_transpose(const gsl::not_null<double*> result, const double* const data,
 }
 
 struct Scratch {
-  std::vector<double> buffer;
+  ScratchArena::Checkpoint checkpoint;
   double* a;
   double* b;
 };
 
 // This does not take into account the order that the matrices are
 // applied in and gives the largest amount of space that could be
-// required for any application order.
+// required for any application order.  The memory is taken from the
+// thread's ScratchArena and is released when the Scratch goes out of
+// scope.
 template <typename MatrixType, size_t Dim>
 Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
                     const Index<Dim>& extents,
@@ -64,10 +67,12 @@ Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
                        dereference_wrapper(matrix).columns());
     }
   }
-  Scratch result{};
-  result.buffer.resize(2 * size);
-  result.a = &result.buffer[0];
-  result.b = &result.buffer[size];
+  auto& arena = ScratchArena::thread_local_instance();
+  Scratch result{ScratchArena::Checkpoint{make_not_null(&arena)}, nullptr,
+                 nullptr};
+  result.a = arena.allocate(2 * size);
+  // clang-tidy: pointer arithmetic
+  result.b = result.a + size;  // NOLINT
   return result;
 }
 
@@ -86,9 +91,127 @@ std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
   }
   return result;
 }
+
+// Contract the data along one axis with `matrix`.  The data is
+// treated as a three-dimensional array with extents `stride`,
+// `Columns`, and `number_of_slabs` (fastest varying first), and the
+// contraction is over the middle index.  The innermost loop runs
+// over contiguous points so it can be vectorized, with the sum over
+// the matrix columns fully unrolled.
+template <size_t Columns>
+void contract_axis(const gsl::not_null<double*> result, const Matrix& matrix,
+                   const double* const data, const size_t stride,
+                   const size_t number_of_slabs) noexcept {
+  const size_t rows = matrix.rows();
+  std::array<double,
+             Columns * apply_matrices_detail::max_sum_factorization_extent>
+      row_major_matrix{};
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < Columns; ++j) {
+      gsl::at(row_major_matrix, i * Columns + j) = matrix(i, j);
+    }
+  }
+  for (size_t slab = 0; slab < number_of_slabs; ++slab) {
+    // clang-tidy: pointer arithmetic
+    const double* const source = data + slab * Columns * stride;  // NOLINT
+    for (size_t i = 0; i < rows; ++i) {
+      const double* const row = &row_major_matrix[i * Columns];
+      double* const dest = result.get() + (slab * rows + i) * stride;  // NOLINT
+      for (size_t k = 0; k < stride; ++k) {
+        double sum = row[0] * source[k];  // NOLINT
+        for (size_t j = 1; j < Columns; ++j) {
+          sum += row[j] * source[j * stride + k];  // NOLINT
+        }
+        dest[k] = sum;  // NOLINT
+      }
+    }
+  }
+}
+
+using ContractAxisFunction = void (*)(gsl::not_null<double*>, const Matrix&,
+                                      const double*, size_t, size_t);
+
+template <size_t... Is>
+constexpr std::array<ContractAxisFunction, sizeof...(Is)>
+make_contract_axis_table(std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{&contract_axis<Is + 1>...}};
+}
+
+constexpr std::array<ContractAxisFunction,
+                     apply_matrices_detail::max_sum_factorization_extent>
+    contract_axis_table = make_contract_axis_table(
+        std::make_index_sequence<
+            apply_matrices_detail::max_sum_factorization_extent>{});
 }  // namespace
 
 namespace apply_matrices_detail {
+template <size_t Dim, typename MatrixType>
+void sum_factorized_apply(
+    const gsl::not_null<double*> result,
+    const std::array<MatrixType, Dim>& matrices, const double* const data,
+    const Index<Dim>& extents,
+    const size_t number_of_independent_components) noexcept {
+  std::array<size_t, Dim> axes_to_apply{};
+  size_t number_of_axes_to_apply = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    if (dereference_wrapper(gsl::at(matrices, d)) != Matrix{}) {
+      gsl::at(axes_to_apply, number_of_axes_to_apply) = d;
+      ++number_of_axes_to_apply;
+    }
+  }
+  if (number_of_axes_to_apply == 0) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::copy(data, data + number_of_independent_components * extents.product(),
+              result.get());
+    return;
+  }
+
+  // Identity dimensions don't change the memory layout, so the
+  // intermediate results only need to be stored for the applied
+  // dimensions, ping-ponging between the two scratch buffers.
+  const auto scratch =
+      get_scratch(matrices, extents, number_of_independent_components);
+  std::array<size_t, Dim> current_extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(current_extents, d) = extents[d];
+  }
+  const double* source = data;
+  for (size_t n = 0; n < number_of_axes_to_apply; ++n) {
+    const size_t axis = gsl::at(axes_to_apply, n);
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, axis));
+    size_t stride = 1;
+    for (size_t d = 0; d < axis; ++d) {
+      stride *= gsl::at(current_extents, d);
+    }
+    size_t number_of_slabs = number_of_independent_components;
+    for (size_t d = axis + 1; d < Dim; ++d) {
+      number_of_slabs *= gsl::at(current_extents, d);
+    }
+    double* const dest = n + 1 == number_of_axes_to_apply
+                             ? result.get()
+                             : (n % 2 == 0 ? scratch.a : scratch.b);
+    gsl::at(contract_axis_table, matrix.columns() - 1)(
+        dest, matrix, source, stride, number_of_slabs);
+    gsl::at(current_extents, axis) = matrix.rows();
+    source = dest;
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define MATRIX(data) BOOST_PP_TUPLE_ELEM(1, data)
+#define INSTANTIATE(_, data)                                           \
+  template void sum_factorized_apply(                                  \
+      const gsl::not_null<double*>,                                    \
+      const std::array<MATRIX(data), DIM(data)>&, const double* const, \
+      const Index<DIM(data)>&, const size_t) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (0, 1, 2, 3),
+                        (Matrix, std::reference_wrapper<const Matrix>))
+
+#undef DIM
+#undef MATRIX
+#undef INSTANTIATE
+
 template <size_t Dim, bool... DimensionIsIdentity>
 template <typename MatrixType>
 void Impl<Dim, DimensionIsIdentity...>::apply(
@@ -29,6 +29,48 @@ struct Impl {
                     size_t number_of_independent_components) noexcept;
 };
 
+/// The largest number of points in any dimension, either before or
+/// after applying the matrix, for which `sum_factorized_apply` is
+/// used instead of `Impl::apply`.
+constexpr size_t max_sum_factorization_extent = 16;
+
+/// Multiply by matrices in each dimension by contracting along each
+/// axis in turn without transposing the data.  The innermost loops
+/// are specialized on the number of columns of the matrix, so this
+/// is only valid if `use_sum_factorization` is true.
+template <size_t Dim, typename MatrixType>
+void sum_factorized_apply(gsl::not_null<double*> result,
+                          const std::array<MatrixType, Dim>& matrices,
+                          const double* data, const Index<Dim>& extents,
+                          size_t number_of_independent_components) noexcept;
+
+template <typename MatrixType, size_t Dim>
+bool use_sum_factorization(const std::array<MatrixType, Dim>& matrices,
+                           const Index<Dim>& extents) noexcept {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (extents[d] > max_sum_factorization_extent or
+        dereference_wrapper(gsl::at(matrices, d)).rows() >
+            max_sum_factorization_extent) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename MatrixType, size_t Dim>
+void apply(const gsl::not_null<double*> result,
+           const std::array<MatrixType, Dim>& matrices,
+           const double* const data, const Index<Dim>& extents,
+           const size_t number_of_independent_components) noexcept {
+  if (use_sum_factorization(matrices, extents)) {
+    sum_factorized_apply(result, matrices, data, extents,
+                         number_of_independent_components);
+  } else {
+    Impl<Dim>::apply(result, matrices, data, extents,
+                     number_of_independent_components);
+  }
+}
+
 template <typename MatrixType, size_t Dim>
 size_t result_size(const std::array<MatrixType, Dim>& matrices,
                    const Index<Dim>& extents) noexcept {
@@ -57,6 +99,13 @@ size_t result_size(const std::array<MatrixType, Dim>& matrices,
 /// `matrices[1]`, and so on.  If any of the matrices are empty they
 /// will be treated as the identity, but the matrix multiplications
 /// will be skipped for increased efficiency.
+///
+/// \details If no dimension has more than
+/// `apply_matrices_detail::max_sum_factorization_extent` points, the
+/// matrices are applied by a sum-factorization kernel specialized on
+/// the number of points in each dimension.  Otherwise each
+/// application is a BLAS matrix multiplication followed by a
+/// transpose.
 //@{
 template <typename VariableTags, typename MatrixType, size_t Dim>
 void apply_matrices(const gsl::not_null<Variables<VariableTags>*> result,
@@ -71,9 +120,8 @@ void apply_matrices(const gsl::not_null<Variables<VariableTags>*> result,
          "result has wrong size.  Expected "
          << apply_matrices_detail::result_size(matrices, extents)
          << ", received " << result->number_of_grid_points());
-  apply_matrices_detail::Impl<Dim>::apply(result->data(), matrices, u.data(),
-                                          extents,
-                                          u.number_of_independent_components);
+  apply_matrices_detail::apply(result->data(), matrices, u.data(), extents,
+                               u.number_of_independent_components);
 }
 
 template <typename VariableTags, typename MatrixType, size_t Dim>
@@ -98,8 +146,7 @@ void apply_matrices(const gsl::not_null<DataVector*> result,
          "result has wrong size.  Expected "
          << apply_matrices_detail::result_size(matrices, extents)
          << ", received " << result->size());
-  apply_matrices_detail::Impl<Dim>::apply(result->data(), matrices, u.data(),
-                                          extents, 1);
+  apply_matrices_detail::apply(result->data(), matrices, u.data(), extents, 1);
 }
 
 template <typename MatrixType, size_t Dim>
@@ -8,7 +8,9 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Variables.hpp"
@@ -130,6 +132,34 @@ auto partial_derivatives(
                                   tmpl::size_t<Dim>, DerivativeFrame>>;
 // @}
 
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Compute the partial derivatives of each variable in several
+/// elements that share the same `Mesh`.
+///
+/// \details The variables of all elements are gathered into one contiguous
+/// buffer so that the logical derivatives of every element are computed with
+/// a single matrix multiplication per logical direction, rather than one
+/// small multiplication per element and direction.  This is most beneficial
+/// at low resolution, where the per-call overhead of the BLAS routines
+/// dominates.  The logical derivatives are then transformed to
+/// `DerivativeFrame` using the inverse Jacobian of each element.  The result
+/// is identical to calling `partial_derivatives` on each element separately.
+///
+/// \requires `DerivativeTags` to be the head of `VariableTags`, and `du`,
+/// `u`, and `inverse_jacobians` to have the same size.
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void batched_partial_derivatives(
+    const std::vector<gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>>&
+        du,
+    const std::vector<std::reference_wrapper<const Variables<VariableTags>>>&
+        u,
+    const Mesh<Dim>& mesh,
+    const std::vector<std::reference_wrapper<const InverseJacobian<
+        DataVector, Dim, Frame::Logical, DerivativeFrame>>>&
+        inverse_jacobians) noexcept;
+
 namespace Tags {
 
 /*!
@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
@@ -17,10 +21,16 @@
 #include "Utilities/Blas.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/ScratchArena.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 
 namespace partial_derivatives_detail {
-template <size_t Dim, typename VariableTags, typename DerivativeTags>
+// Computes the logical derivatives of the first `deriv_size` entries of the
+// contiguous data `u`, which is treated as a sequence of components on the
+// grid described by `mesh`.  The `apply` function takes a buffer of size
+// `deriv_size`, which is used as temporary storage in 2D and 3D.  Other
+// temporaries are taken from the thread's ScratchArena.
+template <size_t Dim>
 struct LogicalImpl;
 
 // This routine has been optimized to perform really well. The following
@@ -124,16 +134,18 @@ void logical_partial_derivatives(
     gsl::at(deriv_pointers, i) =
         gsl::at(*logical_partial_derivatives_of_u, i).data();
   }
-  if (Dim == 1) {
-    Variables<DerivativeTags>* temp = nullptr;
-    partial_derivatives_detail::LogicalImpl<Dim, VariableTags, DerivativeTags>::
-        apply(make_not_null(&deriv_pointers), temp, u, mesh);
-    return;
-  }
-  Variables<DerivativeTags> temp(u.number_of_grid_points());
-  partial_derivatives_detail::LogicalImpl<
-      Dim, VariableTags, DerivativeTags>::apply(make_not_null(&deriv_pointers),
-                                                &temp, u, mesh);
+  // The temporary buffer is only needed in 2D and 3D.
+  auto& arena = ScratchArena::thread_local_instance();
+  const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+  constexpr size_t number_of_independent_components =
+      Variables<DerivativeTags>::number_of_independent_components;
+  const size_t temp_size =
+      Dim == 1 ? 0
+               : u.number_of_grid_points() * number_of_independent_components;
+  double* const temp = arena.allocate(temp_size);
+  partial_derivatives_detail::LogicalImpl<Dim>::apply(
+      make_not_null(&deriv_pointers), temp, u.data(),
+      u.number_of_grid_points() * number_of_independent_components, mesh);
 }
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
@@ -189,26 +201,23 @@ void partial_derivatives(
     partial_derivatives_of_u.initialize(mesh.number_of_grid_points());
   }
 
-  // Using malloc instead of new is faster because we do not need to zero the
-  // data.
-  // clang-tidy: cppcoreguidelines-no-malloc
-  std::unique_ptr<double[], decltype(&free)> logical_derivs_data(
-      static_cast<double*>(
-          malloc(Dim * u.number_of_grid_points() *  // NOLINT
-                 Variables<DerivativeTags>::number_of_independent_components *
-                 sizeof(double))),
-      &free);
+  // The logical derivatives are taken from the thread's ScratchArena so that
+  // no memory is allocated in the steady state, and are not zeroed.
+  const size_t logical_deriv_size =
+      u.number_of_grid_points() *
+      Variables<DerivativeTags>::number_of_independent_components;
+  auto& arena = ScratchArena::thread_local_instance();
+  const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+  double* const logical_derivs_data = arena.allocate(Dim * logical_deriv_size);
   std::array<double*, Dim> logical_derivs{};
   for (size_t i = 0; i < Dim; ++i) {
+    // clang-tidy: pointer arithmetic
     gsl::at(logical_derivs, i) =
-        &(logical_derivs_data
-              [i * u.number_of_grid_points() *
-               Variables<DerivativeTags>::number_of_independent_components]);
+        logical_derivs_data + i * logical_deriv_size;  // NOLINT
   }
-  partial_derivatives_detail::LogicalImpl<
-      Dim, VariableTags, DerivativeTags>::apply(make_not_null(&logical_derivs),
-                                                &partial_derivatives_of_u, u,
-                                                mesh);
+  partial_derivatives_detail::LogicalImpl<Dim>::apply(
+      make_not_null(&logical_derivs), partial_derivatives_of_u.data(), u.data(),
+      logical_deriv_size, mesh);
 
   std::array<const double*, Dim> const_logical_derivs{};
   for (size_t i = 0; i < Dim; ++i) {
@@ -235,121 +244,178 @@ partial_derivatives(
   return partial_derivatives_of_u;
 }
 
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void batched_partial_derivatives(
+    const std::vector<gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>>&
+        du,
+    const std::vector<std::reference_wrapper<const Variables<VariableTags>>>&
+        u,
+    const Mesh<Dim>& mesh,
+    const std::vector<std::reference_wrapper<const InverseJacobian<
+        DataVector, Dim, Frame::Logical, DerivativeFrame>>>&
+        inverse_jacobians) noexcept {
+  ASSERT(du.size() == u.size() and u.size() == inverse_jacobians.size(),
+         "The number of elements must be the same for all arguments, but got "
+             << du.size() << " results, " << u.size() << " inputs, and "
+             << inverse_jacobians.size() << " inverse Jacobians.");
+  const size_t number_of_elements = u.size();
+  if (number_of_elements == 0) {
+    return;
+  }
+  const size_t num_grid_points = mesh.number_of_grid_points();
+  const size_t deriv_size =
+      num_grid_points *
+      Variables<DerivativeTags>::number_of_independent_components;
+  const size_t total_size = number_of_elements * deriv_size;
+
+  // Gather the variables being differentiated into one contiguous buffer.
+  // Since the components of a Variables are stored one after the other, the
+  // gathered buffer looks like a single Variables with
+  // `number_of_elements` times as many components, so the logical
+  // derivatives of all elements are computed at once.
+  auto& arena = ScratchArena::thread_local_instance();
+  const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+  double* const gathered_u = arena.allocate(total_size);
+  for (size_t element = 0; element < number_of_elements; ++element) {
+    const Variables<VariableTags>& u_element = u[element];
+    ASSERT(u_element.number_of_grid_points() == num_grid_points,
+           "All elements must have the same number of grid points as the "
+           "mesh, "
+               << num_grid_points << ", but element " << element << " has "
+               << u_element.number_of_grid_points());
+    // clang-tidy: pointer arithmetic
+    std::copy(u_element.data(), u_element.data() + deriv_size,  // NOLINT
+              gathered_u + element * deriv_size);               // NOLINT
+  }
+
+  double* const logical_derivs_data = arena.allocate(Dim * total_size);
+  std::array<double*, Dim> logical_derivs{};
+  for (size_t i = 0; i < Dim; ++i) {
+    // clang-tidy: pointer arithmetic
+    gsl::at(logical_derivs, i) =
+        logical_derivs_data + i * total_size;  // NOLINT
+  }
+  double* const temp = arena.allocate(Dim == 1 ? 0 : total_size);
+  partial_derivatives_detail::LogicalImpl<Dim>::apply(
+      make_not_null(&logical_derivs), temp, gathered_u, total_size, mesh);
+
+  for (size_t element = 0; element < number_of_elements; ++element) {
+    auto& partial_derivatives_of_u = *du[element];
+    // For mutating compute items we must set the size.
+    if (UNLIKELY(partial_derivatives_of_u.number_of_grid_points() !=
+                 num_grid_points)) {
+      partial_derivatives_of_u.initialize(num_grid_points);
+    }
+    std::array<const double*, Dim> element_logical_derivs{};
+    for (size_t i = 0; i < Dim; ++i) {
+      // clang-tidy: pointer arithmetic
+      gsl::at(element_logical_derivs, i) =
+          gsl::at(logical_derivs, i) + element * deriv_size;  // NOLINT
+    }
+    partial_derivatives_detail::partial_derivatives_impl<DerivativeTags>(
+        make_not_null(&partial_derivatives_of_u), element_logical_derivs,
+        inverse_jacobians[element].get());
+  }
+}
+
 namespace partial_derivatives_detail {
-template <typename VariableTags, typename DerivativeTags>
-struct LogicalImpl<1, VariableTags, DerivativeTags> {
+template <>
+struct LogicalImpl<1> {
   static constexpr const size_t Dim = 1;
-  template <typename T>
   static void apply(const gsl::not_null<std::array<double*, Dim>*> logical_du,
-                    Variables<T>* /*unused_in_1d*/,
-                    const Variables<VariableTags>& u,
-                    const Mesh<Dim>& mesh) noexcept {
+                    double* const /*unused_in_1d*/, const double* const u,
+                    const size_t deriv_size, const Mesh<Dim>& mesh) noexcept {
     auto& logical_partial_derivatives_of_u = *logical_du;
-    const size_t deriv_size =
-        Variables<DerivativeTags>::number_of_independent_components *
-        u.number_of_grid_points();
     const Matrix& differentiation_matrix_xi =
         Spectral::differentiation_matrix(mesh.slice_through(0));
     dgemm_<true>('N', 'N', mesh.extents(0), deriv_size / mesh.extents(0),
                  mesh.extents(0), 1.0, differentiation_matrix_xi.data(),
-                 mesh.extents(0), u.data(), mesh.extents(0), 0.0,
+                 mesh.extents(0), u, mesh.extents(0), 0.0,
                  logical_partial_derivatives_of_u[0], mesh.extents(0));
   }
 };
 
-template <typename VariableTags, typename DerivativeTags>
-struct LogicalImpl<2, VariableTags, DerivativeTags> {
+template <>
+struct LogicalImpl<2> {
   static constexpr size_t Dim = 2;
-  template <typename T>
   static void apply(const gsl::not_null<std::array<double*, Dim>*> logical_du,
-                    Variables<T>* const partial_u_wrt_eta,
-                    const Variables<VariableTags>& u,
-                    const Mesh<2>& mesh) noexcept {
-    static_assert(
-        Variables<DerivativeTags>::number_of_independent_components <=
-            Variables<T>::number_of_independent_components,
-        "Temporary buffer in logical partial derivatives is too small");
+                    double* const partial_u_wrt_eta, const double* const u,
+                    const size_t deriv_size, const Mesh<2>& mesh) noexcept {
     auto& logical_partial_derivatives_of_u = *logical_du;
-    const size_t deriv_size =
-        Variables<DerivativeTags>::number_of_independent_components *
-        u.number_of_grid_points();
     const Matrix& differentiation_matrix_xi =
         Spectral::differentiation_matrix(mesh.slice_through(0));
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
     dgemm_<true>('N', 'N', mesh.extents(0), num_components_times_xi_slices,
                  mesh.extents(0), 1.0, differentiation_matrix_xi.data(),
-                 mesh.extents(0), u.data(), mesh.extents(0), 0.0,
+                 mesh.extents(0), u, mesh.extents(0), 0.0,
                  logical_partial_derivatives_of_u[0], mesh.extents(0));
 
-    const auto u_eta_fastest =
-        transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
-            u, mesh.extents(0), num_components_times_xi_slices);
+    auto& arena = ScratchArena::thread_local_instance();
+    const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+    double* const u_eta_fastest = arena.allocate(deriv_size);
+    raw_transpose(make_not_null(u_eta_fastest), u, mesh.extents(0),
+                  num_components_times_xi_slices);
     const Matrix& differentiation_matrix_eta =
         Spectral::differentiation_matrix(mesh.slice_through(1));
     const size_t num_components_times_eta_slices = deriv_size / mesh.extents(1);
     dgemm_<true>('N', 'N', mesh.extents(1), num_components_times_eta_slices,
                  mesh.extents(1), 1.0, differentiation_matrix_eta.data(),
-                 mesh.extents(1), u_eta_fastest.data(), mesh.extents(1), 0.0,
-                 partial_u_wrt_eta->data(), mesh.extents(1));
+                 mesh.extents(1), u_eta_fastest, mesh.extents(1), 0.0,
+                 partial_u_wrt_eta, mesh.extents(1));
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[1]),
-                  partial_u_wrt_eta->data(), num_components_times_xi_slices,
+                  partial_u_wrt_eta, num_components_times_xi_slices,
                   mesh.extents(0));
   }
 };
 
-template <typename VariableTags, typename DerivativeTags>
-struct LogicalImpl<3, VariableTags, DerivativeTags> {
+template <>
+struct LogicalImpl<3> {
   static constexpr size_t Dim = 3;
-  template <class T>
   static void apply(const gsl::not_null<std::array<double*, Dim>*> logical_du,
-                    Variables<T>* const partial_u_wrt_eta_or_zeta,
-                    const Variables<VariableTags>& u,
+                    double* const partial_u_wrt_eta_or_zeta,
+                    const double* const u, const size_t deriv_size,
                     const Mesh<3>& mesh) noexcept {
-    static_assert(
-        Variables<DerivativeTags>::number_of_independent_components <=
-            Variables<T>::number_of_independent_components,
-        "Temporary buffer in logical partial derivatives is too small");
     auto& logical_partial_derivatives_of_u = *logical_du;
     const Matrix& differentiation_matrix_xi =
         Spectral::differentiation_matrix(mesh.slice_through(0));
-    const size_t deriv_size =
-        Variables<DerivativeTags>::number_of_independent_components *
-        u.number_of_grid_points();
     const size_t num_components_times_xi_slices = deriv_size / mesh.extents(0);
     dgemm_<true>('N', 'N', mesh.extents(0), num_components_times_xi_slices,
                  mesh.extents(0), 1.0, differentiation_matrix_xi.data(),
-                 mesh.extents(0), u.data(), mesh.extents(0), 0.0,
+                 mesh.extents(0), u, mesh.extents(0), 0.0,
                  logical_partial_derivatives_of_u[0], mesh.extents(0));
 
-    auto u_eta_or_zeta_fastest =
-        transpose<Variables<VariableTags>, Variables<DerivativeTags>>(
-            u, mesh.extents(0), num_components_times_xi_slices);
+    auto& arena = ScratchArena::thread_local_instance();
+    const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+    double* const u_eta_or_zeta_fastest = arena.allocate(deriv_size);
+    raw_transpose(make_not_null(u_eta_or_zeta_fastest), u, mesh.extents(0),
+                  num_components_times_xi_slices);
     const Matrix& differentiation_matrix_eta =
         Spectral::differentiation_matrix(mesh.slice_through(1));
     const size_t num_components_times_eta_slices = deriv_size / mesh.extents(1);
     dgemm_<true>('N', 'N', mesh.extents(1), num_components_times_eta_slices,
                  mesh.extents(1), 1.0, differentiation_matrix_eta.data(),
-                 mesh.extents(1), u_eta_or_zeta_fastest.data(), mesh.extents(1),
-                 0.0, partial_u_wrt_eta_or_zeta->data(), mesh.extents(1));
+                 mesh.extents(1), u_eta_or_zeta_fastest, mesh.extents(1), 0.0,
+                 partial_u_wrt_eta_or_zeta, mesh.extents(1));
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[1]),
-                  partial_u_wrt_eta_or_zeta->data(),
-                  num_components_times_xi_slices, mesh.extents(0));
+                  partial_u_wrt_eta_or_zeta, num_components_times_xi_slices,
+                  mesh.extents(0));
 
     const size_t chunk_size = mesh.extents(0) * mesh.extents(1);
     const size_t number_of_chunks = deriv_size / chunk_size;
-    transpose(make_not_null(&u_eta_or_zeta_fastest), u, chunk_size,
-              number_of_chunks);
+    raw_transpose(make_not_null(u_eta_or_zeta_fastest), u, chunk_size,
+                  number_of_chunks);
     const Matrix& differentiation_matrix_zeta =
         Spectral::differentiation_matrix(mesh.slice_through(2));
     const size_t num_components_times_zeta_slices =
         deriv_size / mesh.extents(2);
     dgemm_<true>('N', 'N', mesh.extents(2), num_components_times_zeta_slices,
                  mesh.extents(2), 1.0, differentiation_matrix_zeta.data(),
-                 mesh.extents(2), u_eta_or_zeta_fastest.data(), mesh.extents(2),
-                 0.0, partial_u_wrt_eta_or_zeta->data(), mesh.extents(2));
+                 mesh.extents(2), u_eta_or_zeta_fastest, mesh.extents(2), 0.0,
+                 partial_u_wrt_eta_or_zeta, mesh.extents(2));
     raw_transpose(make_not_null(logical_partial_derivatives_of_u[2]),
-                  partial_u_wrt_eta_or_zeta->data(), number_of_chunks,
-                  chunk_size);
+                  partial_u_wrt_eta_or_zeta, number_of_chunks, chunk_size);
   }
 };
 }  // namespace partial_derivatives_detail
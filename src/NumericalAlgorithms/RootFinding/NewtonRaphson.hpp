@@ -6,12 +6,20 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/math/tools/roots.hpp>
+#include <cstddef>
 #include <functional>
 #include <limits>
+#include <sstream>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Exceptions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TypeTraits.hpp"
 
 namespace RootFinder {
 /*!
@@ -76,8 +84,12 @@ double newton_raphson(const Function& f, const double initial_guess,
  *
  * \throws `convergence_error` if, for any index, the requested precision is not
  * met after `max_iterations` iterations.
+ *
+ * \see The overload taking a function of a `DataVector`, which finds the roots
+ * at all indices simultaneously.
  */
-template <typename Function>
+template <typename Function,
+          Requires<tt::is_callable_v<Function, double, size_t>> = nullptr>
 DataVector newton_raphson(const Function& f, const DataVector& initial_guess,
                           const DataVector& lower_bound,
                           const DataVector& upper_bound, const size_t digits,
@@ -105,4 +117,185 @@ DataVector newton_raphson(const Function& f, const DataVector& initial_guess,
   return result_vector;
 }
 
+namespace newton_raphson_detail {
+// The state of the Newton-Raphson iteration at one index, following
+// `boost::math::tools::newton_raphson_iterate`.
+struct Lane {
+  double result = std::numeric_limits<double>::signaling_NaN();
+  double min = std::numeric_limits<double>::signaling_NaN();
+  double max = std::numeric_limits<double>::signaling_NaN();
+  double f0 = 0.0;
+  double delta = std::numeric_limits<double>::max();
+  double delta1 = std::numeric_limits<double>::max();
+  double delta2 = std::numeric_limits<double>::max();
+  double max_range_f = 0.0;
+  double min_range_f = 0.0;
+  size_t count = 0;
+  bool finished = false;
+};
+
+// Takes one step of the iteration at `lane`, given the value `f0` and
+// derivative `f1` of the function at `lane.result`.
+inline void update(const gsl::not_null<Lane*> lane, const double f0,
+                   const double f1, const double factor) {
+  const double last_f0 = lane->f0;
+  lane->f0 = f0;
+  lane->delta2 = lane->delta1;
+  lane->delta1 = lane->delta;
+  --lane->count;
+  if (f0 == 0.0) {
+    lane->finished = true;
+    return;
+  }
+  double& delta = lane->delta;
+  double& result = lane->result;
+  if (f1 == 0.0) {
+    if (last_f0 == 0.0) {
+      // This is the first iteration, so there is no previous step to
+      // compare with. Rather than evaluating the function at one of the
+      // bounds, as the scalar overload does, step halfway towards the middle
+      // of the interval.
+      delta = 0.5 * (result - 0.5 * (lane->min + lane->max));
+    } else if (boost::math::sign(last_f0) * boost::math::sign(f0) < 0) {
+      // we've crossed over so move in opposite direction to last step
+      delta = delta < 0.0 ? 0.5 * (result - lane->min)
+                          : 0.5 * (result - lane->max);
+    } else {
+      // move in same direction as last step
+      delta = delta < 0.0 ? 0.5 * (result - lane->max)
+                          : 0.5 * (result - lane->min);
+    }
+  } else {
+    delta = f0 / f1;
+  }
+  if (fabs(delta * 2.0) > fabs(lane->delta2)) {
+    // Last two steps haven't converged.
+    const double shift = delta > 0.0 ? 0.5 * (result - lane->min)
+                                     : 0.5 * (result - lane->max);
+    if (result != 0.0 and fabs(shift) > fabs(result)) {
+      // Protect against huge jumps
+      delta = boost::math::sign(delta) * fabs(result) * 1.1;
+    } else {
+      delta = shift;
+    }
+    // reset delta1/2 so we don't take this branch next time round
+    lane->delta1 = 3.0 * delta;
+    lane->delta2 = 3.0 * delta;
+  }
+  const double guess = result;
+  result -= delta;
+  if (result <= lane->min or result >= lane->max) {
+    delta = 0.5 * (guess - (result <= lane->min ? lane->min : lane->max));
+    result = guess - delta;
+    if (result == lane->min or result == lane->max) {
+      lane->finished = true;
+      return;
+    }
+  }
+  // Update brackets
+  if (delta > 0.0) {
+    lane->max = guess;
+    lane->max_range_f = f0;
+  } else {
+    lane->min = guess;
+    lane->min_range_f = f0;
+  }
+  if (lane->max_range_f * lane->min_range_f > 0.0) {
+    std::ostringstream os;
+    os << "There appears to be no root to be found in "
+          "RootFinder::newton_raphson, perhaps we have a local minima near "
+          "current best guess of "
+       << guess;
+    throw boost::math::evaluation_error(os.str());
+  }
+  lane->finished =
+      lane->count == 0 or not(fabs(result * factor) < fabs(delta));
+}
+}  // namespace newton_raphson_detail
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Finds the roots of the function `f` with the Newton-Raphson method at
+ * all indices of a `DataVector` simultaneously.
+ *
+ * `f` is a unary invokable that takes a `DataVector` holding the current
+ * value at each index and returns a `std::pair` of `DataVector`s holding the
+ * values and derivatives of the function at each index. Each iteration is done
+ * for all indices that have not yet converged, and `f` is evaluated once per
+ * iteration for all indices, so the function evaluations can be vectorized.
+ * Indices that have converged are held fixed, and `f` is still evaluated at
+ * them.
+ *
+ * The iteration at each index is that of the scalar overload, except when the
+ * derivative vanishes on the first iteration: instead of evaluating `f` at one
+ * of the bounds, a step halfway towards the middle of the interval is taken.
+ *
+ * \snippet Test_NewtonRaphson.cpp vectorized_newton_raphson_root_find
+ *
+ * \requires Function `f` be callable with a `DataVector`
+ * \note The parameter `digits` specifies the precision of the result in its
+ * desired number of base-10 digits.
+ *
+ * \throws `convergence_error` if, for any index, the requested precision is not
+ * met after `max_iterations` iterations.
+ */
+template <typename Function,
+          Requires<tt::is_callable_v<Function, DataVector>> = nullptr>
+DataVector newton_raphson(const Function& f, const DataVector& initial_guess,
+                          const DataVector& lower_bound,
+                          const DataVector& upper_bound, const size_t digits,
+                          const size_t max_iterations = 50) {
+  ASSERT(digits < std::numeric_limits<double>::digits10,
+         "The desired accuracy of " << digits
+                                    << " base-10 digits must be smaller than "
+                                       "the machine numeric limit of "
+                                    << std::numeric_limits<double>::digits10
+                                    << " base-10 digits.");
+  using newton_raphson_detail::Lane;
+  const double factor = ldexp(
+      1.0, 1 - static_cast<int>(std::round(std::log2(std::pow(10, digits)))));
+
+  const size_t size = initial_guess.size();
+  std::vector<Lane> lanes(size);
+  DataVector result_vector = initial_guess;
+  for (size_t i = 0; i < size; ++i) {
+    Lane& lane = lanes[i];
+    lane.result = initial_guess[i];
+    lane.min = lower_bound[i];
+    lane.max = upper_bound[i];
+    lane.count = max_iterations;
+    if (lane.min >= lane.max) {
+      std::ostringstream os;
+      os << "Range arguments in wrong order in RootFinder::newton_raphson "
+            "(first arg="
+         << lane.min << ")";
+      throw boost::math::evaluation_error(os.str());
+    }
+    lane.finished = max_iterations == 0;
+  }
+
+  const auto not_finished = [](const Lane& lane) noexcept {
+    return not lane.finished;
+  };
+  while (std::any_of(lanes.begin(), lanes.end(), not_finished)) {
+    const auto values_and_derivatives = f(result_vector);
+    for (size_t i = 0; i < size; ++i) {
+      if (not lanes[i].finished) {
+        newton_raphson_detail::update(make_not_null(&lanes[i]),
+                                      values_and_derivatives.first[i],
+                                      values_and_derivatives.second[i],
+                                      factor);
+        result_vector[i] = lanes[i].result;
+      }
+    }
+  }
+
+  for (const auto& lane : lanes) {
+    if (lane.count == 0) {
+      throw convergence_error(
+          "newton_raphson reached max iterations without converging");
+    }
+  }
+  return result_vector;
+}
 }  // namespace RootFinder
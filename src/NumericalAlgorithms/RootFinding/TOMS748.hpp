@@ -6,12 +6,21 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/math/tools/roots.hpp>
+#include <cstddef>
 #include <functional>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Exceptions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TypeTraits.hpp"
 
 namespace RootFinder {
 
@@ -90,8 +99,12 @@ double toms748(const Function& f, const double lower_bound,
  * root.
  * \throws `convergence_error` if, for any index, the requested tolerance is not
  * met after `max_iterations` iterations.
+ *
+ * \see The overload taking a function of a `DataVector`, which finds the roots
+ * at all indices simultaneously.
  */
-template <typename Function>
+template <typename Function,
+          Requires<tt::is_callable_v<Function, double, size_t>> = nullptr>
 DataVector toms748(const Function& f, const DataVector& lower_bound,
                    const DataVector& upper_bound,
                    const double absolute_tolerance,
@@ -127,4 +140,271 @@ DataVector toms748(const Function& f, const DataVector& lower_bound,
   return result_vector;
 }
 
+namespace toms748_detail {
+// The state of the TOMS_748 algorithm at one index.  The algorithm is that of
+// `boost::math::tools::toms748_solve`, split into steps that each end with
+// one evaluation of the function, so that the evaluations at all indices can
+// be done together.
+struct Lane {
+  // The step that is taken next.  The first two steps are only taken once,
+  // after which the algorithm cycles through the last four.
+  enum class Step {
+    Secant,
+    Quadratic,
+    FirstInterpolation,
+    SecondInterpolation,
+    DoubleSecant,
+    Bisection,
+    Finished
+  };
+  Step step = Step::Secant;
+  double a = std::numeric_limits<double>::signaling_NaN();
+  double b = std::numeric_limits<double>::signaling_NaN();
+  double d = 1.0e5;
+  double e = 1.0e5;
+  double fa = std::numeric_limits<double>::signaling_NaN();
+  double fb = std::numeric_limits<double>::signaling_NaN();
+  double fd = 1.0e5;
+  double fe = 1.0e5;
+  double a0 = std::numeric_limits<double>::signaling_NaN();
+  double b0 = std::numeric_limits<double>::signaling_NaN();
+  size_t count = 0;
+};
+
+// Returns true if neither a cubic step nor a step that divides by differences
+// of function values is safe.
+inline bool use_quadratic_step(const Lane& lane) noexcept {
+  const double min_diff = std::numeric_limits<double>::min() * 32.0;
+  return fabs(lane.fa - lane.fb) < min_diff or
+         fabs(lane.fa - lane.fd) < min_diff or
+         fabs(lane.fa - lane.fe) < min_diff or
+         fabs(lane.fb - lane.fd) < min_diff or
+         fabs(lane.fb - lane.fe) < min_diff or
+         fabs(lane.fd - lane.fe) < min_diff;
+}
+
+// Returns the point at which the function is evaluated in the next step of
+// `lane`, and updates the state that depends only on the step being taken.
+inline double trial_point(const gsl::not_null<Lane*> lane) noexcept {
+  namespace detail = boost::math::tools::detail;
+  using Step = Lane::Step;
+  double c = lane->a;
+  if (lane->step == Step::Bisection and
+      lane->b - lane->a < 0.5 * (lane->b0 - lane->a0)) {
+    // The interval has shrunk enough that bisection is not needed.
+    lane->step = Step::FirstInterpolation;
+  }
+  switch (lane->step) {
+    case Step::Secant:
+      c = detail::secant_interpolate(lane->a, lane->b, lane->fa, lane->fb);
+      break;
+    case Step::Quadratic:
+      c = detail::quadratic_interpolate(lane->a, lane->b, lane->d, lane->fa,
+                                        lane->fb, lane->fd, 2);
+      lane->e = lane->d;
+      lane->fe = lane->fd;
+      break;
+    case Step::FirstInterpolation:
+      lane->a0 = lane->a;
+      lane->b0 = lane->b;
+      c = use_quadratic_step(*lane)
+              ? detail::quadratic_interpolate(lane->a, lane->b, lane->d,
+                                              lane->fa, lane->fb, lane->fd, 2)
+              : detail::cubic_interpolate(lane->a, lane->b, lane->d, lane->e,
+                                          lane->fa, lane->fb, lane->fd,
+                                          lane->fe);
+      lane->e = lane->d;
+      lane->fe = lane->fd;
+      break;
+    case Step::SecondInterpolation:
+      c = use_quadratic_step(*lane)
+              ? detail::quadratic_interpolate(lane->a, lane->b, lane->d,
+                                              lane->fa, lane->fb, lane->fd, 3)
+              : detail::cubic_interpolate(lane->a, lane->b, lane->d, lane->e,
+                                          lane->fa, lane->fb, lane->fd,
+                                          lane->fe);
+      break;
+    case Step::DoubleSecant: {
+      const bool a_is_closer = fabs(lane->fa) < fabs(lane->fb);
+      const double u = a_is_closer ? lane->a : lane->b;
+      const double fu = a_is_closer ? lane->fa : lane->fb;
+      c = u - 2.0 * (fu / (lane->fb - lane->fa)) * (lane->b - lane->a);
+      if (fabs(c - u) > 0.5 * (lane->b - lane->a)) {
+        c = lane->a + 0.5 * (lane->b - lane->a);
+      }
+      lane->e = lane->d;
+      lane->fe = lane->fd;
+      break;
+    }
+    case Step::Bisection:
+      c = lane->a + 0.5 * (lane->b - lane->a);
+      lane->e = lane->d;
+      lane->fe = lane->fd;
+      break;
+    case Step::Finished:
+      return lane->a;
+  }
+
+  // Keep the trial point away from the ends of the interval, as in
+  // `boost::math::tools::detail::bracket`.
+  const double tol = 2.0 * std::numeric_limits<double>::epsilon();
+  if (lane->b - lane->a < 2.0 * tol * lane->a) {
+    c = lane->a + 0.5 * (lane->b - lane->a);
+  } else if (c <= lane->a + fabs(lane->a) * tol) {
+    c = lane->a + fabs(lane->a) * tol;
+  } else if (c >= lane->b - fabs(lane->b) * tol) {
+    c = lane->b - fabs(lane->b) * tol;
+  }
+  return c;
+}
+
+// Updates the interval of `lane` with the value `fc` of the function at the
+// trial point `c`, and advances to the next step.
+template <typename Tolerance>
+void update(const gsl::not_null<Lane*> lane, const double c, const double fc,
+            const Tolerance& tol) noexcept {
+  using Step = Lane::Step;
+  if (fc == 0.0) {
+    lane->a = c;
+    lane->fa = 0.0;
+    lane->d = 0.0;
+    lane->fd = 0.0;
+  } else if (boost::math::sign(lane->fa) * boost::math::sign(fc) < 0) {
+    lane->d = lane->b;
+    lane->fd = lane->fb;
+    lane->b = c;
+    lane->fb = fc;
+  } else {
+    lane->d = lane->a;
+    lane->fd = lane->fa;
+    lane->a = c;
+    lane->fa = fc;
+  }
+  --lane->count;
+
+  if (lane->count == 0 or lane->fa == 0.0 or tol(lane->a, lane->b)) {
+    lane->step = Step::Finished;
+  } else if (lane->step == Step::Bisection) {
+    lane->step = Step::FirstInterpolation;
+  } else {
+    lane->step = static_cast<Step>(static_cast<int>(lane->step) + 1);
+  }
+}
+}  // namespace toms748_detail
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Finds the roots of the function `f` with the TOMS_748 method at all
+ * indices of a `DataVector` simultaneously.
+ *
+ * `f` is a unary invokable that takes a `DataVector` holding the current
+ * value at each index and returns a `DataVector` of the function values at
+ * each index. Each iteration of the TOMS_748 algorithm is done for all indices
+ * that have not yet converged, and `f` is evaluated once per iteration for all
+ * indices, so the function evaluations can be vectorized. Indices that have
+ * converged are held fixed, and `f` is still evaluated at them. The result at
+ * each index is the same as that of the scalar overload.
+ *
+ * \snippet Test_TOMS748.cpp vectorized_root_find
+ *
+ * For each index `i` into the DataVector, the TOMS_748 algorithm searches for a
+ * root in the interval [`lower_bound[i]`, `upper_bound[i]`].
+ *
+ * \requires Function `f` be callable with a `DataVector`
+ *
+ * \throws `std::domain_error` if, for any index, the bounds do not bracket a
+ * root.
+ * \throws `convergence_error` if, for any index, the requested tolerance is not
+ * met after `max_iterations` iterations.
+ */
+template <typename Function,
+          Requires<tt::is_callable_v<Function, DataVector>> = nullptr>
+DataVector toms748(const Function& f, const DataVector& lower_bound,
+                   const DataVector& upper_bound,
+                   const double absolute_tolerance,
+                   const double relative_tolerance,
+                   const size_t max_iterations = 100) {
+  ASSERT(relative_tolerance > std::numeric_limits<double>::epsilon(),
+         "The relative tolerance is too small.");
+  ASSERT(lower_bound.size() == upper_bound.size(),
+         "The bounds must have the same size, not " << lower_bound.size()
+                                                    << " and "
+                                                    << upper_bound.size());
+  using toms748_detail::Lane;
+  // This termination condition is equivalent to the convergence criteria used
+  // by the GSL
+  const auto tol = [absolute_tolerance, relative_tolerance](
+      const double lhs, const double rhs) noexcept {
+    return (fabs(lhs - rhs) <=
+            absolute_tolerance +
+                relative_tolerance * fmin(fabs(lhs), fabs(rhs)));
+  };
+  // Two iterations are used to evaluate `f` at the bounds, to match the
+  // iteration count of the scalar overload.
+  if (max_iterations <= 2) {
+    throw convergence_error(
+        "toms748 reached max iterations without converging");
+  }
+
+  const size_t size = lower_bound.size();
+  std::vector<Lane> lanes(size);
+  const DataVector f_at_lower_bound = f(lower_bound);
+  const DataVector f_at_upper_bound = f(upper_bound);
+  for (size_t i = 0; i < size; ++i) {
+    Lane& lane = lanes[i];
+    lane.a = lower_bound[i];
+    lane.b = upper_bound[i];
+    lane.fa = f_at_lower_bound[i];
+    lane.fb = f_at_upper_bound[i];
+    lane.count = max_iterations - 2;
+    const auto domain_error = [&lane](const std::string& message) {
+      std::ostringstream os;
+      os << "Error in function RootFinder::toms748: " << message
+         << ": a=" << lane.a;
+      throw std::domain_error(os.str());
+    };
+    if (lane.a >= lane.b) {
+      domain_error("Parameters a and b out of order");
+    }
+    if (tol(lane.a, lane.b) or lane.fa == 0.0 or lane.fb == 0.0) {
+      lane.step = Lane::Step::Finished;
+    } else if (boost::math::sign(lane.fa) * boost::math::sign(lane.fb) > 0) {
+      domain_error("Parameters a and b do not bracket the root");
+    }
+  }
+
+  DataVector trial_points(size);
+  const auto not_finished = [](const Lane& lane) noexcept {
+    return lane.step != Lane::Step::Finished;
+  };
+  while (std::any_of(lanes.begin(), lanes.end(), not_finished)) {
+    for (size_t i = 0; i < size; ++i) {
+      trial_points[i] = toms748_detail::trial_point(make_not_null(&lanes[i]));
+    }
+    const DataVector f_at_trial_points = f(trial_points);
+    for (size_t i = 0; i < size; ++i) {
+      if (not_finished(lanes[i])) {
+        toms748_detail::update(make_not_null(&lanes[i]), trial_points[i],
+                               f_at_trial_points[i], tol);
+      }
+    }
+  }
+
+  DataVector result_vector(size);
+  for (size_t i = 0; i < size; ++i) {
+    const Lane& lane = lanes[i];
+    if (lane.count == 0) {
+      throw convergence_error(
+          "toms748 reached max iterations without converging");
+    }
+    if (lane.fa == 0.0) {
+      result_vector[i] = lane.a;
+    } else if (lane.fb == 0.0) {
+      result_vector[i] = lane.b;
+    } else {
+      result_vector[i] = lane.a + 0.5 * (lane.b - lane.a);
+    }
+  }
+  return result_vector;
+}
 }  // namespace RootFinder
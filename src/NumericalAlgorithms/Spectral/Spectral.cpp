@@ -4,6 +4,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <type_traits>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/StaticCache.hpp"
 
 namespace Spectral {
@@ -224,6 +226,44 @@ struct LinearFilterMatrixGenerator {
   }
 };
 
+// Computes \f$\mathcal{V}\cdot\mathrm{diag}(\sigma_k)\cdot\mathcal{V}^{-1}\f$
+// for the filter coefficients \f$\sigma_k\f$ of the modes \f$k\f$.
+template <Basis BasisType, Quadrature QuadratureType,
+          typename FilterCoefficient>
+Matrix modal_filter_matrix(
+    const size_t num_points,
+    const FilterCoefficient& filter_coefficient) noexcept {
+  const Matrix& vandermonde_matrix =
+      spectral_to_grid_points_matrix<BasisType, QuadratureType>(num_points);
+  const Matrix& vandermonde_inverse =
+      grid_points_to_spectral_matrix<BasisType, QuadratureType>(num_points);
+  Matrix filter(num_points, num_points, 0.0);
+  for (size_t k = 0; k < num_points; k++) {
+    const double sigma = filter_coefficient(k);
+    if (sigma == 0.0) {
+      continue;
+    }
+    for (size_t j = 0; j < num_points; j++) {
+      const double sigma_vinv = sigma * vandermonde_inverse(k, j);
+      for (size_t i = 0; i < num_points; i++) {
+        filter(i, j) += vandermonde_matrix(i, k) * sigma_vinv;
+      }
+    }
+  }
+  return filter;
+}
+
+template <Basis BasisType, Quadrature QuadratureType>
+struct HeavisideFilterMatrixGenerator {
+  Matrix operator()(const size_t num_points,
+                    const size_t number_of_modes_to_keep) const noexcept {
+    return modal_filter_matrix<BasisType, QuadratureType>(
+        num_points, [number_of_modes_to_keep](const size_t k) noexcept {
+          return k < number_of_modes_to_keep ? 1.0 : 0.0;
+        });
+  }
+};
+
 }  // namespace
 
 // Public interface
@@ -269,6 +309,39 @@ PRECOMPUTED_SPECTRAL_QUANTITY(linear_filter_matrix, Matrix,
 #undef PRECOMPUTED_SPECTRAL_QUANTITY
 /// \endcond
 
+template <Basis BasisType, Quadrature QuadratureType>
+const Matrix& heaviside_filter_matrix(
+    const size_t num_points, const size_t number_of_modes_to_keep) noexcept {
+  constexpr size_t max_num_points =
+      Spectral::maximum_number_of_points<BasisType>;
+  constexpr size_t min_num_points =
+      Spectral::minimum_number_of_points<BasisType, QuadratureType>;
+  ASSERT(num_points >= min_num_points,
+         "Tried to work with less than the minimum number of collocation "
+         "points for this quadrature.");
+  ASSERT(num_points <= max_num_points,
+         "Exceeded maximum number of collocation points.");
+  static const auto precomputed_data =
+      make_static_cache<CacheRange<min_num_points, max_num_points + 1>,
+                        CacheRange<0_st, max_num_points + 1>>(
+          HeavisideFilterMatrixGenerator<BasisType, QuadratureType>{});
+  return precomputed_data(num_points,
+                          std::min(number_of_modes_to_keep, num_points));
+}
+
+template <Basis BasisType, Quadrature QuadratureType>
+Matrix exponential_filter_matrix(const size_t num_points, const double alpha,
+                                 const size_t half_power) noexcept {
+  if (num_points == 1) {
+    return Matrix(1, 1, 1.0);
+  }
+  const double order = num_points - 1;
+  return modal_filter_matrix<BasisType, QuadratureType>(
+      num_points, [alpha, half_power, order](const size_t k) noexcept {
+        return std::exp(-alpha * std::pow(k / order, 2 * half_power));
+      });
+}
+
 template <Basis BasisType, Quadrature QuadratureType, typename T>
 Matrix interpolation_matrix(const size_t num_points,
                             const T& target_points) noexcept {
@@ -376,6 +449,31 @@ SPECTRAL_QUANTITY_FOR_MESH(linear_filter_matrix, Matrix)
 #undef SPECTRAL_QUANTITY_FOR_MESH
 /// \endcond
 
+const Matrix& heaviside_filter_matrix(
+    const Mesh<1>& mesh, const size_t number_of_modes_to_keep) noexcept {
+  return get_spectral_quantity_for_mesh(
+      [number_of_modes_to_keep](
+          const auto basis, const auto quadrature,
+          const size_t num_points) noexcept->const Matrix& {
+        return heaviside_filter_matrix<decltype(basis)::value,
+                                       decltype(quadrature)::value>(
+            num_points, number_of_modes_to_keep);
+      },
+      mesh);
+}
+
+Matrix exponential_filter_matrix(const Mesh<1>& mesh, const double alpha,
+                                 const size_t half_power) noexcept {
+  return get_spectral_quantity_for_mesh(
+      [alpha, half_power](const auto basis, const auto quadrature,
+                          const size_t num_points) noexcept->Matrix {
+        return exponential_filter_matrix<decltype(basis)::value,
+                                         decltype(quadrature)::value>(
+            num_points, alpha, half_power);
+      },
+      mesh);
+}
+
 template <typename T>
 Matrix interpolation_matrix(const Mesh<1>& mesh,
                             const T& target_points) noexcept {
@@ -411,6 +509,12 @@ Matrix interpolation_matrix(const Mesh<1>& mesh,
   template const Matrix&                                                      \
       Spectral::linear_filter_matrix<BASIS(data), QUAD(data)>(                \
           size_t) noexcept;                                                   \
+  template const Matrix&                                                      \
+      Spectral::heaviside_filter_matrix<BASIS(data), QUAD(data)>(             \
+          size_t, size_t) noexcept;                                           \
+  template Matrix                                                             \
+      Spectral::exponential_filter_matrix<BASIS(data), QUAD(data)>(           \
+          size_t, double, size_t) noexcept;                                   \
   template Matrix Spectral::interpolation_matrix<BASIS(data), QUAD(data)>(    \
       size_t, const DataVector&) noexcept;                                    \
   template Matrix Spectral::interpolation_matrix<BASIS(data), QUAD(data)>(    \
@@ -302,4 +302,63 @@ const Matrix& linear_filter_matrix(size_t num_points) noexcept;
  */
 const Matrix& linear_filter_matrix(const Mesh<1>& mesh) noexcept;
 
+/*!
+ * \brief %Matrix used to remove the highest modes of a function.
+ *
+ * \details Keeps the lowest `number_of_modes_to_keep` modes and removes all
+ * others by applying
+ * \f$\mathcal{V}\cdot\mathrm{diag}(1,...,1,0,...,0)\cdot\mathcal{V}^{-1}\f$
+ * to the nodal coefficients, where \f$\mathcal{V}\f$ is the Vandermonde
+ * matrix computed in `spectral_to_grid_points_matrix(size_t)`. The matrices
+ * for all `number_of_modes_to_keep` up to `num_points` are cached, and a
+ * larger `number_of_modes_to_keep` gives the identity.
+ *
+ * \param num_points The number of collocation points
+ * \param number_of_modes_to_keep The number of modes that are not removed
+ *
+ * \see linear_filter_matrix(size_t)
+ */
+template <Basis BasisType, Quadrature QuadratureType>
+const Matrix& heaviside_filter_matrix(size_t num_points,
+                                      size_t number_of_modes_to_keep) noexcept;
+
+/*!
+ * \brief Heaviside filter matrix for a one-dimensional mesh.
+ *
+ * \see heaviside_filter_matrix(size_t, size_t)
+ */
+const Matrix& heaviside_filter_matrix(const Mesh<1>& mesh,
+                                      size_t number_of_modes_to_keep) noexcept;
+
+/*!
+ * \brief %Matrix used to exponentially damp the highest modes of a function.
+ *
+ * \details Multiplies the mode \f$k\f$ of the function by
+ * \f$\exp\left(-\alpha\left(\frac{k}{N-1}\right)^{2s}\right)\f$, where
+ * \f$N\f$ is the number of collocation points, \f$\alpha\f$ controls how
+ * much the highest mode is damped and the half power \f$s\f$ controls how
+ * quickly the damping falls off for lower modes. Typical values are
+ * \f$\alpha=36\f$, which damps the highest mode to machine precision, and
+ * \f$s\approx 16\f$.
+ *
+ * Since the matrix depends on the runtime values of \f$\alpha\f$ and
+ * \f$s\f$ it is not cached here, so callers that apply the filter repeatedly
+ * should store it.
+ *
+ * \param num_points The number of collocation points
+ * \param alpha The damping \f$\alpha\f$ of the highest mode
+ * \param half_power The half power \f$s\f$ of the exponent
+ */
+template <Basis BasisType, Quadrature QuadratureType>
+Matrix exponential_filter_matrix(size_t num_points, double alpha,
+                                 size_t half_power) noexcept;
+
+/*!
+ * \brief Exponential filter matrix for a one-dimensional mesh.
+ *
+ * \see exponential_filter_matrix(size_t, double, size_t)
+ */
+Matrix exponential_filter_matrix(const Mesh<1>& mesh, double alpha,
+                                 size_t half_power) noexcept;
+
 }  // namespace Spectral
@@ -0,0 +1,165 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Utilities/PrettyType.hpp"
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief The accumulated cost of an iterable action of a parallel component.
+ *
+ * The `inclusive_time` is the wall time spent in the `apply` function of the
+ * action, including everything it calls. The `waiting_time` is the wall time
+ * between the first time the `is_ready` function of the action returned
+ * `false` and the action being applied, i.e. the time the action waited for
+ * data to arrive in the inboxes.
+ */
+struct ActionProfile {
+  size_t number_of_calls{0};
+  double inclusive_time{0.0};
+  double waiting_time{0.0};
+
+  ActionProfile& operator+=(const ActionProfile& rhs) noexcept {
+    number_of_calls += rhs.number_of_calls;
+    inclusive_time += rhs.inclusive_time;
+    waiting_time += rhs.waiting_time;
+    return *this;
+  }
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept {  // NOLINT
+    p | number_of_calls;
+    p | inclusive_time;
+    p | waiting_time;
+  }
+};
+
+inline bool operator==(const ActionProfile& lhs,
+                       const ActionProfile& rhs) noexcept {
+  return lhs.number_of_calls == rhs.number_of_calls and
+         lhs.inclusive_time == rhs.inclusive_time and
+         lhs.waiting_time == rhs.waiting_time;
+}
+
+inline bool operator!=(const ActionProfile& lhs,
+                       const ActionProfile& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Accumulates an `Parallel::ActionProfile` for each iterable action of
+ * each parallel component executed on a processing element.
+ *
+ * The `Parallel::AlgorithmImpl` records every action it applies in the
+ * profiler of the thread it runs on, so the profiler returned by
+ * `thread_local_instance` holds the profile of the processing element. The
+ * actions are identified by a number obtained from
+ * `Parallel::action_profiler_id`, so recording a call costs an array access.
+ *
+ * The profiles of all processing elements are combined by name, since the ids
+ * may differ between processes, and written to the reduction file by
+ * `observers::Actions::ContributeActionProfile`.
+ */
+class ActionProfiler {
+ public:
+  /// The profiler of the calling thread, i.e. of the processing element.
+  static ActionProfiler& thread_local_instance() noexcept {
+    thread_local ActionProfiler profiler{};
+    return profiler;
+  }
+
+  /// Assign an id to the action named `action_name` of the component named
+  /// `component_name`. The id is shared by all threads of the process.
+  static size_t register_action(std::string component_name,
+                                std::string action_name) noexcept {
+    const std::lock_guard<std::mutex> lock(registry_mutex());
+    auto& names = registered_names();
+    names.push_back(std::move(component_name) + "/" + std::move(action_name));
+    return names.size() - 1;
+  }
+
+  void record_call(const size_t action_id,
+                   const double inclusive_time) noexcept {
+    auto& action_profile = profile(action_id);
+    ++action_profile.number_of_calls;
+    action_profile.inclusive_time += inclusive_time;
+  }
+
+  void record_wait(const size_t action_id,
+                   const double waiting_time) noexcept {
+    profile(action_id).waiting_time += waiting_time;
+  }
+
+  /// The profiles of all actions that were recorded, keyed by
+  /// `"<component>/<action>"`.
+  std::map<std::string, ActionProfile> summary() const noexcept {
+    std::map<std::string, ActionProfile> result{};
+    const std::lock_guard<std::mutex> lock(registry_mutex());
+    const auto& names = registered_names();
+    for (size_t id = 0; id < profiles_.size(); ++id) {
+      if (profiles_[id].number_of_calls > 0 or
+          profiles_[id].waiting_time > 0.0) {
+        result[names[id]] += profiles_[id];
+      }
+    }
+    return result;
+  }
+
+  void reset() noexcept { profiles_.clear(); }
+
+ private:
+  ActionProfile& profile(const size_t action_id) noexcept {
+    if (action_id >= profiles_.size()) {
+      profiles_.resize(action_id + 1);
+    }
+    return profiles_[action_id];
+  }
+
+  static std::mutex& registry_mutex() noexcept {
+    static std::mutex mutex{};
+    return mutex;
+  }
+
+  static std::vector<std::string>& registered_names() noexcept {
+    static std::vector<std::string> names{};
+    return names;
+  }
+
+  std::vector<ActionProfile> profiles_{};
+};
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief The id used by the `Parallel::ActionProfiler` for the action at
+ * position `ActionIndex` of the action list of `ParallelComponent`.
+ *
+ * The action is named by its position and its short name, e.g.
+ * `"DgElementArray/04_ReceiveDataForFluxes"`, so that actions that appear more
+ * than once in an action list are profiled separately.
+ */
+template <typename ParallelComponent, size_t ActionIndex, typename Action>
+size_t action_profiler_id() noexcept {
+  static const size_t id = []() noexcept {
+    std::ostringstream action_name{};
+    action_name << std::setfill('0') << std::setw(2) << ActionIndex << "_"
+                << pretty_type::short_name<Action>();
+    return ActionProfiler::register_action(
+        pretty_type::short_name<ParallelComponent>(), action_name.str());
+  }();
+  return id;
+}
+}  // namespace Parallel
@@ -21,8 +21,10 @@
 #include "ErrorHandling/Error.hpp"
 // Include... ourself?
 // IWYU pragma: no_include "Parallel/Algorithm.hpp"
+#include "Parallel/ActionProfiler.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/CharmRegistration.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/SimpleActionVisitation.hpp"
@@ -45,6 +47,7 @@ class CProxy_ConstGlobalCache;
 template <class Metavariables>
 class ConstGlobalCache;
 namespace Algorithms {
+struct Array;
 struct Nodegroup;
 struct Singleton;
 }  // namespace Algorithms
@@ -240,8 +243,50 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>> {
 
   /// Start evaluating the algorithm until the is_ready function of an Action
   /// returns false, or an Action returns with `terminate` set to `true`
+  ///
+  /// The time spent in each Action and waiting for it to become ready is
+  /// recorded by the `Parallel::ActionProfiler` of the processing element.
   constexpr void perform_algorithm() noexcept;
 
+  /// Start evaluating the algorithm, first clearing `terminate` if
+  /// `restart_if_terminated` is `true`, e.g. to continue an algorithm that was
+  /// paused for a different phase.
+  void perform_algorithm(bool restart_if_terminated) noexcept;
+
+  /*!
+   * \brief Report the measured load and let Charm++ migrate the array element.
+   *
+   * The load of the element is the wall time spent executing its actions since
+   * the previous load balancing. Charm++ migrates the elements once every
+   * element has called this function, and serializes them with `pup`.
+   */
+  template <typename Dummy = int,
+            Requires<(sizeof(Dummy),
+                      cpp17::is_same_v<Parallel::Algorithms::Array,
+                                       chare_type>)> = nullptr>
+  void start_load_balancing() noexcept {
+    // The entry method is generated for every array, so this can't be a
+    // static_assert
+    ASSERT(is_load_balanced,
+           "Only array components with 'using load_balancing = "
+           "std::true_type;' and a LoadBalancing phase can be load balanced, "
+           "but start_load_balancing was called on "
+               << pretty_type::get_name<ParallelComponent>());
+    auto& algorithm = static_cast<typename chare_type::template algorithm_type<
+        ParallelComponent, array_index>&>(*this);
+    algorithm.setObjTime(measured_load_);
+    measured_load_ = 0.0;
+    algorithm.AtSync();
+  }
+
+  /// The wall time spent executing actions since the last load balancing
+  double measured_load() const noexcept { return measured_load_; }
+
+  /// Serialize the algorithm, e.g. when migrating array elements or writing a
+  /// checkpoint
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+
   /// Tell the Algorithm it should no longer execute the algorithm. This does
   /// not mean that the execution of the program is terminated, but only that
   /// the algorithm has terminated. An algorithm can be restarted by pass `true`
@@ -254,6 +299,8 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>> {
  private:
   static constexpr bool is_singleton =
       cpp17::is_same_v<chare_type, Parallel::Algorithms::Singleton>;
+  static constexpr bool is_array =
+      cpp17::is_same_v<chare_type, Parallel::Algorithms::Array>;
 
   template <class Dummy = int,
             Requires<(sizeof(Dummy), is_singleton)> = nullptr>
@@ -268,6 +315,29 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>> {
                        .thisIndex;
   }
 
+  // Only the array components that opt in with `using load_balancing =
+  // std::true_type;` and have a `LoadBalancing` phase to be migrated in call
+  // `AtSync`. Charm++ waits for every element with `usesAtSync` set before
+  // migrating, so enabling it on any other array would stall load balancing.
+  static constexpr bool is_load_balanced =
+      is_array and Parallel::is_load_balanced_v<ParallelComponent> and
+      Parallel::has_load_balancing_phase_v<typename metavariables::Phase>;
+
+  template <class Dummy = int,
+            Requires<(sizeof(Dummy), not is_load_balanced)> = nullptr>
+  constexpr void enable_load_balancing() noexcept {}
+  template <class Dummy = int,
+            Requires<(sizeof(Dummy), is_load_balanced)> = nullptr>
+  void enable_load_balancing() noexcept {
+    // Array elements are migrated at `start_load_balancing` using the load
+    // they measured rather than the one measured by Charm++, which includes
+    // time spent outside the actions.
+    auto& algorithm = static_cast<typename chare_type::template algorithm_type<
+        ParallelComponent, array_index>&>(*this);
+    algorithm.usesAtSync = true;
+    algorithm.usesAutoMeasure = false;
+  }
+
   template <size_t... Is>
   constexpr bool iterate_over_actions(
       std::index_sequence<Is...> /*meta*/) noexcept;
@@ -318,8 +388,14 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>> {
   double non_action_time_start_;
 #endif
 
+  Parallel::CProxy_ConstGlobalCache<metavariables> global_cache_proxy_;
   Parallel::ConstGlobalCache<metavariables>* const_global_cache_{nullptr};
   bool performing_action_ = false;
+  double measured_load_{0.0};
+  // The time at which the is_ready function of the current action first
+  // returned false, or a negative value if the action is not waiting. This is
+  // only used for profiling and is not serialized.
+  double waiting_start_time_{-1.0};
   std::size_t algorithm_step_ = 0;
   tmpl::conditional_t<Parallel::is_node_group_proxy<cproxy_type>::value,
                       CmiNodeLock, NoSuchType>
@@ -345,6 +421,7 @@ AlgorithmImpl<ParallelComponent,
   make_overloader([](CmiNodeLock& node_lock) { node_lock = create_lock(); },
                   [](NoSuchType /*unused*/) {})(node_lock_);
   set_array_index();
+  enable_load_balancing();
 }
 
 template <typename ParallelComponent, typename... ActionsPack>
@@ -352,7 +429,8 @@ AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>>::AlgorithmImpl(
     const Parallel::CProxy_ConstGlobalCache<metavariables>&
         global_cache_proxy) noexcept
     : AlgorithmImpl() {
-  const_global_cache_ = global_cache_proxy.ckLocalBranch();
+  global_cache_proxy_ = global_cache_proxy;
+  const_global_cache_ = global_cache_proxy_.ckLocalBranch();
 }
 
 template <typename ParallelComponent, typename... ActionsPack>
@@ -469,16 +547,47 @@ AlgorithmImpl<ParallelComponent,
   non_action_time_start_ = Parallel::wall_time();
 #endif
   lock(&node_lock_);
+  const double start_time = Parallel::wall_time();
   while (tmpl::size<actions_list>::value > 0 and not get_terminate() and
          iterate_over_actions(
              std::make_index_sequence<tmpl::size<actions_list>::value>{})) {
   }
+  measured_load_ += Parallel::wall_time() - start_time;
   unlock(&node_lock_);
 #ifdef SPECTRE_CHARM_PROJECTIONS
   traceUserBracketEvent(SPECTRE_CHARM_NON_ACTION_WALLTIME_EVENT_ID,
                         non_action_time_start_, Parallel::wall_time());
 #endif
 }
+
+template <typename ParallelComponent, typename... ActionsPack>
+void AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>>::
+    perform_algorithm(const bool restart_if_terminated) noexcept {
+  if (restart_if_terminated) {
+    lock(&node_lock_);
+    set_terminate(false);
+    unlock(&node_lock_);
+  }
+  perform_algorithm();
+}
+
+template <typename ParallelComponent, typename... ActionsPack>
+void AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>>::pup(
+    PUP::er& p) noexcept {
+  ASSERT(not performing_action_,
+         "Cannot serialize the algorithm while it is performing an action.");
+  // The array index is set from Charm++ by the migration constructor and the
+  // node lock is created anew, so neither is serialized.
+  p | global_cache_proxy_;
+  p | algorithm_step_;
+  p | terminate_;
+  p | measured_load_;
+  p | box_;
+  p | inboxes_;
+  if (p.isUnpacking()) {
+    const_global_cache_ = global_cache_proxy_.ckLocalBranch();
+  }
+}
 /// \endcond
 
 template <typename ParallelComponent, typename... ActionsPack>
@@ -529,10 +638,23 @@ constexpr bool AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>>::
                 tuples::tagged_tuple_from_typelist<inbox_tags_list>,
                 Parallel::ConstGlobalCache<metavariables>, array_index>{},
             this_action{})) {
+      if (waiting_start_time_ < 0.0) {
+        waiting_start_time_ = Parallel::wall_time();
+      }
       take_next_action = false;
       return;
     }
 
+    const size_t profiler_id =
+        action_profiler_id<ParallelComponent, iter, this_action>();
+    auto& profiler = ActionProfiler::thread_local_instance();
+    const double action_start_time = Parallel::wall_time();
+    if (waiting_start_time_ >= 0.0) {
+      profiler.record_wait(profiler_id,
+                           action_start_time - waiting_start_time_);
+      waiting_start_time_ = -1.0;
+    }
+
 #ifdef SPECTRE_CHARM_PROJECTIONS
     traceUserBracketEvent(SPECTRE_CHARM_NON_ACTION_WALLTIME_EVENT_ID,
                           non_action_time_start_, Parallel::wall_time());
@@ -568,6 +690,8 @@ constexpr bool AlgorithmImpl<ParallelComponent, tmpl::list<ActionsPack...>>::
                   std::add_pointer_t<ParallelComponent>{}))>::type{});
 
     performing_action_ = false;
+    profiler.record_call(profiler_id,
+                         Parallel::wall_time() - action_start_time);
 #ifdef SPECTRE_CHARM_PROJECTIONS
     detail::stop_trace_action<this_action>(start_time);
     non_action_time_start_ = Parallel::wall_time();
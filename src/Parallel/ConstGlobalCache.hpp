@@ -19,6 +19,7 @@
 #include "Utilities/TaggedTuple.hpp"
 
 #include "Parallel/ConstGlobalCache.decl.h"
+#include "Parallel/Main.decl.h"
 
 namespace Parallel {
 
@@ -104,12 +105,28 @@ class ConstGlobalCache : public CBase_ConstGlobalCache<Metavariables> {
   ConstGlobalCache& operator=(ConstGlobalCache&&) = default;
   /// \endcond
 
-  /// Entry method to set the ParallelComponents (should only be called once)
+  /// Entry method to set the ParallelComponents and the proxy of the Main
+  /// chare (should only be called once)
   void set_parallel_components(
       tuples::tagged_tuple_from_typelist<parallel_component_tag_list>&
           parallel_components,
+      CProxy_Main<Metavariables>& main_proxy,
       const CkCallback& callback) noexcept;
 
+  /// The proxy of the Main chare, e.g. for requesting a phase with
+  /// `Main::request_phase`
+  CProxy_Main<Metavariables>& main_proxy() noexcept { return main_proxy_; }
+
+  /// Serialize the cache, e.g. when writing a checkpoint
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept override {
+    CBase_ConstGlobalCache<Metavariables>::pup(p);
+    p | const_global_cache_;
+    p | parallel_components_;
+    p | main_proxy_;
+    p | parallel_components_have_been_set_;
+  }
+
  private:
   // clang-tidy: false positive, redundant declaration
   template <typename ConstGlobalCacheTag, typename MV>
@@ -136,6 +153,7 @@ class ConstGlobalCache : public CBase_ConstGlobalCache<Metavariables> {
   tuples::tagged_tuple_from_typelist<tag_list> const_global_cache_;
   tuples::tagged_tuple_from_typelist<parallel_component_tag_list>
       parallel_components_;
+  CProxy_Main<Metavariables> main_proxy_;
   bool parallel_components_have_been_set_{false};
 };
 
@@ -143,10 +161,12 @@ template <typename Metavariables>
 void ConstGlobalCache<Metavariables>::set_parallel_components(
     tuples::tagged_tuple_from_typelist<parallel_component_tag_list>&
         parallel_components,
+    CProxy_Main<Metavariables>& main_proxy,
     const CkCallback& callback) noexcept {
   ASSERT(!parallel_components_have_been_set_,
          "Can only set the parallel_components once");
   parallel_components_ = std::move(parallel_components);
+  main_proxy_ = main_proxy;
   parallel_components_have_been_set_ = true;
   this->contribute(callback);
 }
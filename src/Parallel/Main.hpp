@@ -6,11 +6,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <charm++.h>
+#include <cstddef>
 #include <initializer_list>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "ErrorHandling/Error.hpp"
 #include "Informer/Informer.hpp"
@@ -18,10 +23,14 @@
 #include "Parallel/CharmRegistration.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Exit.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Printf.hpp"
+#include "Parallel/PupStlCpp11.hpp"
 #include "Parallel/TypeTraits.hpp"
+#include "Utilities/FileSystem.hpp"
 #include "Utilities/Overloader.hpp"
+#include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -57,8 +66,9 @@ class Main : public CBase_Main<Metavariables> {
   /// \endcond
 
   explicit Main(CkArgMsg* msg) noexcept;
-  explicit Main(CkMigrateMessage* /*msg*/)
-      : options_("Uninitialized after migration") {}
+  explicit Main(CkMigrateMessage* /*msg*/) noexcept
+      : options_("Uninitialized after migration"),
+        restarted_from_checkpoint_(true) {}
 
   /// Initialize the parallel_components.
   void initialize() noexcept;
@@ -66,7 +76,40 @@ class Main : public CBase_Main<Metavariables> {
   /// Determine the next phase of the simulation and execute it.
   void execute_next_phase() noexcept;
 
+  /*!
+   * \brief Execute `phase` once the current phase has finished, and then
+   * resume the current phase.
+   *
+   * This allows parallel components to interrupt a phase, e.g. to load
+   * balance during an evolution. The components must stop executing their
+   * actions after requesting the phase so that the current phase finishes, and
+   * continue when it is resumed. Requests for a phase that is already pending
+   * are combined, and different phases are executed in the order they were
+   * first requested.
+   */
+  void request_phase(typename Metavariables::Phase phase) noexcept;
+
+  /// Serialize the phase state, e.g. when writing a checkpoint.
+  ///
+  /// The options have already been used to create the parallel components,
+  /// so they are not serialized.
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept override;
+
  private:
+  // Starts writing a checkpoint if the phase that just finished is
+  // `WriteCheckpoint`. Returns `true` if Main must wait for the checkpoint to
+  // be written before continuing with the next phase.
+  template <typename PhaseType,
+            Requires<not has_write_checkpoint_phase_v<PhaseType>> = nullptr>
+  bool try_write_checkpoint(PhaseType /*current_phase*/) noexcept {
+    return false;
+  }
+
+  template <typename PhaseType,
+            Requires<has_write_checkpoint_phase_v<PhaseType>> = nullptr>
+  bool try_write_checkpoint(PhaseType current_phase) noexcept;
+
   template <typename ParallelComponent>
   using parallel_component_options = typename ParallelComponent::options;
   using option_list = tmpl::remove_duplicates<tmpl::flatten<tmpl::list<
@@ -80,6 +123,14 @@ class Main : public CBase_Main<Metavariables> {
           tmpl::bind<Parallel::proxy_from_parallel_component, tmpl::_1>>>;
   typename Metavariables::Phase current_phase_{
       Metavariables::Phase::Initialization};
+  std::vector<typename Metavariables::Phase> requested_phases_{};
+  bool resume_interrupted_phase_{false};
+  typename Metavariables::Phase interrupted_phase_{
+      Metavariables::Phase::Initialization};
+  size_t number_of_checkpoints_{0};
+  bool writing_checkpoint_{false};
+  double checkpoint_start_time_{0.0};
+  bool restarted_from_checkpoint_{false};
 
   CProxy_ConstGlobalCache<Metavariables> const_global_cache_proxy_;
   Options<option_list> options_;
@@ -279,8 +330,8 @@ Main<Metavariables>::Main(CkArgMsg* msg) noexcept
   // executed.
   CkCallback callback(CkIndex_Main<Metavariables>::initialize(),
                       this->thisProxy);
-  const_global_cache_proxy_.set_parallel_components(the_parallel_components,
-                                                    callback);
+  const_global_cache_proxy_.set_parallel_components(
+      the_parallel_components, this->thisProxy, callback);
 }
 
 template <typename Metavariables>
@@ -299,12 +350,29 @@ void Main<Metavariables>::initialize() noexcept {
 
 template <typename Metavariables>
 void Main<Metavariables>::execute_next_phase() noexcept {
-  current_phase_ = Metavariables::determine_next_phase(
-      current_phase_, const_global_cache_proxy_);
+  if (try_write_checkpoint(current_phase_)) {
+    return;
+  }
+  // The parallel components are told about the Exit phase so they can finish
+  // up, e.g. write buffered data to disk, and we exit once they are done.
   if (Metavariables::Phase::Exit == current_phase_) {
     Informer::print_exit_info();
     Parallel::exit();
   }
+  if (not requested_phases_.empty()) {
+    if (not resume_interrupted_phase_) {
+      interrupted_phase_ = current_phase_;
+      resume_interrupted_phase_ = true;
+    }
+    current_phase_ = requested_phases_.front();
+    requested_phases_.erase(requested_phases_.begin());
+  } else if (resume_interrupted_phase_) {
+    current_phase_ = interrupted_phase_;
+    resume_interrupted_phase_ = false;
+  } else {
+    current_phase_ = Metavariables::determine_next_phase(
+        current_phase_, const_global_cache_proxy_);
+  }
   tmpl::for_each<component_list>([this](auto parallel_component) noexcept {
     tmpl::type_from<decltype(parallel_component)>::execute_next_phase(
         current_phase_, const_global_cache_proxy_);
@@ -313,6 +381,79 @@ void Main<Metavariables>::execute_next_phase() noexcept {
                        this->thisProxy));
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::request_phase(
+    const typename Metavariables::Phase phase) noexcept {
+  if (std::find(requested_phases_.begin(), requested_phases_.end(), phase) ==
+      requested_phases_.end()) {
+    requested_phases_.push_back(phase);
+  }
+}
+
+template <typename Metavariables>
+void Main<Metavariables>::pup(PUP::er& p) noexcept {
+  CBase_Main<Metavariables>::pup(p);
+  p | current_phase_;
+  p | requested_phases_;
+  p | resume_interrupted_phase_;
+  p | interrupted_phase_;
+  p | number_of_checkpoints_;
+  p | writing_checkpoint_;
+  p | const_global_cache_proxy_;
+}
+
+template <typename Metavariables>
+template <typename PhaseType,
+          Requires<has_write_checkpoint_phase_v<PhaseType>>>
+bool Main<Metavariables>::try_write_checkpoint(
+    const PhaseType current_phase) noexcept {
+  if (current_phase != Metavariables::Phase::WriteCheckpoint) {
+    return false;
+  }
+  std::stringstream checkpoint_dir;
+  checkpoint_dir << "Checkpoint_" << std::setfill('0') << std::setw(4)
+                 << number_of_checkpoints_;
+  if (not writing_checkpoint_) {
+    // The parallel components have finished the phase, so their state is
+    // consistent. Charm++ writes one file per processor in parallel and
+    // then calls execute_next_phase again, both after writing the
+    // checkpoint and after restarting from it with `+restart <dir>`.
+    writing_checkpoint_ = true;
+    checkpoint_start_time_ = Parallel::wall_time();
+    CkStartCheckpoint(checkpoint_dir.str().c_str(),
+                      CkCallback(CkIndex_Main<Metavariables>::
+                                     execute_next_phase(),
+                                 this->thisProxy));
+    return true;
+  }
+  writing_checkpoint_ = false;
+  ++number_of_checkpoints_;
+  if (restarted_from_checkpoint_) {
+    restarted_from_checkpoint_ = false;
+    Parallel::printf("Restarted from %s\n", checkpoint_dir.str());
+    return false;
+  }
+  const double elapsed_time = Parallel::wall_time() - checkpoint_start_time_;
+  size_t bytes = 0;
+  for (const auto& file : file_system::ls(checkpoint_dir.str())) {
+    const std::string path = checkpoint_dir.str() + "/" + file;
+    if (file_system::is_file(path)) {
+      bytes += file_system::file_size(path);
+    }
+  }
+  // The wall time has a finite resolution, so a small checkpoint can appear
+  // to take no time at all
+  if (elapsed_time > 0.0) {
+    Parallel::printf(
+        "Wrote %s: %zu bytes in %f seconds (%f MB/s)\n", checkpoint_dir.str(),
+        bytes, elapsed_time,
+        static_cast<double>(bytes) / (1.0e6 * elapsed_time));
+  } else {
+    Parallel::printf("Wrote %s: %zu bytes\n", checkpoint_dir.str(), bytes);
+  }
+  return false;
+}
+
 }  // namespace Parallel
 
 #define CK_TEMPLATES_ONLY
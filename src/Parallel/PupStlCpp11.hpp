@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <deque>
 #include <initializer_list>
 #include <memory>
@@ -160,6 +161,24 @@ inline void operator|(PUP::er& p, std::tuple<Args...>& t) {  // NOLINT
   pup(p, t);
 }
 
+/// \ingroup ParallelGroup
+/// Serialization of std::atomic for Charm++
+template <typename T>
+inline void pup(PUP::er& p, std::atomic<T>& d) noexcept {  // NOLINT
+  T local_d = d.load();
+  p | local_d;
+  if (p.isUnpacking()) {
+    d.store(local_d);
+  }
+}
+
+/// \ingroup ParallelGroup
+/// Serialization of std::atomic for Charm++
+template <typename T>
+inline void operator|(PUP::er& p, std::atomic<T>& d) noexcept {  // NOLINT
+  pup(p, d);
+}
+
 // @{
 /// \ingroup ParallelGroup
 /// Serialization of a unique_ptr for Charm++
@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions for requesting a phase from `Parallel::Main`
+
+#pragma once
+
+#include "Parallel/ConstGlobalCache.hpp"
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief Ask `Parallel::Main` to run `phase` once the current phase has
+ * reached quiescence, see `Main::request_phase`.
+ *
+ * \details Unit tests, which have no `Parallel::Main`, can record the
+ * requested phases by explicitly specializing this function for their
+ * metavariables.
+ */
+template <typename Metavariables>
+void request_phase(ConstGlobalCache<Metavariables>& cache,
+                   const typename Metavariables::Phase phase) noexcept {
+  cache.main_proxy().request_phase(phase);
+}
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Stop the algorithm of the element `array_index` of `Component` and
+ * request `phase` from `Parallel::Main`.
+ *
+ * \details This is how events pause the evolution for a phase. The element
+ * has to be on the calling processor, and its algorithm continues when
+ * `perform_algorithm` is called on it again, e.g. in the phase after `phase`.
+ */
+template <typename Component, typename Metavariables, typename ArrayIndex>
+void pause_for_phase(ConstGlobalCache<Metavariables>& cache,
+                     const ArrayIndex& array_index,
+                     const typename Metavariables::Phase phase) noexcept {
+  get_parallel_component<Component>(cache)[array_index]
+      .ckLocal()
+      ->set_terminate(true);
+  request_phase(cache, phase);
+}
+}  // namespace Parallel
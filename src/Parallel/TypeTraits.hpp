@@ -142,4 +142,81 @@ template <typename T>
 using is_pupable_t = typename is_pupable<T>::type;
 // @}
 
+// @{
+/// \ingroup ParallelGroup
+/// Inherits off of `std::true_type` if the phase enum `T` has a member
+/// `WriteCheckpoint`, in which case `Parallel::Main` writes a checkpoint at
+/// the end of that phase.
+template <typename T, typename = cpp17::void_t<>>
+struct has_write_checkpoint_phase : std::false_type {};
+
+/// \cond
+template <typename T>
+struct has_write_checkpoint_phase<T,
+                                  cpp17::void_t<decltype(T::WriteCheckpoint)>>
+    : std::true_type {};
+/// \endcond
+
+template <typename T>
+constexpr bool has_write_checkpoint_phase_v =
+    has_write_checkpoint_phase<T>::value;
+// @}
+
+// @{
+/// \ingroup ParallelGroup
+/// Inherits off of `std::true_type` if the phase enum `T` has a member
+/// `LoadBalancing`, during which the components for which `is_load_balanced`
+/// is true are migrated by Charm++.
+template <typename T, typename = cpp17::void_t<>>
+struct has_load_balancing_phase : std::false_type {};
+
+/// \cond
+template <typename T>
+struct has_load_balancing_phase<T, cpp17::void_t<decltype(T::LoadBalancing)>>
+    : std::true_type {};
+/// \endcond
+
+template <typename T>
+constexpr bool has_load_balancing_phase_v = has_load_balancing_phase<T>::value;
+// @}
+
+// @{
+/// \ingroup ParallelGroup
+/// Inherits off of `std::true_type` if the phase enum `T` has the members
+/// `EvaluateAmrCriteria` and `AdjustDomain`, in which the mesh of the
+/// elements is adapted.
+template <typename T, typename = cpp17::void_t<>>
+struct has_amr_phases : std::false_type {};
+
+/// \cond
+template <typename T>
+struct has_amr_phases<T, cpp17::void_t<decltype(T::EvaluateAmrCriteria),
+                                       decltype(T::AdjustDomain)>>
+    : std::true_type {};
+/// \endcond
+
+template <typename T>
+constexpr bool has_amr_phases_v = has_amr_phases<T>::value;
+// @}
+
+// @{
+/// \ingroup ParallelGroup
+/// Inherits off of `ParallelComponent::load_balancing` if the component has
+/// that type alias, and off of `std::false_type` otherwise. Only the array
+/// components for which this is true take part in load balancing.
+template <typename ParallelComponent, typename = cpp17::void_t<>>
+struct is_load_balanced : std::false_type {};
+
+/// \cond
+template <typename ParallelComponent>
+struct is_load_balanced<
+    ParallelComponent,
+    cpp17::void_t<typename ParallelComponent::load_balancing>>
+    : ParallelComponent::load_balancing {};
+/// \endcond
+
+template <typename ParallelComponent>
+constexpr bool is_load_balanced_v = is_load_balanced<ParallelComponent>::value;
+// @}
+
 } // namespace Parallel
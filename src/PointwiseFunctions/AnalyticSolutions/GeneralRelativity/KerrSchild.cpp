@@ -3,6 +3,7 @@
 
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
 
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <numeric>
@@ -12,12 +13,12 @@
 
 #include "DataStructures/DataBox/Prefixes.hpp"  // IWYU pragma: keep
 #include "DataStructures/DataVector.hpp"        // IWYU pragma: keep
-#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "Parallel/PupStlCpp11.hpp"
 #include "PointwiseFunctions/GeneralRelativity/ComputeSpacetimeQuantities.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
@@ -26,6 +27,12 @@
 /// \cond
 namespace gr {
 namespace Solutions {
+namespace {
+// Here null_vector_0 is simply -1, but if you have a boosted solution,
+// then null_vector_0 can be something different, so we leave it coded
+// in instead of eliminating it.
+constexpr double null_vector_0 = -1.0;
+}  // namespace
 
 KerrSchild::KerrSchild(const double mass,
                        KerrSchild::Spin::type dimensionless_spin,
@@ -56,24 +63,25 @@ void KerrSchild::pup(PUP::er& p) noexcept {
 }
 
 template <typename DataType>
-tuples::tagged_tuple_from_typelist<KerrSchild::tags<DataType>>
-KerrSchild::variables(const tnsr::I<DataType, 3>& x, const double /*t*/,
-                      tags<DataType> /*meta*/) const noexcept {
+KerrSchild::IntermediateVars<DataType>::IntermediateVars(
+    const double mass, const std::array<double, 3>& dimensionless_spin,
+    const std::array<double, 3>& center,
+    const tnsr::I<DataType, 3>& x) noexcept {
   // Input spin is dimensionless spin.  But below we use `spin` = the
   // Kerr spin parameter `a`, which is `J/M` where `J` is the angular
   // momentum.  So compute `spin=a` here.
-  auto spin = dimensionless_spin_;
+  auto spin = dimensionless_spin;
   for (auto& s : spin) {
-    s *= mass_;
+    s *= mass;
   }
 
   const auto a_squared =
       std::inner_product(spin.begin(), spin.end(), spin.begin(), 0.);
 
-  const auto x_minus_center = [&x, this ]() noexcept {
+  const auto x_minus_center = [&x, &center ]() noexcept {
     auto l_x_minus_center = x;
     for (size_t d = 0; d < 3; ++d) {
-      l_x_minus_center.get(d) -= gsl::at(center_, d);
+      l_x_minus_center.get(d) -= gsl::at(center, d);
     }
     return l_x_minus_center;
   }
@@ -107,19 +115,16 @@ KerrSchild::variables(const tnsr::I<DataType, 3>& x, const double /*t*/,
   ();
 
   const DataType H_denom = 1.0 / (square(r_squared) + a_dot_x_squared);
-  const DataType H = mass_ * sqrt(r_squared) * r_squared * H_denom;
+  H = mass * sqrt(r_squared) * r_squared * H_denom;
 
-  const auto deriv_H =
-      [&H, &r_squared, &H_denom, &a_dot_x, &deriv_log_r, &spin ]() noexcept {
-    auto l_deriv_H = make_with_value<tnsr::i<DataType, 3>>(H_denom, 0.0);
+  deriv_H = make_with_value<tnsr::i<DataType, 3>>(H_denom, 0.0);
+  {
     const DataType temp1 = H * (3.0 - 4.0 * square(r_squared) * H_denom);
     const DataType temp2 = H * (2.0 * H_denom * a_dot_x);
     for (size_t i = 0; i < 3; ++i) {
-      l_deriv_H.get(i) = temp1 * deriv_log_r.get(i) - temp2 * gsl::at(spin, i);
+      deriv_H.get(i) = temp1 * deriv_log_r.get(i) - temp2 * gsl::at(spin, i);
     }
-    return l_deriv_H;
   }
-  ();
 
   const auto a_cross_x = [](const std::array<double, 3>& a,
                             const tnsr::I<DataType, 3>& coord) noexcept {
@@ -134,81 +139,99 @@ KerrSchild::variables(const tnsr::I<DataType, 3>& x, const double /*t*/,
   const DataType denom = 1.0 / (r_squared + a_squared);
   const DataType r = sqrt(r_squared);
 
-  const auto null_form = [
-    &x, &a_dot_x, &r, &denom, &x_minus_center, &a_cross_x, &spin
-  ]() noexcept {
-    auto l_null_form = make_with_value<tnsr::i<DataType, 3>>(x, 0.0);
+  null_form = make_with_value<tnsr::i<DataType, 3>>(x, 0.0);
+  {
     const DataType temp = a_dot_x / r;
     for (size_t i = 0; i < 3; ++i) {
-      l_null_form.get(i) = denom * (r * x_minus_center.get(i) -
-                                    a_cross_x.get(i) + temp * gsl::at(spin, i));
+      null_form.get(i) = denom * (r * x_minus_center.get(i) - a_cross_x.get(i) +
+                                  temp * gsl::at(spin, i));
     }
-    return l_null_form;
   }
-  ();
 
-  const auto deriv_null_form = [
-    &denom, &x_minus_center, &r, &null_form, &a_dot_x_over_rsquared,
-    &deriv_log_r, &spin
-  ]() noexcept {
-    auto l_deriv_null_form = make_with_value<tnsr::ij<DataType, 3>>(r, 0.0);
-    for (size_t i = 0; i < 3; i++) {
-      for (size_t j = 0; j < 3; j++) {
-        l_deriv_null_form.get(j, i) =
-            denom * (gsl::at(spin, i) * gsl::at(spin, j) / r +
-                     (x_minus_center.get(i) - 2.0 * r * null_form.get(i) -
-                      a_dot_x_over_rsquared * gsl::at(spin, i)) *
-                         deriv_log_r.get(j) * r);
-        if (i == j) {
-          l_deriv_null_form.get(j, i) += denom * r;
-        } else {  //  add denom*epsilon^ijk a_k
-          size_t k = (j + 1) % 3;
-          if (k == i) {  // j+1 = i (cyclic), so choose minus sign
-            k++;
-            k = k % 3;  // and set k to be neither i nor j
-            l_deriv_null_form.get(j, i) -= denom * gsl::at(spin, k);
-          } else {  // i+1 = j (cyclic), so choose plus sign
-            l_deriv_null_form.get(j, i) += denom * gsl::at(spin, k);
-          }
+  deriv_null_form = make_with_value<tnsr::ij<DataType, 3>>(r, 0.0);
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      deriv_null_form.get(j, i) =
+          denom * (gsl::at(spin, i) * gsl::at(spin, j) / r +
+                   (x_minus_center.get(i) - 2.0 * r * null_form.get(i) -
+                    a_dot_x_over_rsquared * gsl::at(spin, i)) *
+                       deriv_log_r.get(j) * r);
+      if (i == j) {
+        deriv_null_form.get(j, i) += denom * r;
+      } else {  //  add denom*epsilon^ijk a_k
+        size_t k = (j + 1) % 3;
+        if (k == i) {  // j+1 = i (cyclic), so choose minus sign
+          k++;
+          k = k % 3;  // and set k to be neither i nor j
+          deriv_null_form.get(j, i) -= denom * gsl::at(spin, k);
+        } else {  // i+1 = j (cyclic), so choose plus sign
+          deriv_null_form.get(j, i) += denom * gsl::at(spin, k);
         }
       }
     }
-    return l_deriv_null_form;
   }
-  ();
 
-  // Here null_vector_0 is simply -1, but if you have a boosted solution,
-  // then null_vector_0 can be something different, so we leave it coded
-  // in instead of eliminating it.
-  const constexpr double null_vector_0 = -1.0;
-  const DataType lapse_squared = 1.0 / (1.0 + 2.0 * H * square(null_vector_0));
+  lapse_squared = 1.0 / (1.0 + 2.0 * H * square(null_vector_0));
+}
 
-  auto result =
-      make_with_value<tuples::tagged_tuple_from_typelist<tags<DataType>>>(x,
-                                                                          0.0);
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<Scalar<DataType>*> lapse,
+    gr::Tags::Lapse<DataType> /*meta*/) const noexcept {
+  destructive_resize_components(lapse, get_size(H));
+  get(*lapse) = sqrt(lapse_squared);
+}
 
-  get(get<gr::Tags::Lapse<DataType>>(result)) = sqrt(lapse_squared);
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<Scalar<DataType>*> dt_lapse,
+    ::Tags::dt<gr::Tags::Lapse<DataType>> /*meta*/) const noexcept {
+  destructive_resize_components(dt_lapse, get_size(H));
+  get(*dt_lapse) = 0.0;
+}
 
-  {
-    const DataType temp = -square(null_vector_0) *
-                          get(get<gr::Tags::Lapse<DataType>>(result)) *
-                          lapse_squared;
-    for (size_t i = 0; i < 3; ++i) {
-      get<DerivLapse<DataType>>(result).get(i) = temp * deriv_H.get(i);
-    }
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::i<DataType, 3>*> deriv_lapse,
+    DerivLapse<DataType> /*meta*/) const noexcept {
+  destructive_resize_components(deriv_lapse, get_size(H));
+  const DataType temp =
+      -square(null_vector_0) * sqrt(lapse_squared) * lapse_squared;
+  for (size_t i = 0; i < 3; ++i) {
+    deriv_lapse->get(i) = temp * deriv_H.get(i);
   }
+}
 
-  {
-    const DataType temp = -2.0 * H * null_vector_0 * lapse_squared;
-    for (size_t i = 0; i < 3; ++i) {
-      get<gr::Tags::Shift<3, Frame::Inertial, DataType>>(result).get(i) =
-          temp * null_form.get(i);
-    }
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::I<DataType, 3>*> shift,
+    gr::Tags::Shift<3, Frame::Inertial, DataType> /*meta*/) const noexcept {
+  destructive_resize_components(shift, get_size(H));
+  for (size_t i = 0; i < 3; ++i) {
+    shift->get(i) =
+        -2.0 * null_vector_0 * H * lapse_squared * null_form.get(i);
   }
+}
 
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::I<DataType, 3>*> dt_shift,
+    ::Tags::dt<gr::Tags::Shift<3, Frame::Inertial, DataType>> /*meta*/) const
+    noexcept {
+  destructive_resize_components(dt_shift, get_size(H));
+  for (auto& component : *dt_shift) {
+    component = 0.0;
+  }
+}
+
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::iJ<DataType, 3>*> deriv_shift,
+    DerivShift<DataType> /*meta*/) const noexcept {
+  destructive_resize_components(deriv_shift, get_size(H));
   for (size_t m = 0; m < 3; ++m) {
     for (size_t i = 0; i < 3; ++i) {
-      get<DerivShift<DataType>>(result).get(m, i) =
+      deriv_shift->get(m, i) =
           4.0 * H * null_form.get(i) * square(lapse_squared) *
               cube(null_vector_0) * deriv_H.get(m) -
           2.0 * lapse_squared * null_vector_0 *
@@ -216,60 +239,99 @@ KerrSchild::variables(const tnsr::I<DataType, 3>& x, const double /*t*/,
                H * deriv_null_form.get(m, i));
     }
   }
+}
 
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::ii<DataType, 3>*> spatial_metric,
+    gr::Tags::SpatialMetric<3, Frame::Inertial, DataType> /*meta*/) const
+    noexcept {
+  destructive_resize_components(spatial_metric, get_size(H));
   for (size_t i = 0; i < 3; ++i) {
-    get<gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>(result).get(
-        i, i) = 1.;
     for (size_t j = i; j < 3; ++j) {  // Symmetry
-      get<gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>(result).get(
-          i, j) += 2.0 * H * null_form.get(i) * null_form.get(j);
+      spatial_metric->get(i, j) = 2.0 * H * null_form.get(i) * null_form.get(j);
     }
+    spatial_metric->get(i, i) += 1.0;
   }
+}
+
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::ii<DataType, 3>*> dt_spatial_metric,
+    ::Tags::dt<gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>> /*meta*/)
+    const noexcept {
+  destructive_resize_components(dt_spatial_metric, get_size(H));
+  for (auto& component : *dt_spatial_metric) {
+    component = 0.0;
+  }
+}
 
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::ijj<DataType, 3>*> deriv_spatial_metric,
+    DerivSpatialMetric<DataType> /*meta*/) const noexcept {
+  destructive_resize_components(deriv_spatial_metric, get_size(H));
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {  // Symmetry
       for (size_t m = 0; m < 3; ++m) {
-        get<DerivSpatialMetric<DataType>>(result).get(m, i, j) =
+        deriv_spatial_metric->get(m, i, j) =
             2.0 * null_form.get(i) * null_form.get(j) * deriv_H.get(m) +
             2.0 * H * (null_form.get(i) * deriv_null_form.get(m, j) +
                        null_form.get(j) * deriv_null_form.get(m, i));
       }
     }
   }
+}
 
-  auto det_and_inverse = determinant_and_inverse(
-      get<gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>(result));
-
-  get(get<gr::Tags::SqrtDetSpatialMetric<DataType>>(result)) =
-      sqrt(get(det_and_inverse.first));
-
-  get<gr::Tags::InverseSpatialMetric<3, Frame::Inertial, DataType>>(result) =
-      det_and_inverse.second;
+// The spatial metric is the identity plus the rank-one update
+// 2 H l_i l_j, so its determinant is 1 + 2 H l_k l_k and its inverse is
+// given by the Sherman-Morrison formula.
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<Scalar<DataType>*> sqrt_det_spatial_metric,
+    gr::Tags::SqrtDetSpatialMetric<DataType> /*meta*/) const noexcept {
+  destructive_resize_components(sqrt_det_spatial_metric, get_size(H));
+  get(*sqrt_det_spatial_metric) =
+      sqrt(1.0 + 2.0 * H * (square(get<0>(null_form)) +
+                            square(get<1>(null_form)) +
+                            square(get<2>(null_form))));
+}
 
-  get<gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>>(result) =
-      gr::extrinsic_curvature(
-          get<gr::Tags::Lapse<DataType>>(result),
-          get<gr::Tags::Shift<3, Frame::Inertial, DataType>>(result),
-          get<DerivShift<DataType>>(result),
-          get<gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>(result),
-          get<::Tags::dt<
-              gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>>(result),
-          get<DerivSpatialMetric<DataType>>(result));
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::II<DataType, 3>*> inverse_spatial_metric,
+    gr::Tags::InverseSpatialMetric<3, Frame::Inertial, DataType> /*meta*/)
+    const noexcept {
+  destructive_resize_components(inverse_spatial_metric, get_size(H));
+  const DataType temp =
+      2.0 * H /
+      (1.0 + 2.0 * H * (square(get<0>(null_form)) + square(get<1>(null_form)) +
+                        square(get<2>(null_form))));
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = i; j < 3; ++j) {  // Symmetry
+      inverse_spatial_metric->get(i, j) =
+          -temp * null_form.get(i) * null_form.get(j);
+    }
+    inverse_spatial_metric->get(i, i) += 1.0;
+  }
+}
 
-  return result;
+template <typename DataType>
+void KerrSchild::IntermediateVars<DataType>::operator()(
+    const gsl::not_null<tnsr::ii<DataType, 3>*> extrinsic_curvature,
+    gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType> /*meta*/,
+    const Scalar<DataType>& lapse, const tnsr::I<DataType, 3>& shift,
+    const tnsr::iJ<DataType, 3>& deriv_shift,
+    const tnsr::ii<DataType, 3>& spatial_metric,
+    const tnsr::ii<DataType, 3>& dt_spatial_metric,
+    const tnsr::ijj<DataType, 3>& deriv_spatial_metric) const noexcept {
+  gr::extrinsic_curvature(extrinsic_curvature, lapse, shift, deriv_shift,
+                          spatial_metric, dt_spatial_metric,
+                          deriv_spatial_metric);
 }
 }  // namespace Solutions
 }  // namespace gr
 
-template tuples::tagged_tuple_from_typelist<
-    gr::Solutions::KerrSchild::tags<DataVector>>
-gr::Solutions::KerrSchild::variables(
-    const tnsr::I<DataVector, 3>& x, const double /*t*/,
-    KerrSchild::tags<DataVector> /*meta*/) const noexcept;
-template tuples::tagged_tuple_from_typelist<
-    gr::Solutions::KerrSchild::tags<double>>
-gr::Solutions::KerrSchild::variables(const tnsr::I<double, 3>& x,
-                                     const double /*t*/,
-                                     KerrSchild::tags<double> /*meta*/) const
-    noexcept;
+template struct gr::Solutions::KerrSchild::IntermediateVars<double>;
+template struct gr::Solutions::KerrSchild::IntermediateVars<DataVector>;
 /// \endcond
@@ -4,12 +4,15 @@
 #pragma once
 
 #include <array>
+#include <utility>
 
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "Options/Options.hpp"
-#include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/ForceInline.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -17,10 +20,6 @@
 namespace PUP {
 class er;  // IWYU pragma: keep
 }  // namespace PUP
-namespace Tags {
-template <typename Tag>
-struct dt;
-}  // namespace Tags
 /// \endcond
 
 // IWYU pragma: no_include <pup.h>
@@ -264,10 +263,33 @@ class KerrSchild {
       gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>,
       gr::Tags::InverseSpatialMetric<3, Frame::Inertial, DataType>>;
 
-  template <typename DataType>
-  tuples::tagged_tuple_from_typelist<tags<DataType>> variables(
-      const tnsr::I<DataType, 3>& x, double t, tags<DataType> /*meta*/) const
-      noexcept;
+  /*!
+   * \brief The variables `Tags` at the coordinates `x`, where `Tags` is any
+   * subset of `tags<DataType>`.
+   *
+   * The quantities shared by the variables, such as \f$H\f$, \f$l_i\f$ and
+   * their derivatives, are computed once per call and all requested variables
+   * are computed from them. Requesting several variables at once is therefore
+   * cheaper than requesting them one at a time.
+   */
+  template <typename DataType, typename... Tags>
+  tuples::TaggedTuple<Tags...> variables(
+      const tnsr::I<DataType, 3>& x, const double /*t*/,
+      tmpl::list<Tags...> /*meta*/) const noexcept {
+    static_assert(
+        tmpl2::flat_all_v<tmpl::list_contains_v<tags<DataType>, Tags>...>,
+        "Not all requested tags are variables of the KerrSchild solution.");
+    using computed_tags = tags_to_compute<DataType, tmpl::list<Tags...>>;
+    const IntermediateVars<DataType> intermediate_vars(
+        mass_, dimensionless_spin_, center_, x);
+    tuples::tagged_tuple_from_typelist<computed_tags> computed_vars{};
+    tmpl::for_each<computed_tags>(
+        [&computed_vars, &intermediate_vars ](auto tag_v) noexcept {
+          using tag = typename decltype(tag_v)::type;
+          compute(make_not_null(&computed_vars), intermediate_vars, tag{});
+        });
+    return {std::move(tuples::get<Tags>(computed_vars))...};
+  }
 
   // clang-tidy: no runtime references
   void pup(PUP::er& p) noexcept;  // NOLINT
@@ -282,6 +304,117 @@ class KerrSchild {
   }
 
  private:
+  // The extrinsic curvature is computed from the metric variables, so these
+  // are computed before it even if they were not requested.
+  template <typename DataType, typename RequestedTags>
+  using tags_to_compute = tmpl::conditional_t<
+      tmpl::list_contains_v<
+          RequestedTags,
+          gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>>,
+      tmpl::push_back<
+          tmpl::remove_duplicates<tmpl::append<
+              tmpl::remove<
+                  RequestedTags,
+                  gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>>,
+              tmpl::list<
+                  gr::Tags::Lapse<DataType>,
+                  gr::Tags::Shift<3, Frame::Inertial, DataType>,
+                  DerivShift<DataType>,
+                  gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>,
+                  ::Tags::dt<
+                      gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>,
+                  DerivSpatialMetric<DataType>>>>,
+          gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>>,
+      RequestedTags>;
+
+  // The quantities shared by the variables of the solution, and the functions
+  // that compute each variable from them.
+  template <typename DataType>
+  struct IntermediateVars {
+    IntermediateVars(double mass,
+                     const std::array<double, 3>& dimensionless_spin,
+                     const std::array<double, 3>& center,
+                     const tnsr::I<DataType, 3>& x) noexcept;
+
+    void operator()(gsl::not_null<Scalar<DataType>*> lapse,
+                    gr::Tags::Lapse<DataType> /*meta*/) const noexcept;
+    void operator()(gsl::not_null<Scalar<DataType>*> dt_lapse,
+                    ::Tags::dt<gr::Tags::Lapse<DataType>> /*meta*/) const
+        noexcept;
+    void operator()(gsl::not_null<tnsr::i<DataType, 3>*> deriv_lapse,
+                    DerivLapse<DataType> /*meta*/) const noexcept;
+    void operator()(
+        gsl::not_null<tnsr::I<DataType, 3>*> shift,
+        gr::Tags::Shift<3, Frame::Inertial, DataType> /*meta*/) const noexcept;
+    void operator()(
+        gsl::not_null<tnsr::I<DataType, 3>*> dt_shift,
+        ::Tags::dt<gr::Tags::Shift<3, Frame::Inertial, DataType>> /*meta*/)
+        const noexcept;
+    void operator()(gsl::not_null<tnsr::iJ<DataType, 3>*> deriv_shift,
+                    DerivShift<DataType> /*meta*/) const noexcept;
+    void operator()(
+        gsl::not_null<tnsr::ii<DataType, 3>*> spatial_metric,
+        gr::Tags::SpatialMetric<3, Frame::Inertial, DataType> /*meta*/) const
+        noexcept;
+    void operator()(
+        gsl::not_null<tnsr::ii<DataType, 3>*> dt_spatial_metric,
+        ::Tags::dt<
+            gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>> /*meta*/)
+        const noexcept;
+    void operator()(gsl::not_null<tnsr::ijj<DataType, 3>*> deriv_spatial_metric,
+                    DerivSpatialMetric<DataType> /*meta*/) const noexcept;
+    void operator()(gsl::not_null<Scalar<DataType>*> sqrt_det_spatial_metric,
+                    gr::Tags::SqrtDetSpatialMetric<DataType> /*meta*/) const
+        noexcept;
+    void operator()(
+        gsl::not_null<tnsr::II<DataType, 3>*> inverse_spatial_metric,
+        gr::Tags::InverseSpatialMetric<3, Frame::Inertial, DataType> /*meta*/)
+        const noexcept;
+    void operator()(
+        gsl::not_null<tnsr::ii<DataType, 3>*> extrinsic_curvature,
+        gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType> /*meta*/,
+        const Scalar<DataType>& lapse, const tnsr::I<DataType, 3>& shift,
+        const tnsr::iJ<DataType, 3>& deriv_shift,
+        const tnsr::ii<DataType, 3>& spatial_metric,
+        const tnsr::ii<DataType, 3>& dt_spatial_metric,
+        const tnsr::ijj<DataType, 3>& deriv_spatial_metric) const noexcept;
+
+    DataType H{};
+    DataType lapse_squared{};
+    tnsr::i<DataType, 3> deriv_H{};
+    tnsr::i<DataType, 3> null_form{};
+    tnsr::ij<DataType, 3> deriv_null_form{};
+  };
+
+  template <typename DataType, typename Tag, typename ComputedVars>
+  static void compute(const gsl::not_null<ComputedVars*> computed_vars,
+                      const IntermediateVars<DataType>& intermediate_vars,
+                      Tag /*meta*/) noexcept {
+    intermediate_vars(make_not_null(&tuples::get<Tag>(*computed_vars)), Tag{});
+  }
+
+  template <typename DataType, typename ComputedVars>
+  static void compute(
+      const gsl::not_null<ComputedVars*> computed_vars,
+      const IntermediateVars<DataType>& intermediate_vars,
+      gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType> /*meta*/)
+      noexcept {
+    using extrinsic_curvature_tag =
+        gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>;
+    using shift_tag = gr::Tags::Shift<3, Frame::Inertial, DataType>;
+    using spatial_metric_tag =
+        gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>;
+    intermediate_vars(
+        make_not_null(&tuples::get<extrinsic_curvature_tag>(*computed_vars)),
+        extrinsic_curvature_tag{},
+        tuples::get<gr::Tags::Lapse<DataType>>(*computed_vars),
+        tuples::get<shift_tag>(*computed_vars),
+        tuples::get<DerivShift<DataType>>(*computed_vars),
+        tuples::get<spatial_metric_tag>(*computed_vars),
+        tuples::get<::Tags::dt<spatial_metric_tag>>(*computed_vars),
+        tuples::get<DerivSpatialMetric<DataType>>(*computed_vars));
+  }
+
   double mass_{1.0};
   std::array<double, 3> dimensionless_spin_{{0.0, 0.0, 0.0}},
       center_{{0.0, 0.0, 0.0}};
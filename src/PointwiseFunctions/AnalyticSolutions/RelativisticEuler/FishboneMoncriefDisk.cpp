@@ -150,7 +150,10 @@ FishboneMoncriefDisk::IntermediateVariables<DataType, NeedSpacetime>::
 
   if (NeedSpacetime) {
     auto kerr_schild_metric = background_spacetime.variables(
-        x, t, gr::Solutions::KerrSchild::tags<DataType>{});
+        x, t,
+        tmpl::list<gr::Tags::Lapse<DataType>,
+                   gr::Tags::Shift<3, Frame::Inertial, DataType>,
+                   gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>{});
 
     inv_lapse = std::move(get<gr::Tags::Lapse<DataType>>(kerr_schild_metric));
     get(inv_lapse) = 1.0 / get(inv_lapse);
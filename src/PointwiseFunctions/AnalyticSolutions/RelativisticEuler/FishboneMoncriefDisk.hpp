@@ -365,8 +365,8 @@ class FishboneMoncriefDisk {
       const tnsr::I<DataType, 3>& x, tmpl::list<Tag> /*meta*/,
       const IntermediateVariables<DataType, true>& /*vars*/) const noexcept {
     constexpr double dummy_time = 0.0;
-    return {std::move(get<Tag>(background_spacetime_.variables(
-        x, dummy_time, gr::Solutions::KerrSchild::tags<DataType>{})))};
+    return {std::move(get<Tag>(
+        background_spacetime_.variables(x, dummy_time, tmpl::list<Tag>{})))};
   }
 
   template <typename DataType, bool NeedSpacetime, typename Func>
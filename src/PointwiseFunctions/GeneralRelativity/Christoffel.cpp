@@ -4,26 +4,35 @@
 #include "PointwiseFunctions/GeneralRelativity/Christoffel.hpp"
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
-#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace gr {
 template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
-tnsr::abb<DataType, SpatialDim, Frame, Index> christoffel_first_kind(
-    const tnsr::abb<DataType, SpatialDim, Frame, Index>& d_metric) {
-  auto christoffel =
-      make_with_value<tnsr::abb<DataType, SpatialDim, Frame, Index>>(d_metric,
-                                                                     0.);
-  constexpr auto dimensionality = index_dim<0>(christoffel);
+void christoffel_first_kind(
+    const gsl::not_null<tnsr::abb<DataType, SpatialDim, Frame, Index>*>
+        christoffel,
+    const tnsr::abb<DataType, SpatialDim, Frame, Index>& d_metric) noexcept {
+  destructive_resize_components(christoffel,
+                                get_size(get<0, 0, 0>(d_metric)));
+  constexpr auto dimensionality = index_dim<0>(d_metric);
   for (size_t k = 0; k < dimensionality; ++k) {
     for (size_t i = 0; i < dimensionality; ++i) {
       for (size_t j = i; j < dimensionality; ++j) {
-        christoffel.get(k, i, j) =
+        christoffel->get(k, i, j) =
             0.5 * (d_metric.get(i, j, k) + d_metric.get(j, i, k) -
                    d_metric.get(k, i, j));
       }
     }
   }
+}
+
+template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
+tnsr::abb<DataType, SpatialDim, Frame, Index> christoffel_first_kind(
+    const tnsr::abb<DataType, SpatialDim, Frame, Index>& d_metric) noexcept {
+  tnsr::abb<DataType, SpatialDim, Frame, Index> christoffel{};
+  christoffel_first_kind(make_not_null(&christoffel), d_metric);
   return christoffel;
 }
 }  // namespace gr
@@ -35,11 +44,17 @@ tnsr::abb<DataType, SpatialDim, Frame, Index> christoffel_first_kind(
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(2, data)
 #define INDEXTYPE(data) BOOST_PP_TUPLE_ELEM(3, data)
 
-#define INSTANTIATE(_, data)                                                 \
-  template tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>   \
-  gr::christoffel_first_kind(                                                \
-      const tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>& \
-          d_metric);
+#define INSTANTIATE(_, data)                                                   \
+  template void gr::christoffel_first_kind(                                    \
+      const gsl::not_null<                                                     \
+          tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>*>    \
+          christoffel,                                                         \
+      const tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&   \
+          d_metric) noexcept;                                                  \
+  template tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>     \
+  gr::christoffel_first_kind(                                                  \
+      const tnsr::abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&   \
+          d_metric) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
                         (Frame::Grid, Frame::Inertial,
@@ -6,110 +6,162 @@
 #include <cmath>
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
-#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace gr {
 template <size_t Dim, typename Frame, typename DataType>
-tnsr::aa<DataType, Dim, Frame> spacetime_metric(
+void spacetime_metric(
+    const gsl::not_null<tnsr::aa<DataType, Dim, Frame>*> spacetime_metric,
     const Scalar<DataType>& lapse, const tnsr::I<DataType, Dim, Frame>& shift,
     const tnsr::ii<DataType, Dim, Frame>& spatial_metric) noexcept {
-  auto spacetime_metric =
-      make_with_value<tnsr::aa<DataType, Dim, Frame>>(lapse, 0.);
+  destructive_resize_components(spacetime_metric, get_size(get(lapse)));
 
-  get<0, 0>(spacetime_metric) = -get(lapse) * get(lapse);
+  get<0, 0>(*spacetime_metric) = -get(lapse) * get(lapse);
 
   for (size_t m = 0; m < Dim; ++m) {
-    get<0, 0>(spacetime_metric) +=
+    get<0, 0>(*spacetime_metric) +=
         spatial_metric.get(m, m) * shift.get(m) * shift.get(m);
     for (size_t n = 0; n < m; ++n) {
-      get<0, 0>(spacetime_metric) +=
+      get<0, 0>(*spacetime_metric) +=
           2 * spatial_metric.get(m, n) * shift.get(m) * shift.get(n);
     }
   }
 
   for (size_t i = 0; i < Dim; ++i) {
-    for (size_t m = 0; m < Dim; ++m) {
-      spacetime_metric.get(0, i + 1) += spatial_metric.get(m, i) * shift.get(m);
+    spacetime_metric->get(0, i + 1) = spatial_metric.get(0, i) * shift.get(0);
+    for (size_t m = 1; m < Dim; ++m) {
+      spacetime_metric->get(0, i + 1) +=
+          spatial_metric.get(m, i) * shift.get(m);
     }
     for (size_t j = i; j < Dim; ++j) {
-      spacetime_metric.get(i + 1, j + 1) = spatial_metric.get(i, j);
+      spacetime_metric->get(i + 1, j + 1) = spatial_metric.get(i, j);
     }
   }
+}
+
+template <size_t Dim, typename Frame, typename DataType>
+tnsr::aa<DataType, Dim, Frame> spacetime_metric(
+    const Scalar<DataType>& lapse, const tnsr::I<DataType, Dim, Frame>& shift,
+    const tnsr::ii<DataType, Dim, Frame>& spatial_metric) noexcept {
+  tnsr::aa<DataType, Dim, Frame> spacetime_metric{};
+  gr::spacetime_metric(make_not_null(&spacetime_metric), lapse, shift,
+                       spatial_metric);
   return spacetime_metric;
 }
 
 template <size_t SpatialDim, typename Frame, typename DataType>
-tnsr::ii<DataType, SpatialDim, Frame> spatial_metric(
+void spatial_metric(
+    const gsl::not_null<tnsr::ii<DataType, SpatialDim, Frame>*> spatial_metric,
     const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric) noexcept {
-  auto spatial_metric = make_with_value<tnsr::ii<DataType, SpatialDim, Frame>>(
-      spacetime_metric, 0.);
+  destructive_resize_components(spatial_metric,
+                                get_size(get<0, 0>(spacetime_metric)));
   for (size_t i = 0; i < SpatialDim; ++i) {
     for (size_t j = i; j < SpatialDim; ++j) {
-      spatial_metric.get(i, j) = spacetime_metric.get(i + 1, j + 1);
+      spatial_metric->get(i, j) = spacetime_metric.get(i + 1, j + 1);
     }
   }
+}
+
+template <size_t SpatialDim, typename Frame, typename DataType>
+tnsr::ii<DataType, SpatialDim, Frame> spatial_metric(
+    const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric) noexcept {
+  tnsr::ii<DataType, SpatialDim, Frame> spatial_metric{};
+  gr::spatial_metric(make_not_null(&spatial_metric), spacetime_metric);
   return spatial_metric;
 }
 
 template <size_t Dim, typename Frame, typename DataType>
-tnsr::AA<DataType, Dim, Frame> inverse_spacetime_metric(
+void inverse_spacetime_metric(
+    const gsl::not_null<tnsr::AA<DataType, Dim, Frame>*>
+        inverse_spacetime_metric,
     const Scalar<DataType>& lapse, const tnsr::I<DataType, Dim, Frame>& shift,
     const tnsr::II<DataType, Dim, Frame>& inverse_spatial_metric) noexcept {
-  auto inverse_spacetime_metric =
-      make_with_value<tnsr::AA<DataType, Dim, Frame>>(lapse, 0.);
+  destructive_resize_components(inverse_spacetime_metric,
+                                get_size(get(lapse)));
 
-  get<0, 0>(inverse_spacetime_metric) = -1.0 / (get(lapse) * get(lapse));
+  get<0, 0>(*inverse_spacetime_metric) = -1.0 / (get(lapse) * get(lapse));
 
-  const auto& minus_one_over_lapse_sqrd = get<0, 0>(inverse_spacetime_metric);
+  const auto& minus_one_over_lapse_sqrd =
+      get<0, 0>(*inverse_spacetime_metric);
 
   for (size_t i = 0; i < Dim; ++i) {
-    inverse_spacetime_metric.get(0, i + 1) =
+    inverse_spacetime_metric->get(0, i + 1) =
         -shift.get(i) * minus_one_over_lapse_sqrd;
   }
 
   for (size_t i = 0; i < Dim; ++i) {
     for (size_t j = i; j < Dim; ++j) {
-      inverse_spacetime_metric.get(i + 1, j + 1) =
+      inverse_spacetime_metric->get(i + 1, j + 1) =
           inverse_spatial_metric.get(i, j) +
           shift.get(i) * shift.get(j) * minus_one_over_lapse_sqrd;
     }
   }
+}
+
+template <size_t Dim, typename Frame, typename DataType>
+tnsr::AA<DataType, Dim, Frame> inverse_spacetime_metric(
+    const Scalar<DataType>& lapse, const tnsr::I<DataType, Dim, Frame>& shift,
+    const tnsr::II<DataType, Dim, Frame>& inverse_spatial_metric) noexcept {
+  tnsr::AA<DataType, Dim, Frame> inverse_spacetime_metric{};
+  gr::inverse_spacetime_metric(make_not_null(&inverse_spacetime_metric),
+                               lapse, shift, inverse_spatial_metric);
   return inverse_spacetime_metric;
 }
 
 template <size_t SpatialDim, typename Frame, typename DataType>
-tnsr::I<DataType, SpatialDim, Frame> shift(
-    const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
-    const tnsr::II<DataType, SpatialDim, Frame>&
-        inverse_spatial_metric) noexcept {
-  auto shift = make_with_value<tnsr::I<DataType, SpatialDim, Frame>>(
-      spacetime_metric, 0.);
+void shift(const gsl::not_null<tnsr::I<DataType, SpatialDim, Frame>*> shift,
+           const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
+           const tnsr::II<DataType, SpatialDim, Frame>&
+               inverse_spatial_metric) noexcept {
+  destructive_resize_components(shift, get_size(get<0, 0>(spacetime_metric)));
   for (size_t i = 0; i < SpatialDim; ++i) {
-    for (size_t j = 0; j < SpatialDim; ++j) {
-      shift.get(i) +=
+    shift->get(i) =
+        inverse_spatial_metric.get(i, 0) * spacetime_metric.get(1, 0);
+    for (size_t j = 1; j < SpatialDim; ++j) {
+      shift->get(i) +=
           inverse_spatial_metric.get(i, j) * spacetime_metric.get(j + 1, 0);
     }
   }
+}
+
+template <size_t SpatialDim, typename Frame, typename DataType>
+tnsr::I<DataType, SpatialDim, Frame> shift(
+    const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric,
+    const tnsr::II<DataType, SpatialDim, Frame>&
+        inverse_spatial_metric) noexcept {
+  tnsr::I<DataType, SpatialDim, Frame> shift{};
+  gr::shift(make_not_null(&shift), spacetime_metric, inverse_spatial_metric);
   return shift;
 }
 
 template <size_t SpatialDim, typename Frame, typename DataType>
-Scalar<DataType> lapse(
+void lapse(
+    const gsl::not_null<Scalar<DataType>*> lapse,
     const tnsr::I<DataType, SpatialDim, Frame>& shift,
     const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric) noexcept {
-  auto lapse = make_with_value<Scalar<DataType>>(shift, 0.);
-  get(lapse) = -get<0, 0>(spacetime_metric);
+  destructive_resize_components(lapse, get_size(get<0>(shift)));
+  get(*lapse) = -get<0, 0>(spacetime_metric);
   for (size_t i = 0; i < SpatialDim; ++i) {
-    get(lapse) += shift.get(i) * spacetime_metric.get(i + 1, 0);
+    get(*lapse) += shift.get(i) * spacetime_metric.get(i + 1, 0);
   }
-  get(lapse) = sqrt(get(lapse));
+  get(*lapse) = sqrt(get(*lapse));
+}
 
+template <size_t SpatialDim, typename Frame, typename DataType>
+Scalar<DataType> lapse(
+    const tnsr::I<DataType, SpatialDim, Frame>& shift,
+    const tnsr::aa<DataType, SpatialDim, Frame>& spacetime_metric) noexcept {
+  Scalar<DataType> lapse{};
+  gr::lapse(make_not_null(&lapse), shift, spacetime_metric);
   return lapse;
 }
 
 template <size_t Dim, typename Frame, typename DataType>
-tnsr::abb<DataType, Dim, Frame> derivatives_of_spacetime_metric(
+void derivatives_of_spacetime_metric(
+    const gsl::not_null<tnsr::abb<DataType, Dim, Frame>*>
+        spacetime_deriv_spacetime_metric,
     const Scalar<DataType>& lapse, const Scalar<DataType>& dt_lapse,
     const tnsr::i<DataType, Dim, Frame>& deriv_lapse,
     const tnsr::I<DataType, Dim, Frame>& shift,
@@ -118,38 +170,41 @@ tnsr::abb<DataType, Dim, Frame> derivatives_of_spacetime_metric(
     const tnsr::ii<DataType, Dim, Frame>& spatial_metric,
     const tnsr::ii<DataType, Dim, Frame>& dt_spatial_metric,
     const tnsr::ijj<DataType, Dim, Frame>& deriv_spatial_metric) noexcept {
-  auto spacetime_deriv_spacetime_metric =
-      make_with_value<tnsr::abb<DataType, Dim, Frame>>(lapse, 0.);
+  destructive_resize_components(spacetime_deriv_spacetime_metric,
+                                get_size(get(lapse)));
 
-  get<0, 0, 0>(spacetime_deriv_spacetime_metric) =
+  get<0, 0, 0>(*spacetime_deriv_spacetime_metric) =
       -2.0 * get(lapse) * get(dt_lapse);
 
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t n = 0; n < Dim; ++n) {
-      get<0, 0, 0>(spacetime_deriv_spacetime_metric) +=
+      get<0, 0, 0>(*spacetime_deriv_spacetime_metric) +=
           dt_spatial_metric.get(m, n) * shift.get(m) * shift.get(n) +
           2.0 * spatial_metric.get(m, n) * shift.get(m) * dt_shift.get(n);
     }
   }
 
   for (size_t i = 0; i < Dim; ++i) {
-    for (size_t m = 0; m < Dim; ++m) {
-      spacetime_deriv_spacetime_metric.get(0, 0, i + 1) +=
+    spacetime_deriv_spacetime_metric->get(0, 0, i + 1) =
+        dt_spatial_metric.get(0, i) * shift.get(0) +
+        spatial_metric.get(0, i) * dt_shift.get(0);
+    for (size_t m = 1; m < Dim; ++m) {
+      spacetime_deriv_spacetime_metric->get(0, 0, i + 1) +=
           dt_spatial_metric.get(m, i) * shift.get(m) +
           spatial_metric.get(m, i) * dt_shift.get(m);
     }
     for (size_t j = i; j < Dim; ++j) {
-      spacetime_deriv_spacetime_metric.get(0, i + 1, j + 1) =
+      spacetime_deriv_spacetime_metric->get(0, i + 1, j + 1) =
           dt_spatial_metric.get(i, j);
     }
   }
 
   for (size_t k = 0; k < Dim; ++k) {
-    spacetime_deriv_spacetime_metric.get(k + 1, 0, 0) =
+    spacetime_deriv_spacetime_metric->get(k + 1, 0, 0) =
         -2.0 * get(lapse) * deriv_lapse.get(k);
     for (size_t m = 0; m < Dim; ++m) {
       for (size_t n = 0; n < Dim; ++n) {
-        spacetime_deriv_spacetime_metric.get(k + 1, 0, 0) +=
+        spacetime_deriv_spacetime_metric->get(k + 1, 0, 0) +=
             deriv_spatial_metric.get(k, m, n) * shift.get(m) * shift.get(n) +
             2.0 * spatial_metric.get(m, n) * shift.get(m) *
                 deriv_shift.get(k, n);
@@ -157,46 +212,88 @@ tnsr::abb<DataType, Dim, Frame> derivatives_of_spacetime_metric(
     }
 
     for (size_t i = 0; i < Dim; ++i) {
-      for (size_t m = 0; m < Dim; ++m) {
-        spacetime_deriv_spacetime_metric.get(k + 1, 0, i + 1) +=
+      spacetime_deriv_spacetime_metric->get(k + 1, 0, i + 1) =
+          deriv_spatial_metric.get(k, 0, i) * shift.get(0) +
+          spatial_metric.get(0, i) * deriv_shift.get(k, 0);
+      for (size_t m = 1; m < Dim; ++m) {
+        spacetime_deriv_spacetime_metric->get(k + 1, 0, i + 1) +=
             deriv_spatial_metric.get(k, m, i) * shift.get(m) +
             spatial_metric.get(m, i) * deriv_shift.get(k, m);
       }
       for (size_t j = i; j < Dim; ++j) {
-        spacetime_deriv_spacetime_metric.get(k + 1, i + 1, j + 1) =
+        spacetime_deriv_spacetime_metric->get(k + 1, i + 1, j + 1) =
             deriv_spatial_metric.get(k, i, j);
       }
     }
   }
+}
 
+template <size_t Dim, typename Frame, typename DataType>
+tnsr::abb<DataType, Dim, Frame> derivatives_of_spacetime_metric(
+    const Scalar<DataType>& lapse, const Scalar<DataType>& dt_lapse,
+    const tnsr::i<DataType, Dim, Frame>& deriv_lapse,
+    const tnsr::I<DataType, Dim, Frame>& shift,
+    const tnsr::I<DataType, Dim, Frame>& dt_shift,
+    const tnsr::iJ<DataType, Dim, Frame>& deriv_shift,
+    const tnsr::ii<DataType, Dim, Frame>& spatial_metric,
+    const tnsr::ii<DataType, Dim, Frame>& dt_spatial_metric,
+    const tnsr::ijj<DataType, Dim, Frame>& deriv_spatial_metric) noexcept {
+  tnsr::abb<DataType, Dim, Frame> spacetime_deriv_spacetime_metric{};
+  gr::derivatives_of_spacetime_metric(
+      make_not_null(&spacetime_deriv_spacetime_metric), lapse, dt_lapse,
+      deriv_lapse, shift, dt_shift, deriv_shift, spatial_metric,
+      dt_spatial_metric, deriv_spatial_metric);
   return spacetime_deriv_spacetime_metric;
 }
 
+template <size_t SpatialDim, typename Frame, typename DataType>
+void spacetime_normal_one_form(
+    const gsl::not_null<tnsr::a<DataType, SpatialDim, Frame>*>
+        normal_one_form,
+    const Scalar<DataType>& lapse) noexcept {
+  destructive_resize_components(normal_one_form, get_size(get(lapse)));
+  get<0>(*normal_one_form) = -get(lapse);
+  for (size_t i = 0; i < SpatialDim; ++i) {
+    normal_one_form->get(i + 1) = 0.0;
+  }
+}
+
 template <size_t SpatialDim, typename Frame, typename DataType>
 tnsr::a<DataType, SpatialDim, Frame> spacetime_normal_one_form(
     const Scalar<DataType>& lapse) noexcept {
-  auto normal_one_form =
-      make_with_value<tnsr::a<DataType, SpatialDim, Frame>>(lapse, 0.);
-  get<0>(normal_one_form) = -get(lapse);
+  tnsr::a<DataType, SpatialDim, Frame> normal_one_form{};
+  gr::spacetime_normal_one_form(make_not_null(&normal_one_form), lapse);
   return normal_one_form;
 }
 
 template <size_t SpatialDim, typename Frame, typename DataType>
-tnsr::A<DataType, SpatialDim, Frame> spacetime_normal_vector(
+void spacetime_normal_vector(
+    const gsl::not_null<tnsr::A<DataType, SpatialDim, Frame>*>
+        spacetime_normal_vector,
     const Scalar<DataType>& lapse,
     const tnsr::I<DataType, SpatialDim, Frame>& shift) noexcept {
-  auto spacetime_normal_vector =
-      make_with_value<tnsr::A<DataType, SpatialDim, Frame>>(lapse, 0.);
-  get<0>(spacetime_normal_vector) = 1. / get(lapse);
+  destructive_resize_components(spacetime_normal_vector,
+                                get_size(get(lapse)));
+  get<0>(*spacetime_normal_vector) = 1. / get(lapse);
   for (size_t i = 0; i < SpatialDim; i++) {
-    spacetime_normal_vector.get(i + 1) =
-        -shift.get(i) * get<0>(spacetime_normal_vector);
+    spacetime_normal_vector->get(i + 1) =
+        -shift.get(i) * get<0>(*spacetime_normal_vector);
   }
+}
+
+template <size_t SpatialDim, typename Frame, typename DataType>
+tnsr::A<DataType, SpatialDim, Frame> spacetime_normal_vector(
+    const Scalar<DataType>& lapse,
+    const tnsr::I<DataType, SpatialDim, Frame>& shift) noexcept {
+  tnsr::A<DataType, SpatialDim, Frame> spacetime_normal_vector{};
+  gr::spacetime_normal_vector(make_not_null(&spacetime_normal_vector), lapse,
+                              shift);
   return spacetime_normal_vector;
 }
 
 template <size_t SpatialDim, typename Frame, typename DataType>
-tnsr::ii<DataType, SpatialDim, Frame> extrinsic_curvature(
+void extrinsic_curvature(
+    const gsl::not_null<tnsr::ii<DataType, SpatialDim, Frame>*> ex_curvature,
     const Scalar<DataType>& lapse,
     const tnsr::I<DataType, SpatialDim, Frame>& shift,
     const tnsr::iJ<DataType, SpatialDim, Frame>& deriv_shift,
@@ -204,23 +301,34 @@ tnsr::ii<DataType, SpatialDim, Frame> extrinsic_curvature(
     const tnsr::ii<DataType, SpatialDim, Frame>& dt_spatial_metric,
     const tnsr::ijj<DataType, SpatialDim, Frame>&
         deriv_spatial_metric) noexcept {
-  const DataType half_over_lapse = 0.5 / get(lapse);
-
-  auto ex_curvature =
-      make_with_value<tnsr::ii<DataType, SpatialDim, Frame>>(lapse, 0.0);
+  destructive_resize_components(ex_curvature, get_size(get(lapse)));
   for (size_t i = 0; i < SpatialDim; ++i) {
     for (size_t j = i; j < SpatialDim; ++j) {  // Symmetry
+      ex_curvature->get(i, j) = -dt_spatial_metric.get(i, j);
       for (size_t k = 0; k < SpatialDim; ++k) {
-        ex_curvature.get(i, j) +=
+        ex_curvature->get(i, j) +=
             shift.get(k) * deriv_spatial_metric.get(k, i, j) +
             spatial_metric.get(k, i) * deriv_shift.get(j, k) +
             spatial_metric.get(k, j) * deriv_shift.get(i, k);
       }
-      ex_curvature.get(i, j) -= dt_spatial_metric.get(i, j);
-      ex_curvature.get(i, j) *= half_over_lapse;
+      ex_curvature->get(i, j) *= 0.5 / get(lapse);
     }
   }
+}
 
+template <size_t SpatialDim, typename Frame, typename DataType>
+tnsr::ii<DataType, SpatialDim, Frame> extrinsic_curvature(
+    const Scalar<DataType>& lapse,
+    const tnsr::I<DataType, SpatialDim, Frame>& shift,
+    const tnsr::iJ<DataType, SpatialDim, Frame>& deriv_shift,
+    const tnsr::ii<DataType, SpatialDim, Frame>& spatial_metric,
+    const tnsr::ii<DataType, SpatialDim, Frame>& dt_spatial_metric,
+    const tnsr::ijj<DataType, SpatialDim, Frame>&
+        deriv_spatial_metric) noexcept {
+  tnsr::ii<DataType, SpatialDim, Frame> ex_curvature{};
+  gr::extrinsic_curvature(make_not_null(&ex_curvature), lapse, shift,
+                          deriv_shift, spatial_metric, dt_spatial_metric,
+                          deriv_spatial_metric);
   return ex_curvature;
 }
 }  // namespace gr
@@ -236,26 +344,70 @@ tnsr::ii<DataType, SpatialDim, Frame> extrinsic_curvature(
       const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
       const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>&                     \
           spatial_metric) noexcept;                                            \
+  template void gr::spacetime_metric(                                          \
+      const gsl::not_null<tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>*>      \
+          spacetime_metric,                                                    \
+      const Scalar<DTYPE(data)>& lapse,                                        \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
+      const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          spatial_metric) noexcept;                                            \
   template tnsr::ii<DTYPE(data), DIM(data), FRAME(data)> gr::spatial_metric(   \
       const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>&                     \
           spacetime_metric) noexcept;                                          \
+  template void gr::spatial_metric(                                            \
+      const gsl::not_null<tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>*>      \
+          spatial_metric,                                                      \
+      const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          spacetime_metric) noexcept;                                          \
   template tnsr::AA<DTYPE(data), DIM(data), FRAME(data)>                       \
   gr::inverse_spacetime_metric(                                                \
       const Scalar<DTYPE(data)>& lapse,                                        \
       const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
       const tnsr::II<DTYPE(data), DIM(data), FRAME(data)>&                     \
           inverse_spatial_metric) noexcept;                                    \
+  template void gr::inverse_spacetime_metric(                                  \
+      const gsl::not_null<tnsr::AA<DTYPE(data), DIM(data), FRAME(data)>*>      \
+          inverse_spacetime_metric,                                            \
+      const Scalar<DTYPE(data)>& lapse,                                        \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
+      const tnsr::II<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          inverse_spatial_metric) noexcept;                                    \
   template tnsr::I<DTYPE(data), DIM(data), FRAME(data)> gr::shift(             \
       const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>& spacetime_metric,   \
       const tnsr::II<DTYPE(data), DIM(data), FRAME(data)>&                     \
           inverse_spatial_metric) noexcept;                                    \
+  template void gr::shift(                                                     \
+      const gsl::not_null<tnsr::I<DTYPE(data), DIM(data), FRAME(data)>*>       \
+          shift,                                                               \
+      const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>& spacetime_metric,   \
+      const tnsr::II<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          inverse_spatial_metric) noexcept;                                    \
   template Scalar<DTYPE(data)> gr::lapse(                                      \
       const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
       const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>&                     \
           spacetime_metric) noexcept;                                          \
+  template void gr::lapse(                                                     \
+      const gsl::not_null<Scalar<DTYPE(data)>*> lapse,                         \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
+      const tnsr::aa<DTYPE(data), DIM(data), FRAME(data)>&                     \
+          spacetime_metric) noexcept;                                          \
   template tnsr::abb<DTYPE(data), DIM(data), FRAME(data)>                      \
   gr::derivatives_of_spacetime_metric(                                         \
-      const Scalar<DTYPE(data)>& lapse, const Scalar<DTYPE(data)>& dt_lapse,   \
+      const Scalar<DTYPE(data)>& lapse,                                        \
+      const Scalar<DTYPE(data)>& dt_lapse,                                     \
+      const tnsr::i<DTYPE(data), DIM(data), FRAME(data)>& deriv_lapse,         \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& dt_shift,            \
+      const tnsr::iJ<DTYPE(data), DIM(data), FRAME(data)>& deriv_shift,        \
+      const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>& spatial_metric,     \
+      const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>& dt_spatial_metric,  \
+      const tnsr::ijj<DTYPE(data), DIM(data), FRAME(data)>&                    \
+          deriv_spatial_metric) noexcept;                                      \
+  template void gr::derivatives_of_spacetime_metric(                           \
+      const gsl::not_null<tnsr::abb<DTYPE(data), DIM(data), FRAME(data)>*>     \
+          spacetime_deriv_spacetime_metric,                                    \
+      const Scalar<DTYPE(data)>& lapse,                                        \
+      const Scalar<DTYPE(data)>& dt_lapse,                                     \
       const tnsr::i<DTYPE(data), DIM(data), FRAME(data)>& deriv_lapse,         \
       const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
       const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& dt_shift,            \
@@ -265,11 +417,21 @@ tnsr::ii<DataType, SpatialDim, Frame> extrinsic_curvature(
       const tnsr::ijj<DTYPE(data), DIM(data), FRAME(data)>&                    \
           deriv_spatial_metric) noexcept;                                      \
   template tnsr::a<DTYPE(data), DIM(data), FRAME(data)>                        \
-  gr::spacetime_normal_one_form(const Scalar<DTYPE(data)>& lapse) noexcept;    \
+  gr::spacetime_normal_one_form(                                               \
+      const Scalar<DTYPE(data)>& lapse) noexcept;                              \
+  template void gr::spacetime_normal_one_form(                                 \
+      const gsl::not_null<tnsr::a<DTYPE(data), DIM(data), FRAME(data)>*>       \
+          normal_one_form,                                                     \
+      const Scalar<DTYPE(data)>& lapse) noexcept;                              \
   template tnsr::A<DTYPE(data), DIM(data), FRAME(data)>                        \
   gr::spacetime_normal_vector(                                                 \
       const Scalar<DTYPE(data)>& lapse,                                        \
       const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift) noexcept;     \
+  template void gr::spacetime_normal_vector(                                   \
+      const gsl::not_null<tnsr::A<DTYPE(data), DIM(data), FRAME(data)>*>       \
+          spacetime_normal_vector,                                             \
+      const Scalar<DTYPE(data)>& lapse,                                        \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift) noexcept;     \
   template tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>                       \
   gr::extrinsic_curvature(                                                     \
       const Scalar<DTYPE(data)>& lapse,                                        \
@@ -277,6 +439,16 @@ tnsr::ii<DataType, SpatialDim, Frame> extrinsic_curvature(
       const tnsr::iJ<DTYPE(data), DIM(data), FRAME(data)>& deriv_shift,        \
       const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>& spatial_metric,     \
       const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>& dt_spatial_metric,  \
+      const tnsr::ijj<DTYPE(data), DIM(data), FRAME(data)>&                    \
+          deriv_spatial_metric) noexcept;                                      \
+  template void gr::extrinsic_curvature(                                       \
+      const gsl::not_null<tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>*>      \
+          ex_curvature,                                                        \
+      const Scalar<DTYPE(data)>& lapse,                                        \
+      const tnsr::I<DTYPE(data), DIM(data), FRAME(data)>& shift,               \
+      const tnsr::iJ<DTYPE(data), DIM(data), FRAME(data)>& deriv_shift,        \
+      const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>& spatial_metric,     \
+      const tnsr::ii<DTYPE(data), DIM(data), FRAME(data)>& dt_spatial_metric,  \
       const tnsr::ijj<DTYPE(data), DIM(data), FRAME(data)>&                    \
           deriv_spatial_metric) noexcept;
 
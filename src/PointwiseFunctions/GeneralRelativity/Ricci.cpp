@@ -4,34 +4,47 @@
 #include "PointwiseFunctions/GeneralRelativity/Ricci.hpp"
 
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
-#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace gr {
 template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
-tnsr::aa<DataType, SpatialDim, Frame, Index> ricci_tensor(
+void ricci_tensor(
+    const gsl::not_null<tnsr::aa<DataType, SpatialDim, Frame, Index>*> ricci,
     const tnsr::Abb<DataType, SpatialDim, Frame, Index>& christoffel_2nd_kind,
     const tnsr::aBcc<DataType, SpatialDim, Frame, Index>&
         d_christoffel_2nd_kind) noexcept {
-  auto ricci = make_with_value<tnsr::aa<DataType, SpatialDim, Frame, Index>>(
-      christoffel_2nd_kind, 0.);
-  constexpr auto dimensionality = index_dim<0>(ricci);
+  destructive_resize_components(ricci,
+                                get_size(get<0, 0, 0>(christoffel_2nd_kind)));
+  constexpr auto dimensionality = index_dim<0>(christoffel_2nd_kind);
   for (size_t i = 0; i < dimensionality; ++i) {
     for (size_t j = i; j < dimensionality; ++j) {
+      ricci->get(i, j) = 0.0;
       for (size_t m = 0; m < dimensionality; ++m) {
-        ricci.get(i, j) += d_christoffel_2nd_kind.get(m, m, i, j) -
-                           0.5 * (d_christoffel_2nd_kind.get(i, m, m, j) +
-                                  d_christoffel_2nd_kind.get(j, m, m, i));
+        ricci->get(i, j) += d_christoffel_2nd_kind.get(m, m, i, j) -
+                            0.5 * (d_christoffel_2nd_kind.get(i, m, m, j) +
+                                   d_christoffel_2nd_kind.get(j, m, m, i));
 
         for (size_t n = 0; n < dimensionality; ++n) {
-          ricci.get(i, j) += christoffel_2nd_kind.get(m, i, j) *
-                                 christoffel_2nd_kind.get(n, n, m) -
-                             christoffel_2nd_kind.get(m, i, n) *
-                                 christoffel_2nd_kind.get(n, m, j);
+          ricci->get(i, j) += christoffel_2nd_kind.get(m, i, j) *
+                                  christoffel_2nd_kind.get(n, n, m) -
+                              christoffel_2nd_kind.get(m, i, n) *
+                                  christoffel_2nd_kind.get(n, m, j);
         }
       }
     }
   }
+}
+
+template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
+tnsr::aa<DataType, SpatialDim, Frame, Index> ricci_tensor(
+    const tnsr::Abb<DataType, SpatialDim, Frame, Index>& christoffel_2nd_kind,
+    const tnsr::aBcc<DataType, SpatialDim, Frame, Index>&
+        d_christoffel_2nd_kind) noexcept {
+  tnsr::aa<DataType, SpatialDim, Frame, Index> ricci{};
+  ricci_tensor(make_not_null(&ricci), christoffel_2nd_kind,
+               d_christoffel_2nd_kind);
   return ricci;
 }
 } // namespace gr
@@ -43,12 +56,20 @@ tnsr::aa<DataType, SpatialDim, Frame, Index> ricci_tensor(
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(2, data)
 #define INDEXTYPE(data) BOOST_PP_TUPLE_ELEM(3, data)
 
-#define INSTANTIATE(_, data)                                                  \
-  template tnsr::aa<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>     \
-  gr::ricci_tensor(                                                           \
-      const tnsr::Abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&  \
-          christoffel_2nd_kind,                                               \
-      const tnsr::aBcc<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>& \
+#define INSTANTIATE(_, data)                                                   \
+  template void gr::ricci_tensor(                                              \
+      const gsl::not_null<                                                     \
+          tnsr::aa<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>*>     \
+          ricci,                                                               \
+      const tnsr::Abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&   \
+          christoffel_2nd_kind,                                                \
+      const tnsr::aBcc<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&  \
+          d_christoffel_2nd_kind) noexcept;                                    \
+  template tnsr::aa<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>      \
+  gr::ricci_tensor(                                                            \
+      const tnsr::Abb<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&   \
+          christoffel_2nd_kind,                                                \
+      const tnsr::aBcc<DTYPE(data), DIM(data), FRAME(data), INDEXTYPE(data)>&  \
           d_christoffel_2nd_kind) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
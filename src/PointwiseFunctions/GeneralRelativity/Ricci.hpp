@@ -10,8 +10,15 @@
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 
-namespace gr {
+/// \cond
+namespace gsl {
+template <class T>
+class not_null;
+}  // namespace gsl
+/// \endcond
 
+namespace gr {
+// @{
 /*!
  * \ingroup GeneralRelativityGroup
  * \brief Computes Ricci tensor from the (spatial or spacetime)
@@ -24,9 +31,16 @@ namespace gr {
  * where \f$\Gamma^{a}_{bc}\f$ is the Christoffel symbol of the second kind.
  */
 template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
-tnsr::aa<DataType, SpatialDim, Frame, Index> ricci_tensor(
+void ricci_tensor(
+    gsl::not_null<tnsr::aa<DataType, SpatialDim, Frame, Index>*> ricci,
     const tnsr::Abb<DataType, SpatialDim, Frame, Index>& christoffel_2nd_kind,
     const tnsr::aBcc<DataType, SpatialDim, Frame, Index>&
         d_christoffel_2nd_kind) noexcept;
 
+template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
+tnsr::aa<DataType, SpatialDim, Frame, Index> ricci_tensor(
+    const tnsr::Abb<DataType, SpatialDim, Frame, Index>& christoffel_2nd_kind,
+    const tnsr::aBcc<DataType, SpatialDim, Frame, Index>&
+        d_christoffel_2nd_kind) noexcept;
+// @}
 } // namespace gr
@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/ScratchArena.hpp"
+
+#include <algorithm>
+#include <utility>
+
+ScratchArena::Checkpoint::Checkpoint(
+    const gsl::not_null<ScratchArena*> arena) noexcept
+    : arena_(arena.get()),
+      block_(arena->current_block_),
+      offset_(arena->current_offset_) {}
+
+ScratchArena::Checkpoint::Checkpoint(Checkpoint&& rhs) noexcept
+    : arena_(rhs.arena_), block_(rhs.block_), offset_(rhs.offset_) {
+  rhs.arena_ = nullptr;
+}
+
+ScratchArena::Checkpoint::~Checkpoint() noexcept {
+  if (arena_ != nullptr) {
+    arena_->current_block_ = block_;
+    arena_->current_offset_ = offset_;
+  }
+}
+
+ScratchArena& ScratchArena::thread_local_instance() noexcept {
+  thread_local ScratchArena arena{};
+  return arena;
+}
+
+double* ScratchArena::allocate(const size_t number_of_doubles) noexcept {
+  // An empty allocation must not make the arena grab a new block.
+  if (number_of_doubles == 0) {
+    return nullptr;
+  }
+  // Blocks beyond the current one are left over from before the last
+  // rewind, so reuse any that are large enough before growing.
+  while (current_block_ < blocks_.size()) {
+    Block& block = blocks_[current_block_];
+    if (block.size - current_offset_ >= number_of_doubles) {
+      // clang-tidy: pointer arithmetic
+      double* const result = block.data.get() + current_offset_;  // NOLINT
+      current_offset_ += number_of_doubles;
+      return result;
+    }
+    ++current_block_;
+    current_offset_ = 0;
+  }
+
+  // Grow geometrically so the number of heap allocations needed to
+  // reach the steady state is logarithmic in its size.
+  Block block{};
+  block.size =
+      std::max({number_of_doubles, capacity_, minimum_block_size});
+  // clang-tidy: cppcoreguidelines-no-malloc
+  block.data.reset(
+      static_cast<double*>(malloc(block.size * sizeof(double))));  // NOLINT
+  capacity_ += block.size;
+  ++number_of_heap_allocations_;
+  blocks_.push_back(std::move(block));
+  current_block_ = blocks_.size() - 1;
+  current_offset_ = number_of_doubles;
+  return blocks_.back().data.get();
+}
@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class ScratchArena.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief A stack-like bump allocator for short-lived scratch memory.
+ *
+ * Memory is handed out from large blocks that are kept for the life of the
+ * arena, so once the arena has grown to cover the largest simultaneous demand
+ * of a calculation, repeating that calculation does not touch the heap.
+ * Allocations are released by rewinding the arena to a `Checkpoint`, which
+ * must be done in the reverse order the checkpoints were taken.  The usual
+ * pattern is
+ *
+ * \snippet Test_ScratchArena.cpp scratch_arena_example
+ *
+ * Hot kernels such as `apply_matrices` and the logical partial derivatives
+ * use the per-thread arena returned by `ScratchArena::thread_local_instance()`
+ * for their temporaries.  `number_of_heap_allocations()` counts the blocks
+ * the arena has requested from the heap and can be used to check that a code
+ * path does not allocate in the steady state.
+ *
+ * \warning The memory returned by `allocate` is not initialized.
+ */
+class ScratchArena {
+ public:
+  /// Records the current top of an arena, and rewinds the arena to it when
+  /// destroyed, releasing everything allocated since it was created.
+  class Checkpoint {
+   public:
+    explicit Checkpoint(gsl::not_null<ScratchArena*> arena) noexcept;
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+    Checkpoint(Checkpoint&& rhs) noexcept;
+    Checkpoint& operator=(Checkpoint&&) = delete;
+    ~Checkpoint() noexcept;
+
+   private:
+    ScratchArena* arena_;
+    size_t block_;
+    size_t offset_;
+  };
+
+  ScratchArena() = default;
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+  ScratchArena(ScratchArena&&) noexcept = default;
+  ScratchArena& operator=(ScratchArena&&) noexcept = default;
+  ~ScratchArena() = default;
+
+  /// The arena used by the calling thread.
+  static ScratchArena& thread_local_instance() noexcept;
+
+  /// Returns a pointer to `number_of_doubles` uninitialized `double`s that
+  /// remain valid until the arena is rewound past this call, or `nullptr` if
+  /// `number_of_doubles` is zero.
+  double* allocate(size_t number_of_doubles) noexcept;
+
+  /// The number of times the arena has requested memory from the heap.
+  size_t number_of_heap_allocations() const noexcept {
+    return number_of_heap_allocations_;
+  }
+
+  /// The total number of `double`s held by the arena.
+  size_t capacity() const noexcept { return capacity_; }
+
+ private:
+  struct Block {
+    std::unique_ptr<double[], decltype(&free)> data{nullptr, &free};
+    size_t size = 0;
+  };
+
+  // The first block is at least this many doubles (32 KiB).
+  static constexpr size_t minimum_block_size = 4096;
+
+  std::vector<Block> blocks_{};
+  size_t current_block_ = 0;
+  size_t current_offset_ = 0;
+  size_t capacity_ = 0;
+  size_t number_of_heap_allocations_ = 0;
+};
@@ -18,6 +18,7 @@
 #include "ErrorHandling/Error.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/SimpleActionVisitation.hpp"
@@ -191,6 +192,17 @@ class MockDistributedObject {
     array_index_ = std::move(index);
   }
 
+  const typename Component::array_index& get_index() const noexcept {
+    return array_index_;
+  }
+
+  /// The processor the object is on. Objects on a processor other than
+  /// `Parallel::my_proc()` have no local pointer, so actions that check for
+  /// one can be tested on remote objects.
+  void set_processor(const int processor) noexcept { processor_ = processor; }
+
+  int processor() const noexcept { return processor_; }
+
   void set_cache(Parallel::ConstGlobalCache<typename Component::metavariables>*
                      cache_ptr) noexcept {
     const_global_cache_ = cache_ptr;
@@ -377,6 +389,7 @@ class MockDistributedObject {
   }
 
   bool terminate_{false};
+  int processor_{0};
   make_boost_variant_over<
       tmpl::push_front<databox_types, db::DataBox<tmpl::list<>>>>
       box_ = db::DataBox<tmpl::list<>>{};
@@ -603,7 +616,15 @@ class MockArrayElementProxy {
   // no effect.
   void perform_algorithm() noexcept {}
 
-  MockDistributedObject<Component>* ckLocal() { return &local_algorithm_; }
+  MockDistributedObject<Component>* ckLocal() {
+    return local_algorithm_.processor() == Parallel::my_proc()
+               ? &local_algorithm_
+               : nullptr;
+  }
+
+  const typename Component::array_index& ckGetIndex() const noexcept {
+    return local_algorithm_.get_index();
+  }
 
  private:
   MockDistributedObject<Component>& local_algorithm_;
@@ -641,14 +662,31 @@ class MockProxy {
         local_algorithms_->at(index), inboxes_->operator[](index));
   }
 
+  // The local branch of a group is the one object on `Parallel::my_proc()`.
   MockDistributedObject<Component>* ckLocalBranch() noexcept {
-    ASSERT(
-        local_algorithms_->size() == 1,
-        "Can only have one algorithm when getting the ckLocalBranch, but have "
-            << local_algorithms_->size());
-    // We always retrieve the 0th local branch because we are assuming running
-    // on a single core.
-    return std::addressof(local_algorithms_->at(0));
+    MockDistributedObject<Component>* local_branch = nullptr;
+    for (auto& index_and_local_algorithm : *local_algorithms_) {
+      if (index_and_local_algorithm.second.processor() ==
+          Parallel::my_proc()) {
+        ASSERT(local_branch == nullptr,
+               "Can only have one algorithm on processor "
+                   << Parallel::my_proc()
+                   << " when getting the ckLocalBranch.");
+        local_branch = std::addressof(index_and_local_algorithm.second);
+      }
+    }
+    ASSERT(local_branch != nullptr,
+           "No algorithm on processor " << Parallel::my_proc()
+                                        << " to get the ckLocalBranch of.");
+    return local_branch;
+  }
+
+  // The proxy also acts as the location manager of the array, which knows
+  // the processors of the objects.
+  MockProxy* ckLocMgr() noexcept { return this; }
+
+  int lastKnown(const Index& index) const noexcept {
+    return local_algorithms_->at(index).processor();
   }
 
   template <typename Action, typename... Args>
@@ -816,6 +854,30 @@ class MockRuntimeSystem {
   }
   // @}
 
+  // @{
+  /// Invoke the threaded action `Action` on the `Component` labeled by
+  /// `array_index` immediately.
+  template <typename Component, typename Action, typename Arg0,
+            typename... Args>
+  void threaded_action(const typename Component::array_index& array_index,
+                       Arg0&& arg0, Args&&... args) noexcept {
+    algorithms<Component>()
+        .at(array_index)
+        .template threaded_action<Action>(
+            std::make_tuple(std::forward<Arg0>(arg0),
+                            std::forward<Args>(args)...),
+            true);
+  }
+
+  template <typename Component, typename Action>
+  void threaded_action(
+      const typename Component::array_index& array_index) noexcept {
+    algorithms<Component>()
+        .at(array_index)
+        .template threaded_action<Action>(true);
+  }
+  // @}
+
   /// Return true if there are no queued simple actions on the
   /// `Component` labeled by `array_index`.
   template <typename Component>
@@ -13,6 +13,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -133,6 +134,28 @@ void test_magnitude() {
   }
 }
 
+void test_magnitude_not_null() {
+  const size_t npts = 5;
+  const tnsr::I<DataVector, 2, Frame::Grid> vector{
+      {{DataVector{npts, -5.0}, DataVector{npts, 12.0}}}};
+  tnsr::ii<DataVector, 2, Frame::Grid> metric(npts, 0.0);
+  get<0, 0>(metric) = 2.0;
+  get<0, 1>(metric) = 1.0;
+  get<1, 1>(metric) = 3.0;
+
+  // An empty result is resized
+  Scalar<DataVector> result{};
+  magnitude(make_not_null(&result), vector);
+  CHECK_ITERABLE_APPROX(get(result), (DataVector{npts, 13.0}));
+
+  // A result of the right size is overwritten in place
+  const double* const data = get(result).data();
+  magnitude(make_not_null(&result), vector, metric);
+  CHECK(get(result).data() == data);
+  CHECK_ITERABLE_APPROX(get(result), (DataVector{npts, sqrt(362.0)}));
+  CHECK(result == magnitude(vector, metric));
+}
+
 struct Vector : db::SimpleTag {
   static std::string name() noexcept { return "Vector"; }
   using type = tnsr::I<DataVector, 3, Frame::Grid>;
@@ -171,6 +194,30 @@ void test_magnitude_tags() {
         db::item_type<Covector<2>>(
             {{{3. / 5., 5. / 13.}, {4. / 5., 12. / 13.}}}));
 
+  // The compute items reuse their storage when the box is mutated
+  auto mutable_box =
+      db::create<db::AddSimpleTags<Covector<2>>,
+                 db::AddComputeTags<Tags::EuclideanMagnitude<Covector<2>>,
+                                    Tags::Normalized<Covector<2>>>>(
+          db::item_type<Covector<2>>({{{3., 5.}, {4., 12.}}}));
+  const double* const magnitude_data =
+      get(db::get<Tags::EuclideanMagnitude<Covector<2>>>(mutable_box)).data();
+  const double* const normalized_data =
+      get<0>(db::get<Tags::Normalized<Covector<2>>>(mutable_box)).data();
+  db::mutate<Covector<2>>(
+      make_not_null(&mutable_box),
+      [](const gsl::not_null<db::item_type<Covector<2>>*> covector) noexcept {
+        get<1>(*covector) = DataVector{0., 0.};
+      });
+  CHECK(db::get<Tags::EuclideanMagnitude<Covector<2>>>(mutable_box) ==
+        Scalar<DataVector>({{{3., 5.}}}));
+  CHECK(db::get<Tags::Normalized<Covector<2>>>(mutable_box) ==
+        db::item_type<Covector<2>>({{{1., 1.}, {0., 0.}}}));
+  CHECK(get(db::get<Tags::EuclideanMagnitude<Covector<2>>>(mutable_box))
+            .data() == magnitude_data);
+  CHECK(get<0>(db::get<Tags::Normalized<Covector<2>>>(mutable_box)).data() ==
+        normalized_data);
+
   using Tag = Vector;
   /// [magnitude_name]
   CHECK(Tags::Magnitude<Tag>::name() == "Magnitude(" + Tag::name() + ")");
@@ -246,6 +293,7 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.EagerMath.Magnitude",
                   "[DataStructures][Unit]") {
   test_euclidean_magnitude();
   test_magnitude();
+  test_magnitude_not_null();
   test_magnitude_tags();
   test_general_magnitude_tags();
 }
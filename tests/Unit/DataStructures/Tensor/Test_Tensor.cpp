@@ -17,6 +17,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/StdHelpers.hpp"
@@ -1351,6 +1352,29 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.GetVectorOfData",
         scalar.get_vector_of_data());
 }
 
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.DestructiveResizeComponents",
+                  "[Unit][DataStructures]") {
+  tnsr::I<DataVector, 2, Frame::Grid> tensor{};
+  destructive_resize_components(make_not_null(&tensor), 3);
+  for (const auto& component : tensor) {
+    CHECK(component.size() == 3);
+  }
+  get<0>(tensor) = DataVector{1., 2., 3.};
+  const double* const data = get<0>(tensor).data();
+  // The memory is kept if the size is unchanged
+  destructive_resize_components(make_not_null(&tensor), 3);
+  CHECK(get<0>(tensor).data() == data);
+  CHECK(get<0>(tensor) == DataVector{1., 2., 3.});
+  destructive_resize_components(make_not_null(&tensor), 5);
+  for (const auto& component : tensor) {
+    CHECK(component.size() == 5);
+  }
+
+  Scalar<double> scalar{0.8};
+  destructive_resize_components(make_not_null(&scalar), 5);
+  CHECK(get(scalar) == 0.8);
+}
+
 /// [example_spectre_test_case]
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Frames",
                   "[Unit][DataStructures]") {
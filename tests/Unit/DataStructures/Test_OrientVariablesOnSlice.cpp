@@ -26,6 +26,7 @@
 #include "Domain/Mesh.hpp"
 #include "Domain/SegmentId.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeVector.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -68,6 +69,12 @@ void check_orient_variables_on_slice(
   const auto oriented_coords_on_neighbor_slice =
       orient_variables_on_slice(coords_on_my_slice, mesh_on_my_slice.extents(),
                                 my_sliced_dim, orientation);
+  // The overload writing into a buffer resizes it if necessary
+  Variables<tmpl::list<PhysicalCoords<SpatialDim>>> buffer{};
+  orient_variables_on_slice(make_not_null(&buffer), coords_on_my_slice,
+                            mesh_on_my_slice.extents(), my_sliced_dim,
+                            orientation);
+  CHECK(buffer == oriented_coords_on_neighbor_slice);
 
   const auto mesh_on_neighbor_slice =
       neighbor_mesh.slice_away(orientation(my_sliced_dim));
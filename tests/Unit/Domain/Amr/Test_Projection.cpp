@@ -0,0 +1,85 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Projection.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Mesh.hpp"
+#include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <size_t Dim>
+Mesh<Dim> make_mesh(const std::array<size_t, Dim>& extents) noexcept {
+  return {extents, Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+void test_new_mesh() noexcept {
+  CHECK(amr::new_mesh(make_mesh<1>({{4}}), {{amr::Flag::DoNothing}}) ==
+        make_mesh<1>({{4}}));
+  CHECK(amr::new_mesh(make_mesh<3>({{4, 5, 6}}),
+                      {{amr::Flag::IncreaseResolution,
+                        amr::Flag::DecreaseResolution,
+                        amr::Flag::DoNothing}}) == make_mesh<3>({{5, 4, 6}}));
+  // h-refinement does not change the mesh
+  CHECK(amr::new_mesh(make_mesh<2>({{4, 5}}),
+                      {{amr::Flag::Split, amr::Flag::Join}}) ==
+        make_mesh<2>({{4, 5}}));
+}
+
+void test_exact_projection() noexcept {
+  const auto polynomial = [](const tnsr::I<DataVector, 2, Frame::Logical>&
+                                 x) noexcept {
+    return DataVector{cube(get<0>(x)) + get<0>(x) * square(get<1>(x))};
+  };
+  const auto old_mesh = make_mesh<2>({{4, 5}});
+  for (const auto& new_mesh :
+       {make_mesh<2>({{5, 4}}), make_mesh<2>({{6, 3}}), old_mesh}) {
+    const auto matrices = amr::p_projection_matrices(old_mesh, new_mesh);
+    // Dimensions that are not refined have empty matrices
+    for (size_t d = 0; d < 2; ++d) {
+      CHECK(gsl::at(matrices, d).rows() ==
+            (new_mesh.extents(d) == old_mesh.extents(d) ? 0
+                                                        : new_mesh.extents(d)));
+    }
+    CHECK_ITERABLE_APPROX(
+        apply_matrices(matrices, polynomial(logical_coordinates(old_mesh)),
+                       old_mesh.extents()),
+        polynomial(logical_coordinates(new_mesh)));
+  }
+}
+
+void test_truncation() noexcept {
+  // x^4 = 8/35 P_4(x) + 4/7 P_2(x) + 1/5 P_0(x), so removing the highest mode
+  // leaves 6/7 x^2 - 3/35
+  const auto old_mesh = make_mesh<1>({{5}});
+  const auto new_mesh = make_mesh<1>({{4}});
+  const auto matrices = amr::p_projection_matrices(old_mesh, new_mesh);
+  CHECK(matrices[0].rows() == 4);
+  CHECK(matrices[0].columns() == 5);
+  const DataVector x_old = get<0>(logical_coordinates(old_mesh));
+  const DataVector x_new = get<0>(logical_coordinates(new_mesh));
+  CHECK_ITERABLE_APPROX(
+      apply_matrices(matrices, DataVector{square(square(x_old))},
+                     old_mesh.extents()),
+      DataVector{6.0 / 7.0 * square(x_new) - 3.0 / 35.0});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.Amr.Projection", "[Domain][Unit]") {
+  test_new_mesh();
+  test_exact_projection();
+  test_truncation();
+}
@@ -0,0 +1,139 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Tags.hpp"
+#include "Domain/Amr/TruncationError.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/TMPL.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+struct ScalarTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+  static std::string name() noexcept { return "Scalar"; }
+};
+
+struct VectorTag : db::SimpleTag {
+  using type = tnsr::I<DataVector, 2>;
+  static std::string name() noexcept { return "Vector"; }
+};
+
+template <size_t Dim>
+Mesh<Dim> make_mesh(const std::array<size_t, Dim>& extents) noexcept {
+  return {extents, Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+void test_relative_truncation_error() noexcept {
+  const auto mesh = make_mesh<1>({{5}});
+  const DataVector x = get<0>(logical_coordinates(mesh));
+  // x^4 = 8/35 P_4(x) + 4/7 P_2(x) + 1/5 P_0(x)
+  CHECK_ITERABLE_APPROX(
+      amr::relative_truncation_error(DataVector{square(square(x))}, mesh),
+      (std::array<double, 1>{{0.4}}));
+  CHECK_ITERABLE_APPROX(
+      amr::relative_truncation_error(DataVector{3.0 * square(x) + 1.0}, mesh),
+      (std::array<double, 1>{{0.0}}));
+  CHECK(amr::relative_truncation_error(DataVector(5, 0.0), mesh) ==
+        (std::array<double, 1>{{0.0}}));
+  // Only the highest mode is used with two points
+  const auto linear_mesh = make_mesh<1>({{2}});
+  CHECK_ITERABLE_APPROX(
+      amr::relative_truncation_error(
+          DataVector{get<0>(logical_coordinates(linear_mesh)) + 1.0},
+          linear_mesh),
+      (std::array<double, 1>{{1.0}}));
+}
+
+void test_criterion() noexcept {
+  const auto mesh = make_mesh<2>({{5, 4}});
+  const auto coords = logical_coordinates(mesh);
+  Variables<tmpl::list<ScalarTag, VectorTag>> vars(
+      mesh.number_of_grid_points(), 0.0);
+  // Only the y-component of the vector is under-resolved in x, and nothing is
+  // under-resolved in y
+  get<0>(get<VectorTag>(vars)) = 1.0 + get<0>(coords);
+  get<1>(get<VectorTag>(vars)) =
+      square(square(get<0>(coords))) * (1.0 + get<1>(coords));
+  CHECK_ITERABLE_APPROX(
+      amr::relative_truncation_error(get<1>(get<VectorTag>(vars)), mesh),
+      (std::array<double, 2>{{0.4, 0.0}}));
+
+  CHECK_ITERABLE_APPROX(amr::relative_truncation_error(vars, mesh),
+                        (std::array<double, 2>{{0.4, 0.0}}));
+  using truncation_error_tag = amr::Tags::RelativeTruncationError<
+      2, Tags::Variables<tmpl::list<ScalarTag, VectorTag>>>;
+  CHECK_ITERABLE_APPROX(truncation_error_tag::function(mesh, vars),
+                        (std::array<double, 2>{{0.4, 0.0}}));
+
+  const amr::TruncationErrorCriterion criterion(0.1, 1.0e-3, 3, 6);
+  CHECK(criterion(vars, mesh) ==
+        (std::array<amr::Flag, 2>{{amr::Flag::IncreaseResolution,
+                                   amr::Flag::DecreaseResolution}}));
+  CHECK(criterion.flags(std::array<double, 2>{{0.05, 1.0e-3}}, mesh) ==
+        (std::array<amr::Flag, 2>{
+            {amr::Flag::DoNothing, amr::Flag::DoNothing}}));
+  // The number of points is kept between the limits
+  const amr::TruncationErrorCriterion limited_criterion(0.1, 1.0e-3, 4, 5);
+  CHECK(limited_criterion(vars, mesh) ==
+        (std::array<amr::Flag, 2>{
+            {amr::Flag::DoNothing, amr::Flag::DoNothing}}));
+
+  CHECK(criterion != limited_criterion);
+  test_serialization(criterion);
+}
+
+void test_option_creation() noexcept {
+  CHECK(test_creation<amr::TruncationErrorCriterion>(
+            "  RefinementThreshold: 1.0e-2\n"
+            "  CoarseningThreshold: 1.0e-4\n"
+            "  MinimumNumberOfPoints: 4\n"
+            "  MaximumNumberOfPoints: 10") ==
+        amr::TruncationErrorCriterion(1.0e-2, 1.0e-4, 4, 10));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.Amr.TruncationError", "[Domain][Unit]") {
+  test_relative_truncation_error();
+  test_criterion();
+  test_option_creation();
+}
+
+// [[OutputRegex, CoarseningThreshold must be smaller than
+// RefinementThreshold]]
+SPECTRE_TEST_CASE("Unit.Domain.Amr.TruncationError.Thresholds",
+                  "[Domain][Unit]") {
+  ERROR_TEST();
+  test_creation<amr::TruncationErrorCriterion>(
+      "  RefinementThreshold: 1.0e-4\n"
+      "  CoarseningThreshold: 1.0e-2\n"
+      "  MinimumNumberOfPoints: 4\n"
+      "  MaximumNumberOfPoints: 10");
+}
+
+// [[OutputRegex, MinimumNumberOfPoints must not be larger than
+// MaximumNumberOfPoints]]
+SPECTRE_TEST_CASE("Unit.Domain.Amr.TruncationError.NumberOfPoints",
+                  "[Domain][Unit]") {
+  ERROR_TEST();
+  test_creation<amr::TruncationErrorCriterion>(
+      "  RefinementThreshold: 1.0e-2\n"
+      "  CoarseningThreshold: 1.0e-4\n"
+      "  MinimumNumberOfPoints: 10\n"
+      "  MaximumNumberOfPoints: 4");
+}
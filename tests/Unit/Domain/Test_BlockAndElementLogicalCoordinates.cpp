@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <iterator>
 #include <limits>
@@ -403,6 +404,35 @@ void test_block_and_element_logical_coordinates1() noexcept {
       expected_id_indices, expected_offset, expected_elem_log);
 }
 
+void test_element_logical_coordinates_mixed_refinement() noexcept {
+  // Elements with different refinement levels in the same block. Points on
+  // shared boundaries belong to the first element in the list.
+  const std::vector<ElementId<1>> element_ids{
+      {0, {{{1, 1}}}}, {0, {{{2, 0}}}}, {0, {{{2, 1}}}}, {1, {{{0, 0}}}}};
+  const std::vector<double> x_block_logical{-0.75, -0.5, 0.0, 0.5, -1.0, 0.0};
+  const std::vector<size_t> block_ids{0, 0, 0, 0, 0, 2};
+  std::vector<IdPair<domain::BlockId, tnsr::I<double, 1, Frame::Logical>>>
+      block_coord_holders{};
+  for (size_t s = 0; s < x_block_logical.size(); ++s) {
+    block_coord_holders.push_back(
+        {domain::BlockId(block_ids[s]),
+         tnsr::I<double, 1, Frame::Logical>{{{x_block_logical[s]}}}});
+  }
+  const auto result =
+      element_logical_coordinates(element_ids, block_coord_holders);
+  CHECK(result.size() == 2);
+  CHECK(result.at(element_ids[0]).offsets == std::vector<size_t>{2, 3});
+  CHECK_ITERABLE_APPROX(
+      get<0>(result.at(element_ids[0]).element_logical_coords),
+      (DataVector{-1.0, 0.0}));
+  CHECK(result.at(element_ids[1]).offsets == std::vector<size_t>{0, 1, 4});
+  CHECK_ITERABLE_APPROX(
+      get<0>(result.at(element_ids[1]).element_logical_coords),
+      (DataVector{0.0, 1.0, -1.0}));
+  CHECK(result.count(element_ids[2]) == 0);
+  CHECK(result.count(element_ids[3]) == 0);
+}
+
 template <typename TargetFrame>
 void test_block_logical_coordinates1fail() noexcept {
   Domain<1, TargetFrame> domain(
@@ -439,8 +469,8 @@ void test_block_and_element_logical_coordinates3() noexcept {
       {{0.1, 0.1, 0.7}},   {{0.1, 0.8, 0.7}},    {{0.7, 0.2, 0.7}},
       {{0.9, 0.9, 0.9}},   {{0.5, 0.75, 1.0}}};
   // The last point above lies on the boundary of a block and of an
-  // element.  block_logical_coordinates should pick the smallest
-  // block_id that it lies on.
+  // element.  The bounding boxes of both blocks contain it, so
+  // block_logical_coordinates picks the smaller block_id.
   std::vector<size_t> expected_block_ids{{0, 0, 0, 1, 2, 3, 4, 6, 5, 7, 6}};
   std::vector<std::array<double, 3>> expected_x_logical{
       {{-0.6, -0.6, -0.6}},  {{-0.8, -0.8, -0.8}},  {{-0.04, -0.04, -0.04}},
@@ -501,17 +531,80 @@ void test_block_and_element_logical_coordinates3() noexcept {
       domain, x_frame, expected_block_ids, expected_x_logical, element_ids,
       expected_id_indices, expected_offset, expected_elem_log);
 }
+
+// A point on a boundary shared by several blocks may be assigned to any
+// of them, and the maps of these blocks agree there only up to roundoff,
+// so only check that the returned block and logical coordinates map back
+// to the point.
+template <size_t Dim, typename TargetFrame>
+void test_block_logical_coordinates_on_shared_boundaries(
+    const Domain<Dim, TargetFrame>& domain,
+    const std::vector<std::array<double, Dim>>& x_frame) noexcept {
+  tnsr::I<DataVector, Dim, TargetFrame> frame_coords(x_frame.size());
+  for (size_t s = 0; s < x_frame.size(); ++s) {
+    for (size_t d = 0; d < Dim; ++d) {
+      frame_coords.get(d)[s] = gsl::at(x_frame[s], d);
+    }
+  }
+  const auto block_logical_result =
+      block_logical_coordinates(domain, frame_coords);
+  for (size_t s = 0; s < x_frame.size(); ++s) {
+    const auto& logical_coords = block_logical_result[s].data;
+    bool is_on_block_boundary = false;
+    for (size_t d = 0; d < Dim; ++d) {
+      is_on_block_boundary =
+          is_on_block_boundary or
+          std::abs(std::abs(logical_coords.get(d)) - 1.0) < 1.0e-12;
+    }
+    CHECK(is_on_block_boundary);
+    const auto mapped_coords =
+        domain.blocks()[block_logical_result[s].id.get_index()]
+            .coordinate_map()(logical_coords);
+    tnsr::I<double, Dim, TargetFrame> expected_coords{};
+    for (size_t d = 0; d < Dim; ++d) {
+      expected_coords.get(d) = gsl::at(x_frame[s], d);
+    }
+    CHECK_ITERABLE_APPROX(mapped_coords, expected_coords);
+  }
+}
+
+template <typename TargetFrame>
+void test_block_logical_coordinates_on_shared_boundaries() noexcept {
+  test_block_logical_coordinates_on_shared_boundaries(
+      Domain<3, TargetFrame>(
+          maps_for_rectilinear_domains<TargetFrame>(
+              Index<3>{2, 2, 2},
+              std::array<std::vector<double>, 3>{
+                  {{0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}}},
+              {Index<3>{}}),
+          corners_for_rectilinear_domains(Index<3>{2, 2, 2})),
+      std::vector<std::array<double, 3>>{{{0.5, 0.5, 0.5}},
+                                         {{0.5, 0.2, 0.9}},
+                                         {{0.1, 0.5, 0.5}},
+                                         {{1.0, 0.5, 0.3}}});
+
+  test_block_logical_coordinates_on_shared_boundaries(
+      Domain<1, TargetFrame>(
+          maps_for_rectilinear_domains<TargetFrame>(
+              Index<1>{2},
+              std::array<std::vector<double>, 1>{{{0.0, 0.5, 1.0}}},
+              {Index<1>{}}),
+          corners_for_rectilinear_domains(Index<1>{2})),
+      std::vector<std::array<double, 1>>{{{0.5}}});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
                   "[Domain][Unit]") {
   test_block_and_element_logical_coordinates1<Frame::Grid>();
   test_block_and_element_logical_coordinates3<Frame::Grid>();
+  test_element_logical_coordinates_mixed_refinement();
   fuzzy_test_block_and_element_logical_coordinates3<Frame::Grid>(20);
   fuzzy_test_block_and_element_logical_coordinates2<Frame::Grid>(20);
   fuzzy_test_block_and_element_logical_coordinates1<Frame::Grid>(20);
   fuzzy_test_block_and_element_logical_coordinates1<Frame::Grid>(0);
   fuzzy_test_block_and_element_logical_coordinates_shell<Frame::Grid>(20);
+  test_block_logical_coordinates_on_shared_boundaries<Frame::Grid>();
 }
 
 // [[OutputRegex, Found points that are not in any block.:
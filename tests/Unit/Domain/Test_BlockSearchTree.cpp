@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/BlockNeighbor.hpp"
+#include "Domain/BlockSearchTree.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/Direction.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainCreators/DomainCreator.hpp"  // IWYU pragma: keep
+#include "Domain/DomainCreators/Shell.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+template <size_t Dim>
+tnsr::I<double, Dim, Frame::Inertial> map_point(
+    const Block<Dim, Frame::Inertial>& block,
+    const std::array<double, Dim>& logical_point) noexcept {
+  tnsr::I<double, Dim, Frame::Logical> logical_coords{};
+  for (size_t d = 0; d < Dim; ++d) {
+    logical_coords.get(d) = gsl::at(logical_point, d);
+  }
+  return block.coordinate_map()(logical_coords);
+}
+
+void test_rectilinear_domain() noexcept {
+  PUPable_reg(SINGLE_ARG(
+      CoordinateMap<Frame::Logical, Frame::Inertial,
+                    CoordinateMaps::ProductOf2Maps<CoordinateMaps::Affine,
+                                                   CoordinateMaps::Affine>>));
+  const Domain<2, Frame::Inertial> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<2>{2, 3},
+          std::array<std::vector<double>, 2>{
+              {{0.0, 0.5, 1.0}, {0.0, 0.33, 0.66, 1.0}}}),
+      corners_for_rectilinear_domains(Index<2>{2, 3}));
+  const auto check_tree = [&domain](
+      const BlockSearchTree<2, Frame::Inertial>& tree) noexcept {
+    CHECK(tree.number_of_blocks() == 6);
+    std::vector<size_t> candidates{};
+    for (const auto& block : domain.blocks()) {
+      // Only the block itself can contain its center
+      tree.candidate_blocks(make_not_null(&candidates),
+                            map_point(block, {{0.0, 0.0}}));
+      CHECK(candidates == std::vector<size_t>{block.id()});
+      // Points on a shared boundary are in the boxes of both blocks
+      const auto& neighbors = block.neighbors();
+      for (const auto& direction_and_neighbor : neighbors) {
+        std::array<double, 2> logical_point{{0.0, 0.0}};
+        gsl::at(logical_point, direction_and_neighbor.first.dimension()) =
+            direction_and_neighbor.first.sign();
+        tree.candidate_blocks(make_not_null(&candidates),
+                              map_point(block, logical_point));
+        CHECK(candidates.size() == 2);
+        CHECK(alg::found(candidates, block.id()));
+        CHECK(alg::found(candidates, direction_and_neighbor.second.id()));
+        CHECK(std::is_sorted(candidates.begin(), candidates.end()));
+      }
+    }
+    tree.candidate_blocks(make_not_null(&candidates),
+                          tnsr::I<double, 2, Frame::Inertial>{{{2.0, 0.5}}});
+    CHECK(candidates.empty());
+  };
+  check_tree(domain.block_search_tree());
+  // The tree is rebuilt when the domain is deserialized
+  check_tree(serialize_and_deserialize(domain).block_search_tree());
+
+  std::vector<size_t> candidates{1, 2};
+  BlockSearchTree<2, Frame::Inertial>{}.candidate_blocks(
+      make_not_null(&candidates),
+      tnsr::I<double, 2, Frame::Inertial>{{{0.1, 0.1}}});
+  CHECK(candidates.empty());
+}
+
+void test_shell() noexcept {
+  // The faces of the wedges are curved, so check that the padded boxes
+  // contain random points in each block.
+  const auto shell =
+      DomainCreators::Shell<Frame::Inertial>(1.5, 2.5, 2, {{1, 1}}, true, 1.0);
+  const auto domain = shell.create_domain();
+  const auto& tree = domain.block_search_tree();
+  CHECK(tree.number_of_blocks() == domain.blocks().size());
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::mt19937 gen;
+  std::vector<size_t> candidates{};
+  for (const auto& block : domain.blocks()) {
+    for (size_t s = 0; s < 100; ++s) {
+      const auto x =
+          map_point(block, std::array<double, 3>{{dist(gen), dist(gen),
+                                                  dist(gen)}});
+      tree.candidate_blocks(make_not_null(&candidates), x);
+      CHECK(alg::found(candidates, block.id()));
+      // The boxes of the six wedges overlap, but not all of them contain
+      // any one point.
+      CHECK(candidates.size() < domain.blocks().size());
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockSearchTree", "[Domain][Unit]") {
+  test_rectilinear_domain();
+  test_shell();
+}
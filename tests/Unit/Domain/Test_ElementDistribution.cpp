@@ -0,0 +1,116 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/Index.hpp"
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/Domain.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/InitialElementIds.hpp"
+#include "Domain/SegmentId.hpp"
+#include "Options/Options.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+constexpr auto curve_placement = domain::ElementPlacement::SpaceFillingCurve;
+
+struct ElementPlacement {
+  using type = domain::ElementPlacement;
+  static constexpr OptionString help = {"Placement"};
+};
+
+void test_options_and_output() noexcept {
+  Options<tmpl::list<ElementPlacement>> opts("");
+  opts.parse("ElementPlacement: SpaceFillingCurve\n");
+  CHECK(opts.get<ElementPlacement>() ==
+        domain::ElementPlacement::SpaceFillingCurve);
+  CHECK(get_output(domain::ElementPlacement::RoundRobin) == "RoundRobin");
+  CHECK(get_output(domain::ElementPlacement::SpaceFillingCurve) ==
+        "SpaceFillingCurve");
+}
+
+void test_two_blocks_1d() noexcept {
+  const Domain<1, Frame::Inertial> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<1>{2}, std::array<std::vector<double>, 1>{{{0.0, 0.5, 1.0}}}),
+      corners_for_rectilinear_domains(Index<1>{2}));
+  const auto element_ids = initial_element_ids<1>({{{1}}, {{1}}});
+  const std::vector<size_t> weights(element_ids.size(), 4);
+
+  // Round robin starts again with each block
+  const auto round_robin = domain::element_placement(
+      element_ids, weights, 2, domain::ElementPlacement::RoundRobin);
+  CHECK(round_robin == std::vector<int>{0, 1, 0, 1});
+  CHECK(domain::number_of_cut_faces(domain.blocks(), element_ids,
+                                    round_robin) == 3);
+
+  // Only the face between the blocks is cut
+  const auto curve =
+      domain::element_placement(element_ids, weights, 2, curve_placement);
+  CHECK(curve == std::vector<int>{0, 0, 1, 1});
+  CHECK(domain::number_of_cut_faces(domain.blocks(), element_ids, curve) ==
+        1);
+
+  // Chunks are balanced by weight
+  CHECK(domain::element_placement(element_ids, {1, 1, 1, 3}, 2,
+                                  curve_placement) ==
+        std::vector<int>{0, 0, 0, 1});
+  // More processors than elements
+  CHECK(domain::element_placement(element_ids, weights, 8, curve_placement) ==
+        std::vector<int>{1, 3, 5, 7});
+}
+
+void test_single_block_2d() noexcept {
+  const Domain<2, Frame::Inertial> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<2>{1, 1},
+          std::array<std::vector<double>, 2>{{{0.0, 1.0}, {0.0, 1.0}}}),
+      corners_for_rectilinear_domains(Index<2>{1, 1}));
+  const auto element_ids = initial_element_ids<2>(0, {{2, 2}});
+  const std::vector<size_t> weights(element_ids.size(), 9);
+
+  // The elements are ordered with the y index varying fastest, so round robin
+  // places each row of elements on one processor.
+  const auto round_robin = domain::element_placement(
+      element_ids, weights, 4, domain::ElementPlacement::RoundRobin);
+  CHECK(domain::number_of_cut_faces(domain.blocks(), element_ids,
+                                    round_robin) == 12);
+
+  // The Morton curve places each quadrant of the block on one processor
+  const auto curve =
+      domain::element_placement(element_ids, weights, 4, curve_placement);
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    const auto& segment_ids = element_ids[i].segment_ids();
+    CHECK(curve[i] ==
+          static_cast<int>(segment_ids[0].index() / 2 +
+                           2 * (segment_ids[1].index() / 2)));
+  }
+  CHECK(domain::number_of_cut_faces(domain.blocks(), element_ids, curve) ==
+        8);
+
+  // Elements with different refinement levels are ordered consistently: the
+  // coarse element covers the lower half of the block in x, so it comes
+  // before the fine elements in the upper half.
+  const std::vector<ElementId<2>> mixed_ids{
+      {0, {{{2, 3}, {1, 0}}}}, {0, {{{1, 0}, {0, 0}}}}, {0, {{{2, 2}, {1, 1}}}},
+      {0, {{{2, 2}, {1, 0}}}}, {0, {{{2, 3}, {1, 1}}}}};
+  CHECK(domain::element_placement(mixed_ids, {1, 4, 1, 1, 1}, 2,
+                                  curve_placement) ==
+        std::vector<int>{1, 0, 1, 1, 1});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
+  test_options_and_output();
+  test_two_blocks_1d();
+  test_single_block_2d();
+}
@@ -60,6 +60,15 @@ void check(const Map& map,
           lower_normal.get(i),
           DataVector(num_grid_points, -gsl::at(gsl::at(expected, d), i)));
     }
+
+    // The overload taking a `gsl::not_null` overwrites the storage of the
+    // normal it is passed
+    auto normal = upper_normal;
+    const double* const data = normal.get(0).data();
+    unnormalized_face_normal(make_not_null(&normal), mesh, map,
+                             Direction<Map::dim>(d, Side::Lower));
+    CHECK(normal.get(0).data() == data);
+    CHECK_ITERABLE_APPROX(normal, lower_normal);
   }
 }
 }  // namespace
@@ -101,6 +101,21 @@ struct TemplatedDirections : db::SimpleTag {
   static std::string name() noexcept { return "TemplatedDirections"; }
   using type = std::unordered_set<Direction<3>>;
 };
+
+struct Values : db::SimpleTag {
+  static std::string name() noexcept { return "Values"; }
+  using type = DataVector;
+};
+
+struct NegateInPlace : db::ComputeTag {
+  static std::string name() noexcept { return "NegateInPlace"; }
+  using return_type = DataVector;
+  static void function(const gsl::not_null<DataVector*> result,
+                       const DataVector& values) noexcept {
+    *result = -values;
+  }
+  using argument_tags = tmpl::list<Values>;
+};
 }  // namespace TestTags
 }  // namespace
 
@@ -244,6 +259,44 @@ SPECTRE_TEST_CASE("Unit.Domain.InterfaceItems", "[Unit][Domain]") {
               {Direction<dim>::upper_xi(), -4.5}}));
 }
 
+SPECTRE_TEST_CASE("Unit.Domain.InterfaceItems.Mutating", "[Unit][Domain]") {
+  using directions = TestTags::TemplatedDirections<double>;
+  using values_tag = Tags::Interface<directions, TestTags::Values>;
+  using negated_tag = Tags::Interface<directions, TestTags::NegateInPlace>;
+  const auto lower_xi = Direction<3>::lower_xi();
+  const auto upper_eta = Direction<3>::upper_eta();
+
+  auto box = db::create<
+      db::AddSimpleTags<directions, values_tag>,
+      db::AddComputeTags<
+          Tags::InterfaceComputeItem<directions, TestTags::NegateInPlace>>>(
+      std::unordered_set<Direction<3>>{lower_xi, upper_eta},
+      std::unordered_map<Direction<3>, DataVector>{
+          {lower_xi, DataVector{1., 2.}}, {upper_eta, DataVector{3.}}});
+  CHECK(db::get<negated_tag>(box) ==
+        (std::unordered_map<Direction<3>, DataVector>{
+            {lower_xi, DataVector{-1., -2.}}, {upper_eta, DataVector{-3.}}}));
+  const double* const lower_xi_data =
+      db::get<negated_tag>(box).at(lower_xi).data();
+
+  // The interface compute item reuses the storage of the directions that
+  // remain and drops the others.
+  db::mutate<directions, values_tag>(
+      make_not_null(&box),
+      [&lower_xi, &upper_eta ](
+          const gsl::not_null<std::unordered_set<Direction<3>>*> dirs,
+          const gsl::not_null<std::unordered_map<Direction<3>, DataVector>*>
+              values) noexcept {
+        dirs->erase(upper_eta);
+        values->erase(upper_eta);
+        values->at(lower_xi) = DataVector{4., 5.};
+      });
+  CHECK(db::get<negated_tag>(box) ==
+        (std::unordered_map<Direction<3>, DataVector>{
+            {lower_xi, DataVector{-4., -5.}}}));
+  CHECK(db::get<negated_tag>(box).at(lower_xi).data() == lower_xi_data);
+}
+
 namespace {
 constexpr size_t dim = 2;
 
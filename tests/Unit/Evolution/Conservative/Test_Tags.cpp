@@ -119,18 +119,21 @@ void check() {
   // set up.
   using magnitude_normal_tag =
       Tags::EuclideanMagnitude<Tags::UnnormalizedFaceNormal<Dim, Frame>>;
-  const auto magnitude_normal = magnitude_normal_tag::function(normal);
+  Scalar<DataVector> magnitude_normal{};
+  magnitude_normal_tag::function(make_not_null(&magnitude_normal), normal);
   using normalized_normal_tag =
       Tags::Normalized<Tags::UnnormalizedFaceNormal<Dim, Frame>>;
-  const auto normalized_normal =
-      normalized_normal_tag::function(normal, magnitude_normal);
+  tnsr::i<DataVector, Dim, Frame> normalized_normal{};
+  normalized_normal_tag::function(make_not_null(&normalized_normal), normal,
+                                  magnitude_normal);
   using compute_n_dot_f =
       Tags::ComputeNormalDotFlux<variables_tag<Dim, Frame>, Dim, Frame>;
   static_assert(
       cpp17::is_same_v<typename compute_n_dot_f::argument_tags,
                        tmpl::list<flux_tag<Dim, Frame>, normalized_normal_tag>>,
       "Wrong argument tags");
-  const auto result = compute_n_dot_f::function(fluxes, normalized_normal);
+  typename compute_n_dot_f::return_type result{};
+  compute_n_dot_f::function(make_not_null(&result), fluxes, normalized_normal);
 
   static_assert(
       cpp17::is_base_of_v<
@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "Evolution/DiscontinuousGalerkin/Filtering/ExponentialFilter.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Filtering.ExponentialFilter",
+                  "[Unit][Evolution]") {
+  const Filters::Exponential filter(36.0, 8);
+  CHECK(filter == Filters::Exponential(36.0, 8));
+  CHECK(filter != Filters::Exponential(36.0, 4));
+  CHECK(filter != Filters::Exponential(10.0, 8));
+  CHECK(test_creation<Filters::Exponential>("  Alpha: 36.0\n"
+                                            "  HalfPower: 8") == filter);
+
+  const auto check_matrices = [](const Filters::Exponential& local_filter,
+                                 const double alpha,
+                                 const size_t half_power) noexcept {
+    for (const auto quadrature :
+         {Spectral::Quadrature::Gauss, Spectral::Quadrature::GaussLobatto}) {
+      const size_t min_num_points =
+          quadrature == Spectral::Quadrature::Gauss ? 1 : 2;
+      for (size_t num_points = min_num_points;
+           num_points <=
+           Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+           ++num_points) {
+        const Mesh<1> mesh(num_points, Spectral::Basis::Legendre, quadrature);
+        CHECK(local_filter.filter_matrix(mesh) ==
+              Spectral::exponential_filter_matrix(mesh, alpha, half_power));
+      }
+    }
+  };
+  check_matrices(filter, 36.0, 8);
+  // The cached matrices are recomputed after deserialization
+  check_matrices(serialize_and_deserialize(filter), 36.0, 8);
+}
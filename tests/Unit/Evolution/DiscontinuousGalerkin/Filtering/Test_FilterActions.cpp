@@ -0,0 +1,116 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/ElementIndex.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Mesh.hpp"
+#include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/Filtering/FilterActions.hpp"
+#include "Evolution/DiscontinuousGalerkin/Filtering/HeavisideFilter.hpp"
+#include "Evolution/DiscontinuousGalerkin/Filtering/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+
+namespace {
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = Scalar<DataVector>;
+};
+
+struct Vector : db::SimpleTag {
+  static std::string name() noexcept { return "Vector"; }
+  using type = tnsr::I<DataVector, 2, Frame::Logical>;
+};
+
+struct UnfilteredVar : db::SimpleTag {
+  static std::string name() noexcept { return "UnfilteredVar"; }
+  using type = Scalar<DataVector>;
+};
+
+struct System {
+  static constexpr const size_t volume_dim = 2;
+};
+
+using filter_tag = OptionTags::FilterParams<Filters::Heaviside>;
+
+template <typename Metavariables>
+struct component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementIndex<2>;
+  using const_global_cache_tag_list = tmpl::list<filter_tag>;
+  using action_list = tmpl::list<
+      Filters::Actions::Filter<filter_tag, tmpl::list<Var, Vector>>>;
+  using simple_tags =
+      db::AddSimpleTags<Tags::Mesh<2>, Var, Vector, UnfilteredVar>;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<component<Metavariables>>;
+  using const_global_cache_tag_list = tmpl::list<>;
+  using system = System;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Filtering.FilterActions",
+                  "[Unit][Evolution][Actions]") {
+  using my_component = component<Metavariables>;
+
+  const Mesh<2> mesh{{{5, 4}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto coords = logical_coordinates(mesh);
+  const DataVector& x = get<0>(coords);
+  const DataVector& y = get<1>(coords);
+
+  // Removing the highest two modes keeps the polynomials up to order two in
+  // the first and up to order one in the second dimension.
+  // x^4 = 8/35 P_4(x) + 4/7 P_2(x) + 1/5 P_0(x)
+  // y^2 = 2/3 P_2(y) + 1/3 P_0(y)
+  // y^3 = 2/5 P_3(y) + 3/5 P_1(y)
+  const Scalar<DataVector> var{DataVector{square(square(x)) + square(y)}};
+  const Scalar<DataVector> expected_var{
+      DataVector{6.0 / 7.0 * square(x) - 3.0 / 35.0 + 1.0 / 3.0}};
+  tnsr::I<DataVector, 2, Frame::Logical> vector{};
+  get<0>(vector) = x * y;
+  get<1>(vector) = cube(y);
+  tnsr::I<DataVector, 2, Frame::Logical> expected_vector{};
+  get<0>(expected_vector) = x * y;
+  get<1>(expected_vector) = 0.6 * y;
+
+  const ElementId<2> self_id(0);
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  using MockDistributedObjectsTag =
+      MockRuntimeSystem::MockDistributedObjectsTag<my_component>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(self_id, db::create<my_component::simple_tags>(mesh, var,
+                                                              vector, var));
+  MockRuntimeSystem runner{{Filters::Heaviside{2}}, std::move(dist_objects)};
+
+  runner.next_action<my_component>(self_id);
+
+  const auto& box = runner.algorithms<my_component>()
+                        .at(self_id)
+                        .get_databox<my_component::initial_databox>();
+  CHECK_ITERABLE_APPROX(db::get<Var>(box), expected_var);
+  CHECK_ITERABLE_APPROX(db::get<Vector>(box), expected_vector);
+  CHECK(db::get<UnfilteredVar>(box) == var);
+}
@@ -0,0 +1,31 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "Evolution/DiscontinuousGalerkin/Filtering/HeavisideFilter.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.Filtering.HeavisideFilter",
+                  "[Unit][Evolution]") {
+  const Filters::Heaviside filter(2);
+  CHECK(filter == Filters::Heaviside(2));
+  CHECK(filter != Filters::Heaviside(1));
+  CHECK(test_creation<Filters::Heaviside>("  NumberOfModesToRemove: 2") ==
+        filter);
+  test_serialization(filter);
+
+  const Mesh<1> mesh(5, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto);
+  CHECK(&filter.filter_matrix(mesh) ==
+        &Spectral::heaviside_filter_matrix(mesh, 3));
+  // The lowest mode is always kept
+  const Mesh<1> coarse_mesh(2, Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto);
+  CHECK(&filter.filter_matrix(coarse_mesh) ==
+        &Spectral::heaviside_filter_matrix(coarse_mesh, 1));
+}
@@ -9,6 +9,7 @@
 #include <memory>
 // IWYU pragma: no_include <pup.h>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -39,7 +40,10 @@
 #include "Domain/SegmentId.hpp"
 #include "Domain/Tags.hpp"
 #include "Evolution/DiscontinuousGalerkin/InitializeElement.hpp"
+#include "Evolution/EventsAndTriggers/PrintFluxCommunicationTiming.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "NumericalAlgorithms/LinearOperators/Divergence.tpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -53,6 +57,7 @@
 #include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
 #include "tests/Unit/ActionTesting.hpp"
+#include "tests/Unit/TestHelpers.hpp"
 
 // IWYU pragma: no_forward_declare ElementIndex
 class TimeStepper;
@@ -354,6 +359,24 @@ void test_initialize_element(
 
   TestConservativeOrNonconservativeParts<system::is_in_flux_conservative_form>::
       template apply<Metavariables>(make_not_null(&box));
+
+  // Array elements are serialized with their DataBox when they are migrated
+  // in the LoadBalancing phase
+  const auto migrated_box = serialize_and_deserialize(box);
+  CHECK(db::get<Var>(migrated_box) == db::get<Var>(box));
+  CHECK(db::get<Tags::Mesh<dim>>(migrated_box) == mesh);
+  CHECK(db::get<Tags::Element<dim>>(migrated_box) == element);
+  CHECK(db::get<Tags::Next<Tags::TimeId>>(migrated_box) ==
+        db::get<Tags::Next<Tags::TimeId>>(box));
+  CHECK(db::get<Tags::TimeStep>(migrated_box) == db::get<Tags::TimeStep>(box));
+  CHECK((db::get<Tags::MappedCoordinates<Tags::ElementMap<dim>,
+                                         Tags::LogicalCoordinates<dim>>>(
+            migrated_box)) == inertial_coords);
+  CHECK(db::get<Tags::Mortars<Tags::Mesh<dim - 1>, dim>>(migrated_box) ==
+        db::get<Tags::Mortars<Tags::Mesh<dim - 1>, dim>>(box));
+  CHECK(db::get<Tags::Mortars<Tags::MortarSize<dim - 1>, dim>>(
+            migrated_box) ==
+        db::get<Tags::Mortars<Tags::MortarSize<dim - 1>, dim>>(box));
 }
 
 void test_mortar_orientation() noexcept {
@@ -395,6 +418,55 @@ void test_mortar_orientation() noexcept {
   CHECK(db::get<Tags::Mortars<Tags::Mesh<2>, 3>>(box).at(mortar_id).extents() ==
         Index<2>{{{3, 4}}});
 }
+
+struct EventClasses {
+  template <typename T>
+  using type = tmpl::list<Events::PrintFluxCommunicationTiming<T>>;
+};
+
+void test_print_flux_communication_timing() noexcept {
+  using metavariables = Metavariables<1, false, false, tmpl::list<>>;
+  const ElementId<1> element_id{0, {{SegmentId{2, 1}}}};
+  const DomainCreators::Interval<Frame::Inertial> domain_creator{
+      {{-0.5}}, {{1.5}}, {{false}}, {{2}}, {{4}}};
+
+  using my_component = component<1, metavariables>;
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavariables>;
+  using MockDistributedObjectsTag =
+      typename MockRuntimeSystem::template MockDistributedObjectsTag<
+          my_component>;
+  typename MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(ElementIndex<1>{element_id},
+               ActionTesting::MockDistributedObject<my_component>{});
+
+  ActionTesting::MockRuntimeSystem<metavariables> runner{
+      {std::make_unique<TimeSteppers::AdamsBashforthN>(4),
+       SystemAnalyticSolution{}},
+      std::move(dist_objects)};
+
+  runner.simple_action<my_component, dg::Actions::InitializeElement<1>>(
+      element_id, domain_creator.initial_extents(),
+      domain_creator.create_domain(), 0., 1., 1.);
+  const auto& box =
+      runner.template algorithms<my_component>()
+          .at(element_id)
+          .template get_databox<typename my_component::initial_databox>();
+
+  // No boundary data has been exchanged yet
+  CHECK(db::get<Tags::FluxCommunicationTiming>(box) ==
+        dg::FluxCommunicationTiming{});
+
+  // The event is run on the DataBox created by InitializeElement by every
+  // executable that lists it
+  Parallel::ConstGlobalCache<metavariables> cache{
+      {std::make_unique<TimeSteppers::AdamsBashforthN>(4),
+       SystemAnalyticSolution{}}};
+  using event_type = Events::PrintFluxCommunicationTiming<EventClasses>;
+  db::apply<typename event_type::argument_tags>(
+      event_type{}, box, cache, ElementIndex<1>{element_id},
+      std::add_pointer_t<my_component>{});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.dG.InitializeElement",
@@ -485,4 +557,5 @@ SPECTRE_TEST_CASE("Unit.Evolution.dG.InitializeElement",
           {{-0.5, -0.75}}, {{1.5, 2.4}}, {{false, false}}, {{2, 3}}, {{4, 5}}});
 
   test_mortar_orientation();
+  test_print_flux_communication_timing();
 }
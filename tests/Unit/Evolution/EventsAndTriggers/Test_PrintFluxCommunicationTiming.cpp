@@ -0,0 +1,31 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <memory>
+
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Evolution/EventsAndTriggers/PrintFluxCommunicationTiming.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+struct EventClasses {
+  template <typename T>
+  using type = tmpl::list<Events::PrintFluxCommunicationTiming<T>>;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE(
+    "Unit.Evolution.EventsAndTriggers.PrintFluxCommunicationTiming",
+    "[Unit][Evolution]") {
+  Parallel::register_derived_classes_with_charm<Event<EventClasses>>();
+  const auto event = test_factory_creation<Event<EventClasses>>(
+      "  PrintFluxCommunicationTiming");
+  CHECK(dynamic_cast<const Events::PrintFluxCommunicationTiming<
+            EventClasses>*>(serialize_and_deserialize(event).get()) !=
+        nullptr);
+}
@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Evolution/EventsAndTriggers/Actions/RunEventsAndTriggers.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Event.hpp"
+#include "Evolution/EventsAndTriggers/EventsAndTriggers.hpp"
+#include "Evolution/EventsAndTriggers/LogicalTriggers.hpp"  // IWYU pragma: keep
+#include "Evolution/EventsAndTriggers/Trigger.hpp"
+#include "Evolution/EventsAndTriggers/WriteCheckpoint.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Parallel/RequestPhase.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+// IWYU pragma: no_forward_declare db::DataBox
+
+namespace {
+struct EventClasses {
+  template <typename T>
+  using type = tmpl::list<Events::WriteCheckpoint<T>>;
+};
+
+struct TriggerClasses {
+  template <typename T>
+  using type = tmpl::list<>;
+};
+
+using EventsAndTriggersType = EventsAndTriggers<EventClasses, TriggerClasses>;
+using events_and_triggers_tag =
+    Tags::EventsAndTriggers<EventClasses, TriggerClasses>;
+
+struct Metavariables;
+struct component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tag_list = tmpl::list<events_and_triggers_tag>;
+  using action_list = tmpl::list<Actions::RunEventsAndTriggers>;
+  using initial_databox = db::DataBox<tmpl::list<>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<component>;
+  using const_global_cache_tag_list = tmpl::list<>;
+  enum class Phase { Initialization, Evolve, WriteCheckpoint, Exit };
+};
+
+std::vector<Metavariables::Phase> requested_phases{};  // NOLINT
+}  // namespace
+
+namespace Parallel {
+template <>
+void request_phase<Metavariables>(
+    ConstGlobalCache<Metavariables>& /*cache*/,
+    const Metavariables::Phase phase) noexcept {
+  requested_phases.push_back(phase);
+}
+}  // namespace Parallel
+
+SPECTRE_TEST_CASE("Unit.Evolution.EventsAndTriggers.WriteCheckpoint",
+                  "[Unit][Evolution]") {
+  Parallel::register_derived_classes_with_charm<Event<EventClasses>>();
+  Parallel::register_derived_classes_with_charm<Trigger<TriggerClasses>>();
+  const auto event =
+      test_factory_creation<Event<EventClasses>>("  WriteCheckpoint");
+  CHECK(dynamic_cast<const Events::WriteCheckpoint<EventClasses>*>(
+            serialize_and_deserialize(event).get()) != nullptr);
+
+  const auto events_and_triggers = test_creation<EventsAndTriggersType>(
+      "  ? Always\n"
+      "  : - WriteCheckpoint\n");
+
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  using MockDistributedObjectsTag =
+      typename MockRuntimeSystem::template MockDistributedObjectsTag<
+          component>;
+  typename MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(0, db::DataBox<tmpl::list<>>{});
+  MockRuntimeSystem runner{{serialize_and_deserialize(events_and_triggers)},
+                           std::move(dist_objects)};
+
+  CHECK(requested_phases.empty());
+  runner.next_action<component>(0);
+  // The element stops and waits for the WriteCheckpoint phase.
+  CHECK(runner.algorithms<component>()[0].get_terminate());
+  CHECK(requested_phases == std::vector<Metavariables::Phase>{
+                                Metavariables::Phase::WriteCheckpoint});
+}
@@ -11,6 +11,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/ScratchArena.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 
@@ -192,4 +193,22 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.DuDt",
   CHECK(dt_phi.get(2, 2, 3)[1] == approx(1422.401000428901625));
   CHECK(dt_phi.get(2, 3, 3)[0] == approx(1116.070338196526109));
   CHECK(dt_phi.get(2, 3, 3)[1] == approx(-42638.998279054998420));
+
+  // Once the scratch arena has grown, the temporaries are reused and
+  // recomputing the time derivatives does not allocate.
+  const auto& arena = ScratchArena::thread_local_instance();
+  const size_t heap_allocations = arena.number_of_heap_allocations();
+  const auto expected_dt_psi = dt_psi;
+  const auto expected_dt_pi = dt_pi;
+  const auto expected_dt_phi = dt_phi;
+  GeneralizedHarmonic::ComputeDuDt<dim>::apply(
+      make_not_null(&dt_psi), make_not_null(&dt_pi), make_not_null(&dt_phi),
+      psi, pi, phi, d_psi, d_pi, d_phi, gamma0, gamma1, gamma2, gauge_function,
+      spacetime_deriv_gauge_function, lapse, shift, upper_spatial_metric,
+      upper_psi, trace_christoffel_first_kind, christoffel_first_kind,
+      christoffel_second_kind, normal_vector, normal_one_form);
+  CHECK(arena.number_of_heap_allocations() == heap_allocations);
+  CHECK(dt_psi == expected_dt_psi);
+  CHECK(dt_pi == expected_dt_pi);
+  CHECK(dt_phi == expected_dt_phi);
 }
@@ -12,8 +12,13 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
@@ -27,15 +32,6 @@
 // IWYU pragma: no_forward_declare Tensor
 // IWYU pragma: no_include <array>
 
-namespace grmhd {
-namespace ValenciaDivClean {
-namespace PrimitiveRecoverySchemes {
-class NewmanHamlin;
-class PalenzuelaEtAl;
-}  // namespace PrimitiveRecoverySchemes
-}  // namespace ValenciaDivClean
-}  // namespace grmhd
-
 namespace {
 
 Scalar<DataVector> random_density(const gsl::not_null<std::mt19937*> generator,
@@ -337,6 +333,120 @@ void test_primitive_from_conservative_known(
                         divergence_cleaning_field);
 }
 
+// Checks that the batched form of a primitive recovery scheme agrees with the
+// pointwise form at every point, including points at which it fails.
+template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
+void test_batched_recovery(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& used_for_size,
+    const bool include_unrecoverable_point) noexcept {
+  const auto rest_mass_density = random_density(generator, used_for_size);
+  const auto lorentz_factor = random_lorentz_factor(generator, used_for_size);
+  const auto spatial_metric = random_spatial_metric(generator, used_for_size);
+  const auto spatial_velocity =
+      random_velocity(generator, lorentz_factor, spatial_metric);
+  const auto specific_internal_energy = make_overloader(
+      [&rest_mass_density](const EquationsOfState::EquationOfState<true, 1>&
+                               the_equation_of_state) noexcept {
+        return the_equation_of_state.specific_internal_energy_from_density(
+            rest_mass_density);
+      },
+      [&generator,
+       &used_for_size ](const EquationsOfState::EquationOfState<true, 2>&
+                        /*the_equation_of_state*/) noexcept {
+        return random_specific_internal_energy(generator, used_for_size);
+      })(equation_of_state);
+  const auto pressure = make_overloader(
+      [&rest_mass_density](const EquationsOfState::EquationOfState<true, 1>&
+                               the_equation_of_state) noexcept {
+        return the_equation_of_state.pressure_from_density(rest_mass_density);
+      },
+      [&rest_mass_density, &specific_internal_energy ](
+          const EquationsOfState::EquationOfState<true, 2>&
+              the_equation_of_state) noexcept {
+        return the_equation_of_state.pressure_from_density_and_energy(
+            rest_mass_density, specific_internal_energy);
+      })(equation_of_state);
+  const auto magnetic_field =
+      random_magnetic_field(generator, pressure, spatial_metric);
+  const auto det_and_inv = determinant_and_inverse(spatial_metric);
+  const Scalar<DataVector> sqrt_det_spatial_metric{
+      sqrt(get(det_and_inv.first))};
+
+  Scalar<DataVector> tilde_d(used_for_size.size());
+  Scalar<DataVector> tilde_tau(used_for_size.size());
+  tnsr::i<DataVector, 3> tilde_s(used_for_size.size());
+  tnsr::I<DataVector, 3> tilde_b(used_for_size.size());
+  Scalar<DataVector> tilde_phi(used_for_size.size());
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_tau),
+      make_not_null(&tilde_s), make_not_null(&tilde_b),
+      make_not_null(&tilde_phi), rest_mass_density, specific_internal_energy,
+      specific_enthalpy(rest_mass_density, specific_internal_energy, pressure),
+      pressure, spatial_velocity, lorentz_factor, magnetic_field,
+      sqrt_det_spatial_metric, spatial_metric,
+      random_divergence_cleaning_field(generator, used_for_size));
+
+  // The inputs to the schemes, computed as in PrimitiveFromConservative.  The
+  // last point, if present, violates the Cauchy-Schwarz inequality between
+  // the momentum density and the magnetic field.
+  const size_t number_of_points =
+      used_for_size.size() + (include_unrecoverable_point ? 1 : 0);
+  DataVector total_energy_density(number_of_points, 1.0);
+  DataVector momentum_density_squared(number_of_points, 0.0);
+  DataVector momentum_density_dot_magnetic_field(number_of_points, 1.0);
+  DataVector magnetic_field_squared(number_of_points, 1.0);
+  DataVector rest_mass_density_times_lorentz_factor(number_of_points, 1.0);
+  const DataVector& sqrt_det = get(sqrt_det_spatial_metric);
+  const auto tilde_s_upper =
+      raise_or_lower_index(tilde_s, det_and_inv.second);
+  const DataVector tilde_s_squared = get(dot_product(tilde_s, tilde_s_upper));
+  const DataVector tilde_s_dot_tilde_b = get(dot_product(tilde_s, tilde_b));
+  const DataVector tilde_b_squared =
+      get(dot_product(tilde_b, tilde_b, spatial_metric));
+  for (size_t s = 0; s < used_for_size.size(); ++s) {
+    total_energy_density[s] =
+        (get(tilde_tau)[s] + get(tilde_d)[s]) / sqrt_det[s];
+    momentum_density_squared[s] = tilde_s_squared[s] / square(sqrt_det[s]);
+    momentum_density_dot_magnetic_field[s] =
+        tilde_s_dot_tilde_b[s] / square(sqrt_det[s]);
+    magnetic_field_squared[s] = tilde_b_squared[s] / square(sqrt_det[s]);
+    rest_mass_density_times_lorentz_factor[s] =
+        get(tilde_d)[s] / sqrt_det[s];
+  }
+
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+      BatchedPrimitiveRecoveryData batched_data{};
+  PrimitiveRecoveryScheme::template apply<ThermodynamicDim>(
+      make_not_null(&batched_data), total_energy_density,
+      momentum_density_squared, momentum_density_dot_magnetic_field,
+      magnetic_field_squared, rest_mass_density_times_lorentz_factor,
+      equation_of_state);
+  REQUIRE(batched_data.recovered.size() == number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const auto pointwise_data =
+        PrimitiveRecoveryScheme::template apply<ThermodynamicDim>(
+            total_energy_density[s], momentum_density_squared[s],
+            momentum_density_dot_magnetic_field[s], magnetic_field_squared[s],
+            rest_mass_density_times_lorentz_factor[s], equation_of_state);
+    CAPTURE(s);
+    REQUIRE(static_cast<bool>(pointwise_data) == batched_data.recovered[s]);
+    if (pointwise_data) {
+      CHECK(batched_data.rest_mass_density[s] ==
+            approx(pointwise_data->rest_mass_density));
+      CHECK(batched_data.lorentz_factor[s] ==
+            approx(pointwise_data->lorentz_factor));
+      CHECK(batched_data.pressure[s] == approx(pointwise_data->pressure));
+      CHECK(batched_data.rho_h_w_squared[s] ==
+            approx(pointwise_data->rho_h_w_squared));
+    }
+  }
+  if (include_unrecoverable_point) {
+    CHECK_FALSE(batched_data.recovered.back());
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -369,4 +479,23 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
       2>(&generator, ideal_fluid, dv);
+  test_primitive_from_conservative_random<
+      tmpl::list<
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
+      2>(&generator, ideal_fluid, dv);
+
+  const DataVector batch(50);
+  test_batched_recovery<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>(
+      &generator, polytropic_fluid, batch, true);
+  test_batched_recovery<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>(
+      &generator, ideal_fluid, batch, true);
+  test_batched_recovery<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>(
+      &generator, polytropic_fluid, batch, false);
+  test_batched_recovery<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>(
+      &generator, ideal_fluid, batch, false);
 }
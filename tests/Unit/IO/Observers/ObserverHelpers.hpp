@@ -48,7 +48,8 @@ struct observer_writer_component {
   using array_index = size_t;
   using const_global_cache_tag_list =
       tmpl::list<observers::OptionTags::ReductionFileName,
-                 observers::OptionTags::VolumeFileName>;
+                 observers::OptionTags::VolumeFileName,
+                 observers::OptionTags::ContiguousVolumeData>;
   using action_list = tmpl::list<>;
   using component_being_mocked = observers::ObserverWriter<Metavariables>;
   using simple_tags =
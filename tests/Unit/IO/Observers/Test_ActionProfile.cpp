@@ -0,0 +1,106 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/Initialize.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
+#include "IO/Observer/ProfilingActions.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Parallel/ActionProfiler.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+#include "tests/Unit/IO/Observers/ObserverHelpers.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace TestObservers_detail;
+
+namespace {
+struct ProfiledComponent {};
+struct ProfiledAction {};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ActionProfile", "[Unit][Observers]") {
+  using obs_component = observer_component<Metavariables>;
+  using obs_writer = observer_writer_component<Metavariables>;
+
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<obs_component>>(
+      dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<obs_component>{});
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<obs_writer>>(
+      dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<obs_writer>{});
+
+  tuples::TaggedTuple<observers::OptionTags::ReductionFileName,
+                      observers::OptionTags::VolumeFileName,
+                      observers::OptionTags::ContiguousVolumeData>
+      cache_data{};
+  const auto& output_file_prefix =
+      tuples::get<observers::OptionTags::ReductionFileName>(cache_data) =
+          "./Unit.IO.Observers.ActionProfile";
+  MockRuntimeSystem runner{cache_data, std::move(dist_objects)};
+
+  runner.simple_action<obs_component,
+                       observers::Actions::Initialize<Metavariables>>(0);
+  runner.simple_action<obs_writer,
+                       observers::Actions::InitializeWriter<Metavariables>>(0);
+
+  const std::string h5_file_name = output_file_prefix + ".h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  auto& profiler = Parallel::ActionProfiler::thread_local_instance();
+  profiler.reset();
+  const size_t action_id =
+      Parallel::action_profiler_id<ProfiledComponent, 3, ProfiledAction>();
+  profiler.record_call(action_id, 2.0);
+  profiler.record_call(action_id, 0.5);
+  profiler.record_wait(action_id, 1.25);
+
+  runner.simple_action<obs_component,
+                       observers::Actions::ContributeActionProfile>(0);
+  runner.invoke_queued_threaded_action<obs_writer>(0);
+
+  const auto& writer_box =
+      runner.template algorithms<obs_writer>()
+          .at(0)
+          .template get_databox<typename obs_writer::initial_databox>();
+  CHECK(db::get<observers::Tags::ActionProfiles>(writer_box).empty());
+  CHECK(db::get<observers::Tags::ActionProfilesContributed>(writer_box) == 0);
+  // The profile is written to disk right away
+  CHECK(db::get<observers::Tags::ReductionFileWriter>(writer_box)
+            .number_of_buffered_rows() == 0);
+
+  {
+    const auto file = h5::H5File<h5::AccessType::ReadOnly>(h5_file_name);
+    const auto& dat_file =
+        file.get<h5::Dat>("/ActionProfile/ProfiledComponent/03_ProfiledAction");
+    CHECK(dat_file.get_legend() ==
+          std::vector<std::string>{"WallTime", "NumberOfCalls",
+                                   "InclusiveTime", "WaitingTime"});
+    const Matrix written_data = dat_file.get_data();
+    CHECK(written_data.rows() == 1);
+    CHECK(written_data(0, 1) == 2.0);
+    CHECK(written_data(0, 2) == 2.5);
+    CHECK(written_data(0, 3) == 1.25);
+  }
+
+  profiler.reset();
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
@@ -0,0 +1,74 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/ReductionFileWriter.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionFileWriter",
+                  "[Unit][Observers]") {
+  const std::string h5_file_name("Unit.IO.Observers.ReductionFileWriter.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> legend{"Time", "Error"};
+  const std::vector<std::string> other_legend{"Time", "Norm", "Error"};
+
+  {
+    observers::ReductionFileWriter writer(2);
+    writer.append(h5_file_name, "/element_data", legend, {0.0, 1.0});
+    CHECK(writer.number_of_buffered_rows() == 1);
+    // Reaching the number of rows per flush writes the subfile's rows
+    writer.append(h5_file_name, "/element_data", legend, {1.0, 2.0});
+    CHECK(writer.number_of_buffered_rows() == 0);
+    writer.append(h5_file_name, "/element_data", legend, {2.0, 3.0});
+    writer.append(h5_file_name, "/other_data", other_legend,
+                  {2.0, 5.0, 6.0});
+    CHECK(writer.number_of_buffered_rows() == 2);
+
+    // Serializing keeps the buffered rows but not the open file, which is
+    // reopened by the next write.
+    writer = serialize_and_deserialize(writer);
+    CHECK(writer.number_of_buffered_rows() == 2);
+
+    writer.flush();
+    CHECK(writer.number_of_buffered_rows() == 0);
+    writer.append(h5_file_name, "/element_data", legend, {3.0, 4.0});
+    writer.close();
+    CHECK(writer.number_of_buffered_rows() == 0);
+  }
+
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> file(h5_file_name);
+    const auto& dat_file = file.get<h5::Dat>("/element_data");
+    CHECK(dat_file.get_legend() == legend);
+    const Matrix data = dat_file.get_data();
+    REQUIRE(data.rows() == 4);
+    for (size_t i = 0; i < 4; ++i) {
+      CHECK(data(i, 0) == static_cast<double>(i));
+      CHECK(data(i, 1) == static_cast<double>(i) + 1.0);
+    }
+  }
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> file(h5_file_name);
+    const auto& dat_file = file.get<h5::Dat>("/other_data");
+    CHECK(dat_file.get_legend() == other_legend);
+    const Matrix data = dat_file.get_data();
+    REQUIRE(data.rows() == 1);
+    CHECK(data(0, 1) == 5.0);
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
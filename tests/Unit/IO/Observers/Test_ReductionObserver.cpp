@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "Domain/ElementId.hpp"
 #include "Domain/ElementIndex.hpp"
@@ -74,7 +75,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
   }
 
   tuples::TaggedTuple<observers::OptionTags::ReductionFileName,
-                      observers::OptionTags::VolumeFileName>
+                      observers::OptionTags::VolumeFileName,
+                      observers::OptionTags::ContiguousVolumeData>
       cache_data{};
   const auto& output_file_prefix =
       tuples::get<observers::OptionTags::ReductionFileName>(cache_data) =
@@ -137,6 +139,16 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
   // Invke the threaded action 'WriteReductionData' to write reduction data to
   // disk.
   runner.invoke_queued_threaded_action<obs_writer>(0);
+  // The writer buffers the reduction data, so nothing is written until the
+  // buffer is flushed.
+  CHECK(db::get<observers::Tags::ReductionFileWriter>(
+            runner.template algorithms<obs_writer>()
+                .at(0)
+                .template get_databox<
+                    typename obs_writer::initial_databox>())
+            .number_of_buffered_rows() == 1);
+  runner.threaded_action<obs_writer,
+                         observers::ThreadedActions::FlushReductionData>(0);
 
   // Check that the H5 file was written correctly.
   {
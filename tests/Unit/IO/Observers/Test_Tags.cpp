@@ -16,7 +16,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   CHECK(VolumeArrayComponentIds::name() == "VolumeArrayComponentIds");
   CHECK(TensorData::name() == "TensorData");
   CHECK(VolumeObserversContributed::name() == "VolumeObserversContributed");
-  CHECK(H5FileLock::name() == "H5FileLock");
+  CHECK(ReductionFileWriter::name() == "ReductionFileWriter");
+  CHECK(VolumeFileWriter::name() == "VolumeFileWriter");
   CHECK(ReductionData<double>::name() == "ReductionData");
   CHECK(ReductionDataNames<double>::name() == "ReductionDataNames");
   CHECK(NumberOfNodesContributedToReduction::name() ==
@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/VolumeFileWriter.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+void test_writer(const h5::VolumeData::Layout layout) noexcept {
+  const std::string h5_file_name("Unit.IO.Observers.VolumeFileWriter.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grids{"Element0", "Element1"};
+  const auto make_volume_data = [&grids](const double observation_value) {
+    std::vector<ExtentsAndTensorVolumeData> volume_data{};
+    for (size_t i = 0; i < grids.size(); ++i) {
+      const double offset = observation_value + static_cast<double>(i);
+      volume_data.emplace_back(
+          std::vector<size_t>{2, 2},
+          std::vector<TensorComponent>{
+              TensorComponent{grids[i] + "/Psi",
+                              DataVector{offset, offset + 1.0, offset + 2.0,
+                                         offset + 3.0}}});
+    }
+    return volume_data;
+  };
+
+  {
+    // Allow less than one observation to be queued so that the second push
+    // has to wait for the first observation to be written.
+    observers::VolumeFileWriter writer(8);
+    for (size_t i = 0; i < 3; ++i) {
+      writer.push(h5_file_name, layout, i, 0.5 * static_cast<double>(i),
+                  make_volume_data(0.5 * static_cast<double>(i)));
+    }
+    writer.wait();
+    CHECK(writer.number_of_queued_bytes() == 0);
+
+    // Serializing only keeps the bound, and the I/O thread is restarted by
+    // the next push.
+    writer = serialize_and_deserialize(writer);
+    writer.push(h5_file_name, layout, 3, 1.5, make_volume_data(1.5));
+    writer.close();
+    CHECK(writer.number_of_queued_bytes() == 0);
+  }
+
+  {
+    const std::lock_guard<std::mutex> hdf5_lock(observers::hdf5_mutex());
+    h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+    const auto& volume_file = my_file.get<h5::VolumeData>("/element_data");
+    CHECK(volume_file.get_layout() == layout);
+    CHECK(volume_file.list_observation_ids().size() == 4);
+    for (size_t observation_id = 0; observation_id < 4; ++observation_id) {
+      const double observation_value =
+          0.5 * static_cast<double>(observation_id);
+      CHECK(volume_file.get_observation_value(observation_id) ==
+            observation_value);
+      CHECK(volume_file.list_grids(observation_id) == grids);
+      const auto expected_data = make_volume_data(observation_value);
+      for (size_t i = 0; i < grids.size(); ++i) {
+        CHECK(volume_file.get_tensor_component(observation_id, grids[i],
+                                               "Psi") ==
+              expected_data[i].tensor_components[0].data);
+      }
+    }
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeFileWriter", "[Unit][Observers]") {
+  test_writer(h5::VolumeData::Layout::PerGrid);
+  test_writer(h5::VolumeData::Layout::Contiguous);
+}
@@ -77,7 +77,8 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   }
 
   tuples::TaggedTuple<observers::OptionTags::ReductionFileName,
-                      observers::OptionTags::VolumeFileName>
+                      observers::OptionTags::VolumeFileName,
+                      observers::OptionTags::ContiguousVolumeData>
       cache_data{};
   const auto& output_file_prefix =
       tuples::get<observers::OptionTags::VolumeFileName>(cache_data) =
@@ -153,13 +154,18 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   // Invoke the simple action 'ContributeVolumeDataToWriter' to move the volume
   // data to the Writer parallel component.
   runner.invoke_queued_simple_action<obs_writer>(0);
-  // Invoke the threaded action 'WriteVolumeData' to write the data to disk.
+  // Invoke the threaded action 'WriteVolumeData' to hand the data to the I/O
+  // thread, and wait for it to be written to disk.
   runner.invoke_queued_threaded_action<obs_writer>(0);
+  runner.threaded_action<obs_writer,
+                         observers::ThreadedActions::FlushVolumeData>(0);
 
   // Check that the H5 file was written correctly.
   {
     h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
     auto& volume_file = my_file.get<h5::VolumeData>("/element_data");
+    // The contiguous layout is only used if it is requested.
+    CHECK(volume_file.get_layout() == h5::VolumeData::Layout::PerGrid);
 
     const auto temporal_id = observers::ObservationId(TimeId(3)).hash();
     CHECK(volume_file.list_observation_ids() ==
@@ -3,6 +3,7 @@
 
 #include "tests/Unit/TestingFramework.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -126,6 +127,65 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   }
 }
 
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.Contiguous", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.Contiguous.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grids{"[[2,3,4]]", "[[7,3,8]]"};
+  const std::vector<std::vector<size_t>> extents{{2, 2}, {3, 2}};
+  const std::vector<DataVector> psi{{8.9, 7.6, 3.9, 2.1},
+                                    {-7.9, 7.6, 1.9, -8.1, -6.3, 2.7}};
+  const std::vector<DataVector> x_coord{{0.0, 1.0, 0.0, 1.0},
+                                        {0.0, 0.5, 1.0, 0.0, 0.5, 1.0}};
+  const size_t observation_id = 8435087234;
+  const double observation_value = 2.3;
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& volume_file = my_file.insert<h5::VolumeData>(
+        "/element_data", version_number, h5::VolumeData::Layout::Contiguous,
+        4);
+    CHECK(volume_file.get_layout() == h5::VolumeData::Layout::Contiguous);
+    std::vector<ExtentsAndTensorVolumeData> volume_data{};
+    for (size_t i = 0; i < grids.size(); ++i) {
+      volume_data.emplace_back(
+          extents[i],
+          std::vector<TensorComponent>{
+              TensorComponent{grids[i] + "/Psi", psi[i]},
+              TensorComponent{grids[i] + "/x-coord", x_coord[i]}});
+    }
+    volume_file.write_volume_data(observation_id, observation_value,
+                                  volume_data);
+  }
+
+  // Reopening the subfile reads the layout from the file
+  h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+  const auto& volume_file =
+      my_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.get_layout() == h5::VolumeData::Layout::Contiguous);
+  CHECK(volume_file.list_observation_ids() ==
+        std::vector<size_t>{observation_id});
+  CHECK(volume_file.get_observation_value(observation_id) ==
+        observation_value);
+  CHECK(volume_file.list_grids(observation_id) == grids);
+  for (size_t i = 0; i < grids.size(); ++i) {
+    CHECK(volume_file.get_extents(observation_id, grids[i]) == extents[i]);
+    auto read_components =
+        volume_file.list_tensor_components(observation_id, grids[i]);
+    std::sort(read_components.begin(), read_components.end());
+    CHECK(read_components == std::vector<std::string>{"Psi", "x-coord"});
+    CHECK(volume_file.get_tensor_component(observation_id, grids[i], "Psi") ==
+          psi[i]);
+    CHECK(volume_file.get_tensor_component(observation_id, grids[i],
+                                           "x-coord") == x_coord[i]);
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
 // [[OutputRegex, The expected format of the tensor component names is
 // 'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in]]
 [[noreturn]] SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ComponentFormat0",
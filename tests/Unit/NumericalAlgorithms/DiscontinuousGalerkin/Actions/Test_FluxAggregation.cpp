@@ -0,0 +1,296 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Direction.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/ElementIndex.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxAggregation.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregationCounters.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregator.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+namespace {
+struct TemporalId : db::SimpleTag {
+  static std::string name() noexcept { return "TemporalId"; }
+  using type = int;
+};
+
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = Scalar<DataVector>;
+};
+
+struct NumericalFlux {
+  using package_tags = tmpl::list<Var>;
+  // clang-tidy: do not use references
+  void pup(PUP::er& /*p*/) noexcept {}  // NOLINT
+};
+
+struct NumericalFluxTag {
+  using type = NumericalFlux;
+};
+
+struct System {
+  static constexpr const size_t volume_dim = 1;
+  using variables_tag = Tags::Variables<tmpl::list<Var>>;
+};
+
+template <typename Metavariables>
+using flux_comm_types = dg::FluxCommunicationTypes<Metavariables>;
+
+// Only provides the inbox the boundary data is delivered to.
+template <typename Metavariables>
+struct ReceiveFluxes {
+  using inbox_tags =
+      tmpl::list<typename flux_comm_types<Metavariables>::FluxesTag>;
+
+  template <typename DbTags, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+
+template <typename Metavariables>
+struct element_component {
+  using component_being_mocked = void;  // Not needed
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementIndex<1>;
+  using const_global_cache_tag_list = tmpl::list<>;
+  using action_list = tmpl::list<ReceiveFluxes<Metavariables>>;
+  using initial_databox = db::DataBox<tmpl::list<>>;
+};
+
+template <typename Metavariables>
+struct aggregator_component {
+  using component_being_mocked = dg::FluxAggregator<Metavariables>;
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tag_list =
+      tmpl::list<dg::OptionTags::FluxAggregationMaxMessages>;
+  using action_list = tmpl::list<>;
+  using simple_tags = typename dg::Actions::InitializeFluxAggregator<
+      Metavariables>::simple_tags;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct Metavariables {
+  using system = System;
+  using component_list = tmpl::list<element_component<Metavariables>,
+                                    aggregator_component<Metavariables>>;
+  using temporal_id = TemporalId;
+  using const_global_cache_tag_list = tmpl::list<>;
+
+  using normal_dot_numerical_flux = NumericalFluxTag;
+};
+
+using my_element = element_component<Metavariables>;
+using my_aggregator = aggregator_component<Metavariables>;
+using fluxes_tag = flux_comm_types<Metavariables>::FluxesTag;
+using PackagedData = flux_comm_types<Metavariables>::PackagedData;
+using buffer_tag = dg::Tags::FluxAggregationBuffer<fluxes_tag, 1>;
+using aggregate_action = dg::Actions::AggregateFluxData<my_element>;
+using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+
+// The message `sender` sends to `receiver` at `temporal_id`
+buffer_tag::Message message(const ElementId<1>& sender,
+                            const ElementId<1>& receiver,
+                            const int temporal_id) noexcept {
+  return std::make_pair(
+      receiver,
+      std::make_pair(std::make_pair(Direction<1>::lower_xi(), sender),
+                     std::make_pair(temporal_id + 1,
+                                    PackagedData(3, 10. * temporal_id +
+                                                        sender.block_id()))));
+}
+
+// The inbox of `receiver` if the message had been sent directly
+fluxes_tag::type direct_inbox(const ElementId<1>& sender,
+                              const ElementId<1>& receiver,
+                              const int temporal_id) noexcept {
+  fluxes_tag::type inbox{};
+  inbox[temporal_id].emplace(message(sender, receiver, temporal_id).second);
+  return inbox;
+}
+
+void test_aggregation(const size_t max_messages) noexcept {
+  INFO("Maximum number of messages " << max_messages);
+  const ElementId<1> sender(0);
+  const ElementId<1> receiver(1);
+  const ElementId<1> other_receiver(2);
+
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  for (const auto& id : {sender, receiver, other_receiver}) {
+    tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_element>>(
+        dist_objects)
+        .emplace(ElementIndex<1>{id},
+                 ActionTesting::MockDistributedObject<my_element>{});
+  }
+  for (const int proc : {0, 1}) {
+    tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_aggregator>>(
+        dist_objects)
+        .emplace(proc, ActionTesting::MockDistributedObject<my_aggregator>{});
+  }
+  MockRuntimeSystem runner{{max_messages}, std::move(dist_objects)};
+  // The receivers are on another processor than the sender
+  runner.algorithms<my_element>().at(receiver).set_processor(1);
+  runner.algorithms<my_element>().at(other_receiver).set_processor(1);
+  runner.algorithms<my_aggregator>().at(1).set_processor(1);
+  for (const int proc : {0, 1}) {
+    runner.simple_action<my_aggregator,
+                         dg::Actions::InitializeFluxAggregator<Metavariables>>(
+        proc);
+  }
+  const auto get_box = [&runner]() noexcept -> decltype(auto) {
+    return runner.algorithms<my_aggregator>()
+        .at(0)
+        .get_databox<my_aggregator::initial_databox>();
+  };
+
+  runner.simple_action<my_aggregator, aggregate_action>(
+      0, 0, message(sender, receiver, 0));
+  CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+            .number_of_messages == 1);
+  CHECK(runner.nonempty_inboxes<my_element, fluxes_tag>().empty());
+  if (max_messages == 1) {
+    // The batch is full, so it is sent without a flush
+    CHECK(db::get<buffer_tag>(get_box()).empty());
+    CHECK(runner.is_simple_action_queue_empty<my_aggregator>(0));
+    CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+              .number_of_batches == 1);
+    CHECK(not runner.is_simple_action_queue_empty<my_aggregator>(1));
+  } else {
+    CHECK(db::get<buffer_tag>(get_box()).size() == 1);
+    CHECK(db::get<buffer_tag>(get_box()).at({1, 0}).size() == 1);
+    CHECK(not runner.is_simple_action_queue_empty<my_aggregator>(0));
+    CHECK(runner.is_simple_action_queue_empty<my_aggregator>(1));
+  }
+
+  runner.simple_action<my_aggregator, aggregate_action>(
+      0, 0, message(sender, other_receiver, 0));
+  CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+            .number_of_messages == 2);
+  if (max_messages <= 2) {
+    // The batch is sent as soon as it is full
+    CHECK(db::get<buffer_tag>(get_box()).empty());
+    CHECK(not runner.is_simple_action_queue_empty<my_aggregator>(1));
+    CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+              .number_of_batches == (max_messages == 1 ? 2 : 1));
+  } else {
+    CHECK(db::get<buffer_tag>(get_box()).at({1, 0}).size() == 2);
+    CHECK(runner.is_simple_action_queue_empty<my_aggregator>(1));
+    CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+              .number_of_batches == 0);
+  }
+
+  if (max_messages > 1) {
+    // FlushAggregatedFluxData sends the incomplete batches, and there is only
+    // one flush queued
+    runner.invoke_queued_simple_action<my_aggregator>(0);
+    CHECK(runner.is_simple_action_queue_empty<my_aggregator>(0));
+    CHECK(db::get<buffer_tag>(get_box()).empty());
+    CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+              .number_of_batches == 1);
+  }
+  CHECK(db::get<dg::Tags::FluxAggregationCounters>(get_box())
+            .number_of_bytes > 0);
+  CHECK(runner.nonempty_inboxes<my_element, fluxes_tag>().empty());
+
+  // ReceiveAggregatedFluxData delivers the data to the receivers
+  while (not runner.is_simple_action_queue_empty<my_aggregator>(1)) {
+    runner.invoke_queued_simple_action<my_aggregator>(1);
+  }
+  CHECK(runner.nonempty_inboxes<my_element, fluxes_tag>() ==
+        std::unordered_set<ElementIndex<1>>{receiver, other_receiver});
+  CHECK(tuples::get<fluxes_tag>(runner.inboxes<my_element>().at(receiver)) ==
+        direct_inbox(sender, receiver, 0));
+  CHECK(tuples::get<fluxes_tag>(
+            runner.inboxes<my_element>().at(other_receiver)) ==
+        direct_inbox(sender, other_receiver, 0));
+}
+
+void test_batches_by_temporal_id() noexcept {
+  const ElementId<1> sender(0);
+  const ElementId<1> receiver(1);
+
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  for (const auto& id : {sender, receiver}) {
+    tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_element>>(
+        dist_objects)
+        .emplace(ElementIndex<1>{id},
+                 ActionTesting::MockDistributedObject<my_element>{});
+  }
+  for (const int proc : {0, 1}) {
+    tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_aggregator>>(
+        dist_objects)
+        .emplace(proc, ActionTesting::MockDistributedObject<my_aggregator>{});
+  }
+  MockRuntimeSystem runner{{size_t{2}}, std::move(dist_objects)};
+  runner.algorithms<my_element>().at(receiver).set_processor(1);
+  runner.algorithms<my_aggregator>().at(1).set_processor(1);
+  for (const int proc : {0, 1}) {
+    runner.simple_action<my_aggregator,
+                         dg::Actions::InitializeFluxAggregator<Metavariables>>(
+        proc);
+  }
+
+  // Messages at different temporal ids are not batched together
+  runner.simple_action<my_aggregator, aggregate_action>(
+      0, 0, message(sender, receiver, 0));
+  runner.simple_action<my_aggregator, aggregate_action>(
+      0, 1, message(sender, receiver, 1));
+  const auto& box = runner.algorithms<my_aggregator>()
+                        .at(0)
+                        .get_databox<my_aggregator::initial_databox>();
+  CHECK(db::get<buffer_tag>(box).size() == 2);
+  CHECK(runner.is_simple_action_queue_empty<my_aggregator>(1));
+
+  runner.invoke_queued_simple_action<my_aggregator>(0);
+  CHECK(runner.is_simple_action_queue_empty<my_aggregator>(0));
+  CHECK(db::get<buffer_tag>(box).empty());
+  CHECK(db::get<dg::Tags::FluxAggregationCounters>(box).number_of_batches ==
+        2);
+  runner.invoke_queued_simple_action<my_aggregator>(1);
+  runner.invoke_queued_simple_action<my_aggregator>(1);
+  CHECK(runner.is_simple_action_queue_empty<my_aggregator>(1));
+
+  auto expected_inbox = direct_inbox(sender, receiver, 0);
+  expected_inbox[1].emplace(message(sender, receiver, 1).second);
+  CHECK(tuples::get<fluxes_tag>(runner.inboxes<my_element>().at(receiver)) ==
+        expected_inbox);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.Actions.FluxAggregation",
+                  "[Unit][NumericalAlgorithms][Actions]") {
+  for (const size_t max_messages : {1, 2, 3}) {
+    test_aggregation(max_messages);
+  }
+  test_batches_by_temporal_id();
+}
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 // IWYU pragma: no_include <boost/functional/hash/extensions.hpp>
 #include <cstddef>
 #include <functional>
@@ -42,7 +43,11 @@
 #include "Domain/OrientationMap.hpp"
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxCommunication.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregationCounters.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregator.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/ProcessorLocalFluxBuffer.hpp"
 // IWYU pragma: no_include "NumericalAlgorithms/DiscontinuousGalerkin/SimpleBoundaryData.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
@@ -151,6 +156,7 @@ using mortar_sizes_tag = Tags::Mortars<Tags::MortarSize<Dim - 1>, Dim>;
 
 template <size_t Dim, typename Metavariables>
 struct component {
+  using component_being_mocked = void;  // Not needed
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = ElementIndex<Dim>;
@@ -872,3 +878,416 @@ SPECTRE_TEST_CASE(
     }
   }
 }
+
+namespace {
+template <size_t Dim, typename Metavariables>
+struct timing_component : component<Dim, Metavariables> {
+  using action_list =
+      tmpl::list<dg::Actions::SendDataForFluxes<Metavariables>,
+                 dg::Actions::RecordOverlappedWork,
+                 dg::Actions::ReceiveDataForFluxes<Metavariables>>;
+  using simple_tags =
+      tmpl::push_back<typename component<Dim, Metavariables>::simple_tags,
+                      Tags::FluxCommunicationTiming>;
+  using compute_tags = typename component<Dim, Metavariables>::compute_tags;
+  using initial_databox =
+      db::compute_databox_type<tmpl::append<simple_tags, compute_tags>>;
+};
+
+struct TimingMetavariables {
+  using system = System<2>;
+  using component_list =
+      tmpl::list<timing_component<2, TimingMetavariables>>;
+  using temporal_id = TemporalId;
+  using const_global_cache_tag_list = tmpl::list<>;
+
+  using normal_dot_numerical_flux = NumericalFluxTag<2>;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE(
+    "Unit.DiscontinuousGalerkin.Actions.FluxCommunication.Timing",
+    "[Unit][NumericalAlgorithms][Actions]") {
+  using my_component = timing_component<2, TimingMetavariables>;
+  using comm_types = my_component::flux_comm_types;
+
+  const Mesh<2> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const ElementId<2> self_id(1, {{{1, 0}, {1, 0}}});
+  const Element<2> element(self_id, {});
+  auto map = ElementMap<2, Frame::Inertial>(
+      self_id, make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+                   CoordinateMaps::ProductOf2Maps<CoordinateMaps::Affine,
+                                                  CoordinateMaps::Affine>(
+                       {-1., 1., 3., 7.}, {-1., 1., -2., 4.})));
+
+  using MockRuntimeSystem =
+      ActionTesting::MockRuntimeSystem<TimingMetavariables>;
+  using MockDistributedObjectsTag =
+      MockRuntimeSystem::MockDistributedObjectsTag<my_component>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(self_id,
+               db::create<my_component::simple_tags,
+                          my_component::compute_tags>(
+                   0, 1, mesh, element, std::move(map),
+                   db::item_type<normal_dot_fluxes_tag<2, comm_types>>{},
+                   db::item_type<other_data_tag<2>>{},
+                   db::item_type<mortar_data_tag<comm_types>>{},
+                   db::item_type<mortar_next_temporal_ids_tag<2>>{},
+                   db::item_type<mortar_meshes_tag<2>>{},
+                   db::item_type<mortar_sizes_tag<2>>{},
+                   dg::FluxCommunicationTiming{}));
+  MockRuntimeSystem runner{{NumericalFlux<2>{}}, std::move(dist_objects)};
+  const auto get_timing = [&runner, &self_id]() noexcept {
+    return db::get<Tags::FluxCommunicationTiming>(
+        runner.algorithms<my_component>()
+            .at(self_id)
+            .get_databox<my_component::initial_databox>());
+  };
+
+  runner.next_action<my_component>(self_id);
+  CHECK(not std::isnan(get_timing().send_time));
+  CHECK(std::isnan(get_timing().overlapped_work_end_time));
+
+  runner.next_action<my_component>(self_id);
+  CHECK(get_timing().overlapped_work_end_time >= get_timing().send_time);
+
+  CHECK(runner.is_ready<my_component>(self_id));
+  runner.next_action<my_component>(self_id);
+  const auto timing = get_timing();
+  CHECK(timing.number_of_exchanges == 1);
+  CHECK(timing.overlapped_time >= 0.0);
+  CHECK(timing.waiting_time >= 0.0);
+  // The time stamps are reset for the next exchange
+  CHECK(std::isnan(timing.send_time));
+  CHECK(std::isnan(timing.overlapped_work_end_time));
+}
+
+namespace {
+template <typename Metavariables>
+struct aggregator_component {
+  using component_being_mocked = dg::FluxAggregator<Metavariables>;
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tag_list =
+      tmpl::list<dg::OptionTags::FluxAggregationMaxMessages>;
+  using action_list = tmpl::list<>;
+  using simple_tags = typename dg::Actions::InitializeFluxAggregator<
+      Metavariables>::simple_tags;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct AggregatingMetavariables {
+  using system = System<2>;
+  using component_list =
+      tmpl::list<component<2, AggregatingMetavariables>,
+                 aggregator_component<AggregatingMetavariables>>;
+  using temporal_id = TemporalId;
+  using const_global_cache_tag_list = tmpl::list<>;
+
+  using normal_dot_numerical_flux = NumericalFluxTag<2>;
+};
+
+// Adds the element `self_id` and its neighbors in the upper xi and upper eta
+// directions to `dist_objects`
+template <typename Metavariables>
+void add_elements(
+    const gsl::not_null<typename ActionTesting::MockRuntimeSystem<
+        Metavariables>::TupleOfMockDistributedObjects*>
+        dist_objects,
+    const ElementId<2>& self_id,
+    const std::array<ElementId<2>, 2>& neighbor_ids) noexcept {
+  using my_component = component<2, Metavariables>;
+  using comm_types = typename my_component::flux_comm_types;
+  using MockDistributedObjectsTag = typename ActionTesting::MockRuntimeSystem<
+      Metavariables>::template MockDistributedObjectsTag<my_component>;
+  const Mesh<2> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const std::array<Direction<2>, 2> directions{
+      {Direction<2>::upper_xi(), Direction<2>::upper_eta()}};
+
+  Element<2>::Neighbors_t neighbors{};
+  db::item_type<normal_dot_fluxes_tag<2, comm_types>> normal_dot_fluxes{};
+  db::item_type<other_data_tag<2>> other_data{};
+  db::item_type<mortar_data_tag<comm_types>> mortar_history{};
+  db::item_type<mortar_next_temporal_ids_tag<2>> mortar_next_temporal_ids{};
+  db::item_type<mortar_meshes_tag<2>> mortar_meshes{};
+  db::item_type<mortar_sizes_tag<2>> mortar_sizes{};
+  for (size_t i = 0; i < 2; ++i) {
+    const auto& direction = gsl::at(directions, i);
+    const auto mortar_id = std::make_pair(direction, gsl::at(neighbor_ids, i));
+    neighbors.insert({direction, {{mortar_id.second}, {}}});
+    normal_dot_fluxes[direction].initialize(3, 1. + i);
+    other_data[direction].initialize(3, 3. + i);
+    mortar_history.insert({mortar_id, {}});
+    mortar_next_temporal_ids.insert({mortar_id, 0});
+    mortar_meshes.insert({mortar_id, mesh.slice_away(0)});
+    mortar_sizes.insert({mortar_id, {{Spectral::MortarSize::Full}}});
+  }
+
+  tuples::get<MockDistributedObjectsTag>(*dist_objects)
+      .emplace(
+          self_id,
+          db::create<typename my_component::simple_tags,
+                     typename my_component::compute_tags>(
+              0, 1, mesh, Element<2>(self_id, std::move(neighbors)),
+              ElementMap<2, Frame::Inertial>(
+                  self_id,
+                  make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+                      CoordinateMaps::ProductOf2Maps<CoordinateMaps::Affine,
+                                                     CoordinateMaps::Affine>(
+                          {-1., 1., 3., 7.}, {-1., 1., -2., 4.}))),
+              std::move(normal_dot_fluxes), std::move(other_data),
+              std::move(mortar_history), std::move(mortar_next_temporal_ids),
+              std::move(mortar_meshes), std::move(mortar_sizes)));
+  for (const auto& neighbor_id : neighbor_ids) {
+    tuples::get<MockDistributedObjectsTag>(*dist_objects)
+        .emplace(neighbor_id,
+                 db::create<typename my_component::simple_tags,
+                            typename my_component::compute_tags>(
+                     0, 1, mesh, Element<2>(neighbor_id, {}),
+                     ElementMap<2, Frame::Inertial>{},
+                     db::item_type<normal_dot_fluxes_tag<2, comm_types>>{},
+                     db::item_type<other_data_tag<2>>{},
+                     db::item_type<mortar_data_tag<comm_types>>{},
+                     db::item_type<mortar_next_temporal_ids_tag<2>>{},
+                     db::item_type<mortar_meshes_tag<2>>{},
+                     db::item_type<mortar_sizes_tag<2>>{}));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE(
+    "Unit.DiscontinuousGalerkin.Actions.FluxCommunication.Aggregated",
+    "[Unit][NumericalAlgorithms][Actions]") {
+  const ElementId<2> self_id(1);
+  const std::array<ElementId<2>, 2> neighbor_ids{
+      {ElementId<2>(2), ElementId<2>(3)}};
+
+  // The inboxes of the neighbors when the data is sent directly
+  using direct_component = component<2, Metavariables<2>>;
+  using DirectRuntimeSystem =
+      ActionTesting::MockRuntimeSystem<Metavariables<2>>;
+  DirectRuntimeSystem::TupleOfMockDistributedObjects direct_objects{};
+  add_elements<Metavariables<2>>(make_not_null(&direct_objects), self_id,
+                                 neighbor_ids);
+  DirectRuntimeSystem direct_runner{{NumericalFlux<2>{}},
+                                    std::move(direct_objects)};
+  direct_runner.next_action<direct_component>(self_id);
+  CHECK(direct_runner.nonempty_inboxes<direct_component,
+                                       fluxes_tag<flux_comm_types<2>>>() ==
+        std::unordered_set<ElementIndex<2>>(neighbor_ids.begin(),
+                                            neighbor_ids.end()));
+
+  using my_component = component<2, AggregatingMetavariables>;
+  using my_aggregator = aggregator_component<AggregatingMetavariables>;
+  using comm_types = my_component::flux_comm_types;
+  using MockRuntimeSystem =
+      ActionTesting::MockRuntimeSystem<AggregatingMetavariables>;
+  for (const size_t max_messages : {1, 2, 3}) {
+    INFO("Maximum number of messages " << max_messages);
+    MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+    add_elements<AggregatingMetavariables>(make_not_null(&dist_objects),
+                                           self_id, neighbor_ids);
+    for (const int proc : {0, 1}) {
+      tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_aggregator>>(
+          dist_objects)
+          .emplace(proc,
+                   ActionTesting::MockDistributedObject<my_aggregator>{});
+    }
+    MockRuntimeSystem runner{{NumericalFlux<2>{}, max_messages},
+                             std::move(dist_objects)};
+    for (const auto& neighbor_id : neighbor_ids) {
+      runner.algorithms<my_component>().at(neighbor_id).set_processor(1);
+    }
+    // Each aggregator is the local branch of the group on its processor
+    runner.algorithms<my_aggregator>().at(1).set_processor(1);
+    for (const int proc : {0, 1}) {
+      runner.simple_action<
+          my_aggregator,
+          dg::Actions::InitializeFluxAggregator<AggregatingMetavariables>>(
+          proc);
+    }
+
+    runner.next_action<my_component>(self_id);
+    // The data is handed to the aggregator on the processor of the element
+    CHECK(runner.nonempty_inboxes<my_component, fluxes_tag<comm_types>>()
+              .empty());
+    CHECK(runner.is_simple_action_queue_empty<my_aggregator>(1));
+    runner.invoke_queued_simple_action<my_aggregator>(0);
+    runner.invoke_queued_simple_action<my_aggregator>(0);
+    while (not runner.is_simple_action_queue_empty<my_aggregator>(0)) {
+      runner.invoke_queued_simple_action<my_aggregator>(0);
+    }
+    const auto& counters = db::get<dg::Tags::FluxAggregationCounters>(
+        runner.algorithms<my_aggregator>()
+            .at(0)
+            .get_databox<my_aggregator::initial_databox>());
+    CHECK(counters.number_of_messages == 2);
+    CHECK(counters.number_of_batches == (max_messages == 1 ? 2 : 1));
+
+    while (not runner.is_simple_action_queue_empty<my_aggregator>(1)) {
+      runner.invoke_queued_simple_action<my_aggregator>(1);
+    }
+    for (const auto& neighbor_id : neighbor_ids) {
+      CHECK(tuples::get<fluxes_tag<comm_types>>(
+                runner.inboxes<my_component>().at(neighbor_id)) ==
+            tuples::get<fluxes_tag<flux_comm_types<2>>>(
+                direct_runner.inboxes<direct_component>().at(neighbor_id)));
+    }
+  }
+}
+
+namespace {
+// Adds the elements `left_id` and `right_id`, which are neighbors in the xi
+// direction, to `dist_objects`
+template <typename Metavariables>
+void add_element_pair(
+    const gsl::not_null<typename ActionTesting::MockRuntimeSystem<
+        Metavariables>::TupleOfMockDistributedObjects*>
+        dist_objects,
+    const ElementId<2>& left_id, const ElementId<2>& right_id) noexcept {
+  using my_component = component<2, Metavariables>;
+  using comm_types = typename my_component::flux_comm_types;
+  using MockDistributedObjectsTag = typename ActionTesting::MockRuntimeSystem<
+      Metavariables>::template MockDistributedObjectsTag<my_component>;
+  const Mesh<2> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+
+  const auto add_element = [&dist_objects, &mesh ](
+      const ElementId<2>& id, const Direction<2>& direction,
+      const ElementId<2>& neighbor_id, const double lower_x,
+      const double value) noexcept {
+    const auto mortar_id = std::make_pair(direction, neighbor_id);
+    db::item_type<normal_dot_fluxes_tag<2, comm_types>> normal_dot_fluxes{};
+    normal_dot_fluxes[direction].initialize(3, value);
+    db::item_type<other_data_tag<2>> other_data{};
+    other_data[direction].initialize(3, 2. * value);
+
+    tuples::get<MockDistributedObjectsTag>(*dist_objects)
+        .emplace(
+            id,
+            db::create<typename my_component::simple_tags,
+                       typename my_component::compute_tags>(
+                0, 1, mesh,
+                Element<2>(id, {{direction, {{neighbor_id}, {}}}}),
+                ElementMap<2, Frame::Inertial>(
+                    id,
+                    make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+                        CoordinateMaps::ProductOf2Maps<CoordinateMaps::Affine,
+                                                       CoordinateMaps::Affine>(
+                            {-1., 1., lower_x, lower_x + 2.},
+                            {-1., 1., -2., 4.}))),
+                std::move(normal_dot_fluxes), std::move(other_data),
+                db::item_type<mortar_data_tag<comm_types>>{{mortar_id, {}}},
+                db::item_type<mortar_next_temporal_ids_tag<2>>{
+                    {mortar_id, 0}},
+                db::item_type<mortar_meshes_tag<2>>{
+                    {mortar_id, mesh.slice_away(0)}},
+                db::item_type<mortar_sizes_tag<2>>{
+                    {mortar_id, {{Spectral::MortarSize::Full}}}}));
+  };
+  add_element(left_id, Direction<2>::upper_xi(), right_id, 0., 1.);
+  add_element(right_id, Direction<2>::lower_xi(), left_id, 2., 5.);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE(
+    "Unit.DiscontinuousGalerkin.Actions.FluxCommunication.ProcessorLocal",
+    "[Unit][NumericalAlgorithms][Actions]") {
+  const ElementId<2> left_id(1);
+  const ElementId<2> right_id(2);
+  const std::array<std::pair<Direction<2>, ElementId<2>>, 2> mortar_ids{
+      {std::make_pair(Direction<2>::upper_xi(), right_id),
+       std::make_pair(Direction<2>::lower_xi(), left_id)}};
+  const std::array<ElementId<2>, 2> ids{{left_id, right_id}};
+
+  // The mortar data when the data is sent directly
+  using direct_component = component<2, Metavariables<2>>;
+  using DirectRuntimeSystem =
+      ActionTesting::MockRuntimeSystem<Metavariables<2>>;
+  DirectRuntimeSystem::TupleOfMockDistributedObjects direct_objects{};
+  add_element_pair<Metavariables<2>>(make_not_null(&direct_objects), left_id,
+                                     right_id);
+  DirectRuntimeSystem direct_runner{{NumericalFlux<2>{}},
+                                    std::move(direct_objects)};
+  for (const auto& id : ids) {
+    direct_runner.next_action<direct_component>(id);
+  }
+  for (const auto& id : ids) {
+    CHECK(direct_runner.is_ready<direct_component>(id));
+    direct_runner.next_action<direct_component>(id);
+  }
+
+  // All elements are on this processor, so the data is passed through the
+  // processor-local buffer
+  using my_component = component<2, AggregatingMetavariables>;
+  using my_aggregator = aggregator_component<AggregatingMetavariables>;
+  using comm_types = my_component::flux_comm_types;
+  using local_buffer =
+      dg::ProcessorLocalFluxBuffer<fluxes_tag<comm_types>, 2>;
+  using MockRuntimeSystem =
+      ActionTesting::MockRuntimeSystem<AggregatingMetavariables>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  add_element_pair<AggregatingMetavariables>(make_not_null(&dist_objects),
+                                             left_id, right_id);
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_aggregator>>(
+      dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<my_aggregator>{});
+  MockRuntimeSystem runner{{NumericalFlux<2>{}, size_t{64}},
+                           std::move(dist_objects)};
+  runner.simple_action<
+      my_aggregator,
+      dg::Actions::InitializeFluxAggregator<AggregatingMetavariables>>(0);
+
+  for (size_t i = 0; i < 2; ++i) {
+    // The data is inserted right away without going through the aggregator
+    runner.next_action<my_component>(gsl::at(ids, i));
+    CHECK(runner.is_simple_action_queue_empty<my_aggregator>(0));
+    CHECK(local_buffer::instance().size() == i + 1);
+    // The receiver only gets a notification without the data
+    const auto& inbox = tuples::get<fluxes_tag<comm_types>>(
+        runner.inboxes<my_component>().at(gsl::at(ids, 1 - i)));
+    CHECK(inbox.at(0).at(gsl::at(mortar_ids, 1 - i)).first == 1);
+    CHECK(inbox.at(0)
+              .at(gsl::at(mortar_ids, 1 - i))
+              .second.number_of_grid_points() == 0);
+  }
+  CHECK(db::get<dg::Tags::FluxAggregationCounters>(
+            runner.algorithms<my_aggregator>()
+                .at(0)
+                .get_databox<my_aggregator::initial_databox>())
+            .number_of_messages == 0);
+
+  for (size_t i = 0; i < 2; ++i) {
+    const auto& id = gsl::at(ids, i);
+    const auto& mortar_id = gsl::at(mortar_ids, i);
+    CHECK(runner.is_ready<my_component>(id));
+    runner.next_action<my_component>(id);
+    CHECK(tuples::get<fluxes_tag<comm_types>>(
+              runner.inboxes<my_component>().at(id))
+              .empty());
+
+    auto mortar_data = db::get<mortar_data_tag<comm_types>>(
+                           runner.algorithms<my_component>()
+                               .at(id)
+                               .get_databox<my_component::initial_databox>())
+                           .at(mortar_id);
+    auto direct_mortar_data =
+        db::get<mortar_data_tag<flux_comm_types<2>>>(
+            direct_runner.algorithms<direct_component>()
+                .at(id)
+                .get_databox<direct_component::initial_databox>())
+            .at(mortar_id);
+    const auto result = mortar_data.extract();
+    const auto direct_result = direct_mortar_data.extract();
+    CHECK(result.first.mortar_data == direct_result.first.mortar_data);
+    CHECK(result.first.magnitude_of_face_normal ==
+          direct_result.first.magnitude_of_face_normal);
+    CHECK(result.second == direct_result.second);
+    CHECK(result.second.number_of_grid_points() == 3);
+  }
+  CHECK(local_buffer::instance().size() == 0);
+}
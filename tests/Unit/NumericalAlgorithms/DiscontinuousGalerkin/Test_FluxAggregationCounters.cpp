@@ -0,0 +1,26 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <string>
+
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregationCounters.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.FluxAggregationCounters",
+                  "[Unit][NumericalAlgorithms]") {
+  dg::FluxAggregationCounters counters{};
+  CHECK(counters.number_of_messages == 0);
+  CHECK(counters.number_of_batches == 0);
+  CHECK(counters.number_of_bytes == 0);
+  test_serialization(counters);
+
+  counters.number_of_messages = 12;
+  counters.number_of_batches = 3;
+  counters.number_of_bytes = 4096;
+  CHECK(counters != dg::FluxAggregationCounters{});
+  CHECK(get_output(counters) == "12 messages in 3 batches of 4096 bytes");
+  test_serialization(counters);
+}
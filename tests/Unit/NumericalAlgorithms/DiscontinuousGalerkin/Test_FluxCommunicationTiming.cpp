@@ -0,0 +1,36 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cmath>
+#include <string>
+
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTiming.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.FluxCommunicationTiming",
+                  "[Unit][NumericalAlgorithms]") {
+  dg::FluxCommunicationTiming timing{};
+  // The unset time stamps are quiet NaNs, so checking them does not raise a
+  // floating point exception.
+  CHECK(std::isnan(timing.send_time));
+  CHECK(std::isnan(timing.overlapped_work_end_time));
+  CHECK(timing.number_of_exchanges == 0);
+  // No time was spent communicating, so nothing had to be overlapped
+  CHECK(timing.overlap_fraction() == 1.0);
+  test_serialization(timing);
+
+  timing.overlapped_time = 3.0;
+  timing.waiting_time = 1.0;
+  timing.number_of_exchanges = 2;
+  CHECK(timing.overlap_fraction() == approx(0.75));
+  CHECK(timing != dg::FluxCommunicationTiming{});
+  CHECK(get_output(timing) ==
+        "2 exchanges, 3s overlapped, 1s waiting (75% overlap)");
+  test_serialization(timing);
+
+  timing.overlapped_time = 0.0;
+  CHECK(timing.overlap_fraction() == 0.0);
+}
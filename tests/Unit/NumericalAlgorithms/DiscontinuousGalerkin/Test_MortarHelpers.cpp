@@ -14,6 +14,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "DataStructures/VariablesHelpers.hpp"
 #include "Domain/Direction.hpp"
 #include "Domain/ElementId.hpp"
 #include "Domain/LogicalCoordinates.hpp"
@@ -439,3 +440,55 @@ SPECTRE_TEST_CASE("Unit.DG.MortarHelpers.compute_boundary_flux_contribution",
     CHECK_ITERABLE_APPROX(get<Var>(unrefined_result), get<Var>(refined_result));
   }
 }
+
+SPECTRE_TEST_CASE("Unit.DG.MortarHelpers.project_and_orient_to_mortar",
+                  "[Unit][NumericalAlgorithms]") {
+  using Spectral::MortarSize;
+  const auto all_mortar_sizes = {MortarSize::Full, MortarSize::LowerHalf,
+                                 MortarSize::UpperHalf};
+  const size_t sliced_dim = 0;
+  const auto mortar_mesh = lgl_mesh<2>({{4, 5}});
+  const OrientationMap<3> aligned{};
+  const OrientationMap<3> rotated{{{Direction<3>::upper_eta(),
+                                    Direction<3>::upper_zeta(),
+                                    Direction<3>::lower_xi()}}};
+  // The buffers are reused to check that they are resized as needed
+  Variables<tmpl::list<Var>> oriented_vars{};
+  Variables<tmpl::list<Var>> projection_buffer{};
+  for (const auto& face_mesh : {mortar_mesh, lgl_mesh<2>({{3, 5}})}) {
+    CAPTURE(face_mesh);
+    Variables<tmpl::list<Var>> vars(face_mesh.number_of_grid_points());
+    const auto face_coords = logical_coordinates(face_mesh);
+    get(get<Var>(vars)) =
+        square(get<0>(face_coords)) + 2. * get<1>(face_coords);
+    for (const auto& slice_size0 : all_mortar_sizes) {
+      for (const auto& slice_size1 : all_mortar_sizes) {
+        const std::array<MortarSize, 2> mortar_size{
+            {slice_size0, slice_size1}};
+        CAPTURE(mortar_size);
+        const bool projected = face_mesh != mortar_mesh or
+                               slice_size0 != MortarSize::Full or
+                               slice_size1 != MortarSize::Full;
+        CHECK(dg::needs_projection(face_mesh, mortar_mesh, mortar_size) ==
+              projected);
+        const auto expected_mortar_vars =
+            dg::project_to_mortar(vars, face_mesh, mortar_mesh, mortar_size);
+        for (const auto& orientation : {aligned, rotated}) {
+          CAPTURE(orientation);
+          const auto& mortar_vars = dg::project_and_orient_to_mortar(
+              make_not_null(&oriented_vars), make_not_null(&projection_buffer),
+              vars, face_mesh, mortar_mesh, mortar_size, sliced_dim,
+              orientation);
+          CHECK_ITERABLE_APPROX(get<Var>(mortar_vars),
+                                get<Var>(expected_mortar_vars));
+          CHECK((&mortar_vars == &vars) == not projected);
+          CHECK_ITERABLE_APPROX(
+              get<Var>(oriented_vars),
+              get<Var>(orient_variables_on_slice(expected_mortar_vars,
+                                                 mortar_mesh.extents(),
+                                                 sliced_dim, orientation)));
+        }
+      }
+    }
+  }
+}
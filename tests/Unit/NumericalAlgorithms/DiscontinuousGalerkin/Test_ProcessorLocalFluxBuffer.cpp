@@ -0,0 +1,83 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Direction.hpp"
+#include "Domain/ElementId.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/ProcessorLocalFluxBuffer.hpp"
+#include "Utilities/TMPL.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+
+namespace {
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = Scalar<DataVector>;
+};
+
+using PackagedData = Variables<tmpl::list<Var>>;
+
+struct FluxesTag {
+  using temporal_id = int;
+  using type = std::map<
+      int, std::unordered_map<
+               std::pair<Direction<2>, ElementId<2>>,
+               std::pair<int, PackagedData>,
+               boost::hash<std::pair<Direction<2>, ElementId<2>>>>>;
+};
+
+PackagedData make_data(const double value) noexcept {
+  PackagedData data(3);
+  get(get<Var>(data)) = value;
+  return data;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.ProcessorLocalFluxBuffer",
+                  "[Unit][NumericalAlgorithms]") {
+  using Buffer = dg::ProcessorLocalFluxBuffer<FluxesTag, 2>;
+  auto& buffer = Buffer::instance();
+  CHECK(&buffer == &Buffer::instance());
+  CHECK(buffer.size() == 0);
+
+  const ElementId<2> receiver(0);
+  const ElementId<2> other_receiver(1);
+  const auto lower_mortar =
+      std::make_pair(Direction<2>::lower_xi(), ElementId<2>(2));
+  const auto upper_mortar =
+      std::make_pair(Direction<2>::upper_xi(), ElementId<2>(3));
+
+  buffer.insert(receiver, lower_mortar, 0, make_data(1.0));
+  buffer.insert(receiver, upper_mortar, 0, make_data(2.0));
+  buffer.insert(receiver, lower_mortar, 1, make_data(3.0));
+  buffer.insert(other_receiver, lower_mortar, 0, make_data(4.0));
+  CHECK(buffer.size() == 4);
+
+  CHECK(buffer.extract(receiver, upper_mortar, 0) == make_data(2.0));
+  CHECK(buffer.extract(other_receiver, lower_mortar, 0) == make_data(4.0));
+  CHECK(buffer.extract(receiver, lower_mortar, 1) == make_data(3.0));
+  CHECK(buffer.size() == 1);
+  CHECK(buffer.extract(receiver, lower_mortar, 0) == make_data(1.0));
+  CHECK(buffer.size() == 0);
+}
+
+// [[OutputRegex, No data for mortar]]
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.ProcessorLocalFluxBuffer.Missing",
+                  "[Unit][NumericalAlgorithms]") {
+  ERROR_TEST();
+  const auto mortar_id =
+      std::make_pair(Direction<2>::lower_xi(), ElementId<2>(2));
+  dg::ProcessorLocalFluxBuffer<FluxesTag, 2>::instance().extract(
+      ElementId<2>(0), mortar_id, 0);
+}
@@ -33,6 +33,7 @@
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolationTarget.hpp"
 #include "NumericalAlgorithms/Interpolation/InitializeInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolatorReceivePoints.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/InterpolatorReceiveVolumeData.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/InterpolatorRegisterElement.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Interpolation/TryToInterpolate.hpp"
@@ -40,6 +41,7 @@
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Slab.hpp"
 #include "Time/Time.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
@@ -228,7 +230,7 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
   const auto domain = domain_creator.create_domain();
   Slab slab(0.0, 1.0);
   Time temporal_id(slab, Rational(11, 15));
-  auto vars_holders = [&domain, &temporal_id]() {
+  const auto target_points = []() noexcept {
     const size_t n_pts = 15;
     tnsr::I<DataVector, 3, Frame::Inertial> points(n_pts);
     for (size_t d = 0; d < 3; ++d) {
@@ -236,7 +238,10 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
         points.get(d)[i] = 1.0 + (0.1 + 0.02 * d) * i;  // Chosen by hand.
       }
     }
-    auto coords = block_logical_coordinates(domain, points);
+    return points;
+  }();
+  auto vars_holders = [&domain, &target_points, &temporal_id]() {
+    auto coords = block_logical_coordinates(domain, target_points);
     db::item_type<intrp::Tags::InterpolatedVarsHolders<metavars, 3>>
         vars_holders_l{};
     auto& vars_infos =
@@ -297,29 +302,35 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
   }
 
   // Create volume data and send it to the interpolator.
-  for (const auto& element_id : element_ids) {
-    const auto& block = domain.blocks()[element_id.block_id()];
-    ::Mesh<3> mesh{domain_creator.initial_extents()[element_id.block_id()],
-                   Spectral::Basis::Legendre,
-                   Spectral::Quadrature::GaussLobatto};
-    ElementMap<3, Frame::Inertial> map{element_id,
-                                       block.coordinate_map().get_clone()};
-    const auto inertial_coords = map(logical_coordinates(mesh));
-    db::item_type<
-        ::Tags::Variables<typename metavars::interpolator_source_vars>>
-        output_vars(mesh.number_of_grid_points());
-    auto& lapse = get<gr::Tags::Lapse<DataVector>>(output_vars);
+  const auto send_volume_data = [&domain, &domain_creator, &element_ids,
+                                 &runner](const Time& time) noexcept {
+    for (const auto& element_id : element_ids) {
+      const auto& block = domain.blocks()[element_id.block_id()];
+      ::Mesh<3> mesh{domain_creator.initial_extents()[element_id.block_id()],
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+      ElementMap<3, Frame::Inertial> map{element_id,
+                                         block.coordinate_map().get_clone()};
+      const auto inertial_coords = map(logical_coordinates(mesh));
+      db::item_type<
+          ::Tags::Variables<typename metavars::interpolator_source_vars>>
+          output_vars(mesh.number_of_grid_points());
+      auto& lapse = get<gr::Tags::Lapse<DataVector>>(output_vars);
 
-    // Fill lapse with some analytic solution.
-    get<>(lapse) = 2.0 * get<0>(inertial_coords) +
-                   3.0 * get<1>(inertial_coords) +
-                   5.0 * get<2>(inertial_coords);
+      // Fill lapse with some analytic solution.
+      get<>(lapse) = 2.0 * get<0>(inertial_coords) +
+                     3.0 * get<1>(inertial_coords) +
+                     5.0 * get<2>(inertial_coords);
 
-    // Call the action on each element_id.
-    runner.simple_action<mock_interpolator<metavars, 3>,
-                         ::intrp::Actions::InterpolatorReceiveVolumeData>(
-        0, temporal_id, element_id, mesh, std::move(output_vars));
-  }
+      // Call the action on each element_id.
+      runner.simple_action<mock_interpolator<metavars, 3>,
+                           ::intrp::Actions::InterpolatorReceiveVolumeData>(
+          0, time, element_id, mesh, std::move(output_vars));
+    }
+  };
+  const size_t number_of_interpolants_built_before =
+      intrp::interpolator_detail::number_of_interpolants_built();
+  send_volume_data(temporal_id);
 
   // Should be no temporal_ids in the target box, since we never
   // put any there.
@@ -339,5 +350,66 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Interpolator.ReceiveVolumeData",
   CHECK(runner.is_simple_action_queue_empty<
         mock_interpolation_target<metavars, metavars::InterpolationTargetA>>(
       0));
+
+  // The interpolants of the elements that contain points are kept for later
+  // temporal_ids.
+  auto& box_interpolator =
+      runner.template algorithms<mock_interpolator<metavars, 3>>()
+          .at(0)
+          .template get_databox<
+              typename mock_interpolator<metavars, 3>::initial_databox>();
+  const auto& cached_interpolants =
+      get<intrp::Vars::HolderTag<metavars::InterpolationTargetA, metavars, 3>>(
+          db::get<intrp::Tags::InterpolatedVarsHolders<metavars, 3>>(
+              box_interpolator))
+          .cached_interpolants;
+  size_t number_of_cached_points = 0;
+  for (const auto& element_and_interpolant : cached_interpolants) {
+    number_of_cached_points +=
+        get<0>(element_and_interpolant.second.element_logical_coords).size();
+  }
+  CHECK(number_of_cached_points == 15);
+  const size_t number_of_cached_interpolants = cached_interpolants.size();
+  CHECK(intrp::interpolator_detail::number_of_interpolants_built() ==
+        number_of_interpolants_built_before + number_of_cached_interpolants);
+
+  // Add an interpolant for an element that contains none of the points, as
+  // if the points had been in that element at an earlier temporal_id.
+  const auto element_without_points =
+      alg::find_if(element_ids, [&cached_interpolants](
+                                    const ElementId<3>& element_id) noexcept {
+        return cached_interpolants.count(element_id) == 0;
+      });
+  REQUIRE(element_without_points != element_ids.end());
+  db::mutate<intrp::Tags::InterpolatedVarsHolders<metavars, 3>>(
+      make_not_null(&box_interpolator),
+      [&element_without_points](
+          const gsl::not_null<db::item_type<
+              intrp::Tags::InterpolatedVarsHolders<metavars, 3>>*>
+              holders) noexcept {
+        get<intrp::Vars::HolderTag<metavars::InterpolationTargetA, metavars,
+                                   3>>(*holders)
+            .cached_interpolants[*element_without_points] = {};
+      });
+
+  // Interpolating onto the same points at a later temporal_id reuses the
+  // interpolants, since the meshes of the elements are unchanged. The
+  // interpolant of the element without points is dropped.
+  const Time later_temporal_id(slab, Rational(12, 15));
+  runner.simple_action<
+      mock_interpolator<metavars, 3>,
+      intrp::Actions::ReceivePoints<metavars::InterpolationTargetA>>(
+      0, later_temporal_id,
+      block_logical_coordinates(domain, target_points));
+  send_volume_data(later_temporal_id);
+  runner.invoke_queued_simple_action<
+      mock_interpolation_target<metavars, metavars::InterpolationTargetA>>(0);
+  CHECK(runner.is_simple_action_queue_empty<
+        mock_interpolation_target<metavars, metavars::InterpolationTargetA>>(
+      0));
+  CHECK(intrp::interpolator_detail::number_of_interpolants_built() ==
+        number_of_interpolants_built_before + number_of_cached_interpolants);
+  CHECK(cached_interpolants.size() == number_of_cached_interpolants);
+  CHECK(cached_interpolants.count(*element_without_points) == 0);
 }
 }  // namespace
@@ -19,7 +19,9 @@
 #include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -139,6 +141,63 @@ void test_interpolation() noexcept {
     }
   }
 }
+
+// Meshes with more than max_sum_factorization_extent points in some
+// dimension use the BLAS and transpose implementation.
+void test_large_extents() noexcept {
+  constexpr size_t large_extent =
+      apply_matrices_detail::max_sum_factorization_extent + 2;
+  CheckApply<1>::apply(Mesh<1>{large_extent, basis, quadrature},
+                       Mesh<1>{large_extent - 1, basis, quadrature},
+                       Index<1>{5});
+  CheckApply<2>::apply(
+      Mesh<2>{{{large_extent, 3}}, basis, quadrature},
+      Mesh<2>{{{4, 4}}, basis, quadrature}, Index<2>{3, 2});
+  CheckApply<3>::apply(
+      Mesh<3>{{{3, large_extent, 2}}, basis, quadrature},
+      Mesh<3>{{{2, 3, large_extent}}, basis, quadrature}, Index<3>{1, 2, 1});
+}
+
+template <size_t Dim>
+void test_sum_factorization_matches_blas(
+    const std::array<size_t, Dim>& source_extents,
+    const std::array<size_t, Dim>& dest_extents) noexcept {
+  CAPTURE(source_extents);
+  CAPTURE(dest_extents);
+  const Index<Dim> extents(source_extents);
+  constexpr size_t number_of_independent_components = 3;
+  DataVector data(number_of_independent_components * extents.product());
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = 0.1 * static_cast<double>((7 * i) % 23) - 1.0;
+  }
+  std::array<Matrix, Dim> matrices{};
+  size_t result_points = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    result_points *= gsl::at(dest_extents, d);
+    if (gsl::at(dest_extents, d) == gsl::at(source_extents, d)) {
+      // Leave as the implicit identity.
+      continue;
+    }
+    gsl::at(matrices, d) =
+        Matrix(gsl::at(dest_extents, d), gsl::at(source_extents, d));
+    for (size_t i = 0; i < gsl::at(dest_extents, d); ++i) {
+      for (size_t j = 0; j < gsl::at(source_extents, d); ++j) {
+        gsl::at(matrices, d)(i, j) =
+            0.3 * static_cast<double>(i) - 0.2 * static_cast<double>(j + d);
+      }
+    }
+  }
+  REQUIRE(apply_matrices_detail::use_sum_factorization(matrices, extents));
+  DataVector blas_result(number_of_independent_components * result_points);
+  DataVector sum_factorized_result(blas_result.size());
+  apply_matrices_detail::Impl<Dim>::apply(blas_result.data(), matrices,
+                                          data.data(), extents,
+                                          number_of_independent_components);
+  apply_matrices_detail::sum_factorized_apply(
+      sum_factorized_result.data(), matrices, data.data(), extents,
+      number_of_independent_components);
+  CHECK_ITERABLE_APPROX(sum_factorized_result, blas_result);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.ApplyMatrices",
@@ -146,6 +205,14 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.ApplyMatrices",
   test_interpolation<1>();
   test_interpolation<2>();
   test_interpolation<3>();
+  test_large_extents();
+
+  test_sum_factorization_matches_blas<1>({{16}}, {{1}});
+  test_sum_factorization_matches_blas<2>({{1, 16}}, {{16, 7}});
+  test_sum_factorization_matches_blas<2>({{5, 9}}, {{5, 12}});
+  test_sum_factorization_matches_blas<3>({{12, 4, 7}}, {{9, 11, 7}});
+  test_sum_factorization_matches_blas<3>({{6, 6, 6}}, {{6, 13, 6}});
+  test_sum_factorization_matches_blas<3>({{8, 8, 8}}, {{8, 8, 8}});
 
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
@@ -6,10 +6,13 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <pup.h>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
@@ -30,6 +33,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/ScratchArena.hpp"
 #include "Utilities/TMPL.hpp"
 // IWYU pragma: no_forward_declare Tags::deriv
 // IWYU pragma: no_forward_declare Variables
@@ -395,6 +399,15 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
                                           inverse_jacobian);
         helper(du);
 
+        // Once the scratch arena has grown, recomputing into existing
+        // storage does not allocate.
+        const auto& arena = ScratchArena::thread_local_instance();
+        const size_t heap_allocations = arena.number_of_heap_allocations();
+        partial_derivatives<GradientTags>(make_not_null(&du), u, mesh,
+                                          inverse_jacobian);
+        helper(du);
+        CHECK(arena.number_of_heap_allocations() == heap_allocations);
+
         vars_type du_with_logical{};
         partial_derivatives<GradientTags>(
             make_not_null(&du_with_logical),
@@ -405,6 +418,64 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+template <size_t Dim, typename VariableTags, typename GradientTags>
+void test_batched_partial_derivatives(const Mesh<Dim>& mesh) {
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const size_t number_of_elements = 3;
+  const auto logical_x = logical_coordinates(mesh);
+  using deriv_vars_type = Variables<db::wrap_tags_in<
+      Tags::deriv, GradientTags, tmpl::size_t<Dim>, Frame::Grid>>;
+
+  std::vector<Variables<VariableTags>> u{};
+  std::vector<InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Grid>>
+      inverse_jacobians{};
+  for (size_t element = 0; element < number_of_elements; ++element) {
+    tnsr::I<DataVector, Dim, Frame::Grid> x(number_of_grid_points);
+    InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Grid>
+        inverse_jacobian(number_of_grid_points, 0.0);
+    for (size_t d = 0; d < Dim; ++d) {
+      x.get(d) = 0.5 * (element + d + 1.0) * logical_x.get(d) + element;
+      inverse_jacobian.get(d, d) = 2.0 / (element + d + 1.0);
+    }
+    u.emplace_back(number_of_grid_points);
+    tmpl::for_each<VariableTags>([&x, &u ](auto tag) noexcept {
+      using Tag = typename decltype(tag)::type;
+      get<Tag>(u.back()) = Tag::f(make_array<Dim>(size_t{2}), x);
+    });
+    inverse_jacobians.push_back(std::move(inverse_jacobian));
+  }
+
+  // The results of the first element start out with the wrong size to
+  // check that they are resized.
+  std::vector<deriv_vars_type> batched_du(number_of_elements,
+                                          deriv_vars_type{});
+  for (size_t element = 1; element < number_of_elements; ++element) {
+    batched_du[element].initialize(number_of_grid_points);
+  }
+  std::vector<gsl::not_null<deriv_vars_type*>> du_pointers{};
+  std::vector<std::reference_wrapper<const Variables<VariableTags>>> u_refs{};
+  std::vector<std::reference_wrapper<
+      const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Grid>>>
+      inverse_jacobian_refs{};
+  for (size_t element = 0; element < number_of_elements; ++element) {
+    du_pointers.emplace_back(&batched_du[element]);
+    u_refs.emplace_back(u[element]);
+    inverse_jacobian_refs.emplace_back(inverse_jacobians[element]);
+  }
+  batched_partial_derivatives<GradientTags>(du_pointers, u_refs, mesh,
+                                            inverse_jacobian_refs);
+
+  for (size_t element = 0; element < number_of_elements; ++element) {
+    const auto expected_du = partial_derivatives<GradientTags>(
+        u[element], mesh, inverse_jacobians[element]);
+    REQUIRE(batched_du[element].size() == expected_du.size());
+    for (size_t n = 0; n < expected_du.size(); ++n) {
+      CHECK(batched_du[element].data()[n] ==  // NOLINT
+            approx(expected_du.data()[n]));   // NOLINT
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.LogicalDerivs",
@@ -459,6 +530,14 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs",
   test_partial_derivatives_3d<two_vars<3>>(mesh_3d);
   test_partial_derivatives_3d<two_vars<3>, one_var<3>>(mesh_3d);
 
+  test_batched_partial_derivatives<1, two_vars<1>, one_var<1>>(mesh_1d);
+  test_batched_partial_derivatives<2, two_vars<2>, two_vars<2>>(mesh_2d);
+  test_batched_partial_derivatives<2, two_vars<2>, one_var<2>>(mesh_2d);
+  test_batched_partial_derivatives<3, two_vars<3>, two_vars<3>>(mesh_3d);
+  test_batched_partial_derivatives<3, two_vars<3>, one_var<3>>(
+      Mesh<3>{4, Spectral::Basis::Legendre,
+              Spectral::Quadrature::GaussLobatto});
+
   CHECK(Tags::deriv<Var1<3>, tmpl::size_t<3>, Frame::Grid>::name() ==
         "deriv(" + Var1<3>::name() + ")");
   CHECK(Tags::deriv<Tags::Variables<tmpl::list<Var1<3>>>, tmpl::size_t<3>,
@@ -98,6 +98,47 @@ SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.NewtonRaphson.DataVector",
   }
 }
 
+SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.NewtonRaphson.Vectorized",
+                  "[NumericalAlgorithms][RootFinding][Unit]") {
+  /// [vectorized_newton_raphson_root_find]
+  const size_t digits = 8;
+  const DataVector guess{1.6, 1.9, -1.6, -1.9};
+  const DataVector lower{sqrt(2.), sqrt(2.), -2., -3.};
+  const DataVector upper{2., 3., -sqrt(2.), -sqrt(2.)};
+  const DataVector constant{2., 4., 2., 4.};
+
+  const auto func_and_deriv_lambda =
+      [&constant](const DataVector& x) noexcept {
+    return std::make_pair(DataVector{constant - square(x)},
+                          DataVector{-2. * x});
+  };
+
+  const auto root = RootFinder::newton_raphson(func_and_deriv_lambda, guess,
+                                               lower, upper, digits);
+  /// [vectorized_newton_raphson_root_find]
+
+  // The vectorized solve takes the same steps as the pointwise solve.
+  const auto root_pointwise = RootFinder::newton_raphson(
+      [&constant](const double x, const size_t i) noexcept {
+        return std::make_pair(constant[i] - square(x), -2. * x);
+      },
+      guess, lower, upper, digits);
+  CHECK(root == root_pointwise);
+
+  const DataVector correct{sqrt(2.), 2., -sqrt(2.), -2.};
+  for (size_t i = 0; i < guess.size(); i++) {
+    CHECK(std::abs(root[i] - correct[i]) < 1.0 / std::pow(10, digits));
+  }
+
+  test_throw_exception(
+      [&func_and_deriv_lambda, &guess, &lower, &upper, &digits]() {
+        RootFinder::newton_raphson(func_and_deriv_lambda, guess, lower, upper,
+                                   digits, 2);
+      },
+      convergence_error(
+          "newton_raphson reached max iterations without converging"));
+}
+
 // [[OutputRegex, The desired accuracy of 100 base-10 digits must be smaller]]
 [[noreturn]] SPECTRE_TEST_CASE(
     "Unit.Numerical.RootFinding.NewtonRaphson.Digits.Double",
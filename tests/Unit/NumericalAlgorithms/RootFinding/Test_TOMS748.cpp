@@ -187,3 +187,48 @@ SPECTRE_TEST_CASE(
       },
       convergence_error("toms748 reached max iterations without converging"));
 }
+
+SPECTRE_TEST_CASE("Unit.Numerical.RootFinding.TOMS748.Vectorized",
+                  "[NumericalAlgorithms][RootFinding][Unit]") {
+  /// [vectorized_root_find]
+  const double abs_tol = 1e-15;
+  const double rel_tol = 1e-15;
+  const DataVector upper{2.0, 3.0, -sqrt(2.0) + abs_tol, -sqrt(2.0)};
+  const DataVector lower{sqrt(2.0) - abs_tol, sqrt(2.0), -2.0, -3.0};
+
+  const DataVector constant{2.0, 4.0, 2.0, 4.0};
+  const auto f_lambda = [&constant](const DataVector& x) noexcept {
+    return DataVector{constant - square(x)};
+  };
+
+  const auto root =
+      RootFinder::toms748(f_lambda, lower, upper, abs_tol, rel_tol);
+  /// [vectorized_root_find]
+
+  // The vectorized solve takes the same steps as the pointwise solve.
+  const auto root_pointwise = RootFinder::toms748(
+      [&constant](const double x, const size_t i) noexcept {
+        return constant[i] - square(x);
+      },
+      lower, upper, abs_tol, rel_tol);
+  CHECK(root == root_pointwise);
+
+  CHECK(std::abs(root[0] - sqrt(2.0)) < abs_tol);
+  CHECK(std::abs(root[1] - 2.0) < abs_tol);
+  CHECK(std::abs(root[2] + sqrt(2.0)) < abs_tol);
+  CHECK(std::abs(root[3] + 2.0) < abs_tol);
+
+  test_throw_exception(
+      [&f_lambda, &abs_tol, &rel_tol]() {
+        RootFinder::toms748(f_lambda, DataVector{0.0, 0.0, -1.0, -3.0},
+                            DataVector{2.0, 3.0, 1.0, -sqrt(2.0)}, abs_tol,
+                            rel_tol);
+      },
+      std::domain_error("Error in function RootFinder::toms748: Parameters a "
+                        "and b do not bracket the root: a="));
+  test_throw_exception(
+      [&f_lambda, &abs_tol, &rel_tol, &lower, &upper]() {
+        RootFinder::toms748(f_lambda, lower, upper, abs_tol, rel_tol, 2);
+      },
+      convergence_error("toms748 reached max iterations without converging"));
+}
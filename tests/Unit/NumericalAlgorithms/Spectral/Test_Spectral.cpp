@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <initializer_list>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Blas.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/Math.hpp"
 
 SPECTRE_TEST_CASE("Unit.Numerical.Spectral.streaming",
@@ -155,6 +157,114 @@ SPECTRE_TEST_CASE("Unit.Numerical.Spectral.LinearFilter",
 
 namespace {
 
+// Checks that `filter_matrix` multiplies the modes of a function by the
+// `filter_coefficient` of each mode number
+template <Spectral::Basis BasisType, Spectral::Quadrature QuadratureType,
+          typename FilterCoefficient>
+void check_modal_filter(const Matrix& filter_matrix, const size_t n,
+                        const FilterCoefficient& filter_coefficient) {
+  const auto& grid_points_to_spectral_matrix =
+      Spectral::grid_points_to_spectral_matrix<BasisType, QuadratureType>(n);
+  const DataVector u =
+      exp(Spectral::collocation_points<BasisType, QuadratureType>(n));
+  DataVector u_spectral(n);
+  dgemv_('N', n, n, 1.0, grid_points_to_spectral_matrix.data(), n, u.data(), 1,
+         0.0, u_spectral.data(), 1);
+  DataVector u_filtered(n);
+  dgemv_('N', n, n, 1.0, filter_matrix.data(), n, u.data(), 1, 0.0,
+         u_filtered.data(), 1);
+  DataVector u_filtered_spectral(n);
+  dgemv_('N', n, n, 1.0, grid_points_to_spectral_matrix.data(), n,
+         u_filtered.data(), 1, 0.0, u_filtered_spectral.data(), 1);
+  for (size_t s = 0; s < n; ++s) {
+    CHECK(u_filtered_spectral[s] ==
+          approx(filter_coefficient(s) * u_spectral[s]));
+  }
+}
+
+template <Spectral::Basis BasisType, Spectral::Quadrature QuadratureType>
+void test_heaviside_filter() {
+  for (size_t n = Spectral::minimum_number_of_points<BasisType, QuadratureType>;
+       n <= Spectral::maximum_number_of_points<BasisType>; n++) {
+    for (size_t modes_to_keep = 0; modes_to_keep <= n + 1; ++modes_to_keep) {
+      check_modal_filter<BasisType, QuadratureType>(
+          Spectral::heaviside_filter_matrix<BasisType, QuadratureType>(
+              n, modes_to_keep),
+          n, [modes_to_keep](const size_t s) {
+            return s < modes_to_keep ? 1.0 : 0.0;
+          });
+    }
+    CHECK_MATRIX_APPROX(
+        (Spectral::heaviside_filter_matrix<BasisType, QuadratureType>(n, 2)),
+        (Spectral::linear_filter_matrix<BasisType, QuadratureType>(n)));
+  }
+}
+
+template <Spectral::Basis BasisType, Spectral::Quadrature QuadratureType>
+void test_exponential_filter() {
+  for (size_t n = Spectral::minimum_number_of_points<BasisType, QuadratureType>;
+       n <= Spectral::maximum_number_of_points<BasisType>; n++) {
+    for (const double alpha : {0.0, 1.0, 36.0}) {
+      for (const size_t half_power : {1_st, 4_st, 16_st}) {
+        check_modal_filter<BasisType, QuadratureType>(
+            Spectral::exponential_filter_matrix<BasisType, QuadratureType>(
+                n, alpha, half_power),
+            n, [alpha, half_power, n](const size_t s) {
+              if (n == 1) {
+                return 1.0;
+              }
+              const double eta = static_cast<double>(s) / (n - 1);
+              return std::exp(-alpha * std::pow(eta, 2 * half_power));
+            });
+      }
+    }
+  }
+}
+
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.Spectral.ModalFilters",
+                  "[NumericalAlgorithms][Spectral][Unit]") {
+  SECTION("Legendre-Gauss") {
+    test_heaviside_filter<Spectral::Basis::Legendre,
+                          Spectral::Quadrature::Gauss>();
+    test_exponential_filter<Spectral::Basis::Legendre,
+                            Spectral::Quadrature::Gauss>();
+  }
+  SECTION("Legendre-Gauss-Lobatto") {
+    test_heaviside_filter<Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto>();
+    test_exponential_filter<Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto>();
+  }
+  SECTION("Chebyshev-Gauss") {
+    test_heaviside_filter<Spectral::Basis::Chebyshev,
+                          Spectral::Quadrature::Gauss>();
+    test_exponential_filter<Spectral::Basis::Chebyshev,
+                            Spectral::Quadrature::Gauss>();
+  }
+  SECTION("Chebyshev-Gauss-Lobatto") {
+    test_heaviside_filter<Spectral::Basis::Chebyshev,
+                          Spectral::Quadrature::GaussLobatto>();
+    test_exponential_filter<Spectral::Basis::Chebyshev,
+                            Spectral::Quadrature::GaussLobatto>();
+  }
+  SECTION("Mesh") {
+    const Mesh<1> mesh{5, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+    CHECK(Spectral::heaviside_filter_matrix(mesh, 3) ==
+          Spectral::heaviside_filter_matrix<Spectral::Basis::Legendre,
+                                            Spectral::Quadrature::GaussLobatto>(
+              5, 3));
+    CHECK(Spectral::exponential_filter_matrix(mesh, 36.0, 8) ==
+          Spectral::exponential_filter_matrix<
+              Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto>(
+              5, 36.0, 8));
+  }
+}
+
+namespace {
+
 template <Spectral::Basis BasisType, Spectral::Quadrature QuadratureType,
           typename Function>
 void test_exact_interpolation(const Function& max_poly_deg) {
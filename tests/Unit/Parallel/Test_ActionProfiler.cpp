@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "Parallel/ActionProfiler.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+namespace TestComponents {
+template <typename T>
+struct Component {};
+}  // namespace TestComponents
+
+namespace TestActions {
+struct ReceiveData {};
+template <typename T>
+struct Compute {};
+}  // namespace TestActions
+
+using component = TestComponents::Component<double>;
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ActionProfiler", "[Unit][Parallel]") {
+  Parallel::ActionProfile profile{3, 1.5, 0.25};
+  test_serialization(profile);
+  CHECK(profile != Parallel::ActionProfile{});
+  profile += Parallel::ActionProfile{1, 0.5, 0.75};
+  CHECK(profile == Parallel::ActionProfile{4, 2.0, 1.0});
+
+  // The ids are assigned once for each position in an action list
+  const size_t receive_id =
+      Parallel::action_profiler_id<component, 0, TestActions::ReceiveData>();
+  const size_t compute_id = Parallel::action_profiler_id<
+      component, 12, TestActions::Compute<int>>();
+  const size_t second_compute_id = Parallel::action_profiler_id<
+      component, 13, TestActions::Compute<int>>();
+  CHECK(receive_id ==
+        Parallel::action_profiler_id<component, 0, TestActions::ReceiveData>());
+  CHECK(receive_id != compute_id);
+  CHECK(compute_id != second_compute_id);
+
+  auto& profiler = Parallel::ActionProfiler::thread_local_instance();
+  profiler.reset();
+  CHECK(profiler.summary().empty());
+  profiler.record_call(receive_id, 1.0);
+  profiler.record_wait(receive_id, 3.0);
+  profiler.record_call(receive_id, 2.0);
+  profiler.record_call(compute_id, 0.5);
+  profiler.record_wait(second_compute_id, 0.25);
+
+  const std::map<std::string, Parallel::ActionProfile> expected_summary{
+      {"Component/00_ReceiveData", {2, 3.0, 3.0}},
+      {"Component/12_Compute", {1, 0.5, 0.0}},
+      {"Component/13_Compute", {0, 0.0, 0.25}}};
+  CHECK(profiler.summary() == expected_summary);
+  CHECK(&profiler == &Parallel::ActionProfiler::thread_local_instance());
+
+  profiler.reset();
+  CHECK(profiler.summary().empty());
+}
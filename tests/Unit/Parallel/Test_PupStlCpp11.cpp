@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <pup.h>
@@ -18,6 +19,7 @@
 
 #include "Parallel/CharmPupable.hpp"
 #include "Parallel/PupStlCpp11.hpp"
+#include "Parallel/Serialize.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 #include "tests/Unit/TestHelpers.hpp"
@@ -118,6 +120,17 @@ SPECTRE_TEST_CASE("Unit.Serialization.unique_ptr.double",
   CHECK(3.8273 == *serialize_and_deserialize(test_unique_ptr));  // NOLINT
 }
 
+SPECTRE_TEST_CASE("Unit.Serialization.atomic", "[Serialization][Unit]") {
+  // std::atomic can be neither copied nor moved, so it is unpacked in place
+  // rather than with serialize_and_deserialize
+  std::atomic_int test_atomic{7};
+  const std::vector<char> data = serialize<std::atomic_int>(test_atomic);
+  std::atomic_int unpacked_atomic{0};
+  PUP::fromMem reader(data.data());
+  reader | unpacked_atomic;
+  CHECK(7 == unpacked_atomic.load());
+}
+
 /// [example_serialize_derived]
 SPECTRE_TEST_CASE("Unit.Serialization.unique_ptr.abstract_base",
                   "[Serialization][Unit]") {
@@ -41,6 +41,22 @@ using singleton_proxy =
 using array_proxy = CProxy_AlgorithmArray<ArrayParallelComponent, int>;
 using group_proxy = CProxy_AlgorithmGroup<ArrayParallelComponent, int>;
 using nodegroup_proxy = CProxy_AlgorithmNodegroup<ArrayParallelComponent, int>;
+
+enum class PhaseWithCheckpoint { Evolve, WriteCheckpoint, Exit };
+enum class PhaseWithoutCheckpoint { Evolve, Exit };
+enum class PhaseWithLoadBalancing { Evolve, LoadBalancing, Exit };
+enum class PhaseWithoutLoadBalancing { Evolve, Exit };
+enum class PhaseWithAmr { Evolve, EvaluateAmrCriteria, AdjustDomain, Exit };
+enum class PhaseWithoutAdjustDomain { Evolve, EvaluateAmrCriteria, Exit };
+
+struct LoadBalancedArrayParallelComponent {
+  using metavariables = MV;
+  using load_balancing = std::true_type;
+};
+struct OptedOutArrayParallelComponent {
+  using metavariables = MV;
+  using load_balancing = std::false_type;
+};
 }  // namespace
 
 static_assert(Parallel::is_array_proxy<array_proxy>::value,
@@ -100,3 +116,31 @@ static_assert(Parallel::is_pupable_v<PupableClass>,
 static_assert(not Parallel::is_pupable<NonpupableClass>::value,
               "Failed testing type trait is_pupable");
 /// [is_pupable_example]
+
+static_assert(Parallel::has_write_checkpoint_phase_v<PhaseWithCheckpoint>,
+              "Failed testing type trait has_write_checkpoint_phase");
+static_assert(
+    not Parallel::has_write_checkpoint_phase<PhaseWithoutCheckpoint>::value,
+    "Failed testing type trait has_write_checkpoint_phase");
+
+static_assert(Parallel::has_load_balancing_phase_v<PhaseWithLoadBalancing>,
+              "Failed testing type trait has_load_balancing_phase");
+static_assert(
+    not Parallel::has_load_balancing_phase<PhaseWithoutLoadBalancing>::value,
+    "Failed testing type trait has_load_balancing_phase");
+
+static_assert(Parallel::has_amr_phases_v<PhaseWithAmr>,
+              "Failed testing type trait has_amr_phases");
+static_assert(not Parallel::has_amr_phases<PhaseWithoutAdjustDomain>::value,
+              "Failed testing type trait has_amr_phases");
+static_assert(not Parallel::has_amr_phases_v<PhaseWithoutLoadBalancing>,
+              "Failed testing type trait has_amr_phases");
+
+static_assert(
+    Parallel::is_load_balanced_v<LoadBalancedArrayParallelComponent>,
+    "Failed testing type trait is_load_balanced");
+static_assert(
+    not Parallel::is_load_balanced<OptedOutArrayParallelComponent>::value,
+    "Failed testing type trait is_load_balanced");
+static_assert(not Parallel::is_load_balanced_v<ArrayParallelComponent>,
+              "Failed testing type trait is_load_balanced");
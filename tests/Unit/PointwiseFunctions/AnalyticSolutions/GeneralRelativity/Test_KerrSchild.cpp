@@ -12,6 +12,7 @@
 
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
@@ -244,6 +245,49 @@ void test_double_vs_datavector() noexcept {
   check_tensor_doubles_approx_equals_tensor_datavectors(d_g2, d_g1);
 }
 
+template <typename DataType>
+void test_subsets_of_tags(const DataType& used_for_size) noexcept {
+  const gr::Solutions::KerrSchild solution(1.7, {{0.1, 0.2, 0.3}},
+                                           {{0.3, 0.2, 0.4}});
+  const auto x = spatial_coords(used_for_size);
+  const double t = 1.3;
+  const auto all_vars =
+      solution.variables(x, t, gr::Solutions::KerrSchild::tags<DataType>{});
+
+  // The determinant and inverse are computed analytically from H and l_i
+  const auto det_and_inverse = determinant_and_inverse(
+      get<gr::Tags::SpatialMetric<3, Frame::Inertial, DataType>>(all_vars));
+  CHECK_ITERABLE_APPROX(
+      get(get<gr::Tags::SqrtDetSpatialMetric<DataType>>(all_vars)),
+      sqrt(get(det_and_inverse.first)));
+  CHECK_ITERABLE_APPROX(
+      (get<gr::Tags::InverseSpatialMetric<3, Frame::Inertial, DataType>>(
+          all_vars)),
+      det_and_inverse.second);
+
+  // Each variable is the same whether it is requested alone or with others,
+  // including the extrinsic curvature that is computed from other variables.
+  tmpl::for_each<gr::Solutions::KerrSchild::tags<DataType>>(
+      [&solution, &x, &t, &all_vars ](auto tag_v) noexcept {
+        using tag = typename decltype(tag_v)::type;
+        CHECK(get<tag>(solution.variables(x, t, tmpl::list<tag>{})) ==
+              get<tag>(all_vars));
+      });
+  const auto some_vars = solution.variables(
+      x, t,
+      tmpl::list<gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>,
+                 gr::Solutions::KerrSchild::DerivLapse<DataType>,
+                 gr::Tags::Lapse<DataType>>{});
+  CHECK(get<gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>>(
+            some_vars) ==
+        get<gr::Tags::ExtrinsicCurvature<3, Frame::Inertial, DataType>>(
+            all_vars));
+  CHECK(get<gr::Solutions::KerrSchild::DerivLapse<DataType>>(some_vars) ==
+        get<gr::Solutions::KerrSchild::DerivLapse<DataType>>(all_vars));
+  CHECK(get<gr::Tags::Lapse<DataType>>(some_vars) ==
+        get<gr::Tags::Lapse<DataType>>(all_vars));
+}
+
 void test_serialize() noexcept {
   gr::Solutions::KerrSchild solution(3.0, {{0.2, 0.3, 0.2}}, {{0.0, 3.0, 4.0}});
   test_serialization(solution);
@@ -276,6 +320,8 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.AnalyticSolutions.Gr.KerrSchild",
   test_schwarzschild<double>(0.0);
   test_einstein_solution();
   test_double_vs_datavector();
+  test_subsets_of_tags<DataVector>(DataVector{0.0, 0.0, 0.0});
+  test_subsets_of_tags<double>(0.0);
   test_copy_and_move();
   test_serialize();
   test_construct_from_options();
@@ -8,6 +8,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Christoffel.hpp"
+#include "Utilities/Gsl.hpp"
 #include "tests/Unit/Pypp/CheckWithRandomValues.hpp"
 #include "tests/Unit/Pypp/SetupLocalPythonEnvironment.hpp"
 
@@ -15,9 +16,18 @@ namespace {
 template <size_t Dim, IndexType Index, typename DataType>
 void test_christoffel(const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::christoffel_first_kind<Dim, Frame::Inertial, Index, DataType>,
+      static_cast<tnsr::abb<DataType, Dim, Frame::Inertial, Index> (*)(
+          const tnsr::abb<DataType, Dim, Frame::Inertial, Index>&)>(
+          &gr::christoffel_first_kind<Dim, Frame::Inertial, Index, DataType>),
       "TestFunctions", "christoffel_first_kind", {{{-10.0, 10.0}}},
       used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<tnsr::abb<DataType, Dim, Frame::Inertial, Index>*>,
+          const tnsr::abb<DataType, Dim, Frame::Inertial, Index>&)>(
+          &gr::christoffel_first_kind<Dim, Frame::Inertial, Index, DataType>),
+      "TestFunctions", {"christoffel_first_kind"}, {{{-10.0, 10.0}}},
+      used_for_size);
 }
 }  // namespace
 
@@ -20,30 +20,91 @@ namespace {
 template <size_t Dim, typename DataType>
 void test_compute_spacetime_metric(const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::spacetime_metric<Dim, Frame::Inertial, DataType>, "TestFunctions",
-      "spacetime_metric", {{{-10., 10.}}}, used_for_size);
+      static_cast<tnsr::aa<DataType, Dim, Frame::Inertial> (*)(
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&)>(
+          &gr::spacetime_metric<Dim, Frame::Inertial, DataType>),
+      "TestFunctions", "spacetime_metric", {{{-10., 10.}}}, used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<tnsr::aa<DataType, Dim, Frame::Inertial>*>,
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&)>(
+          &gr::spacetime_metric<Dim, Frame::Inertial, DataType>),
+      "TestFunctions", {"spacetime_metric"}, {{{-10., 10.}}}, used_for_size);
 }
 template <size_t Dim, typename DataType>
 void test_compute_inverse_spacetime_metric(const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::inverse_spacetime_metric<Dim, Frame::Inertial, DataType>,
+      static_cast<tnsr::AA<DataType, Dim, Frame::Inertial> (*)(
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::II<DataType, Dim, Frame::Inertial>&)>(
+          &gr::inverse_spacetime_metric<Dim, Frame::Inertial, DataType>),
       "TestFunctions", "inverse_spacetime_metric", {{{-10., 10.}}},
       used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<tnsr::AA<DataType, Dim, Frame::Inertial>*>,
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::II<DataType, Dim, Frame::Inertial>&)>(
+          &gr::inverse_spacetime_metric<Dim, Frame::Inertial, DataType>),
+      "TestFunctions", {"inverse_spacetime_metric"}, {{{-10., 10.}}},
+      used_for_size);
 }
 template <size_t Dim, typename DataType>
 void test_compute_derivatives_of_spacetime_metric(
     const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::derivatives_of_spacetime_metric<Dim, Frame::Inertial, DataType>,
+      static_cast<tnsr::abb<DataType, Dim, Frame::Inertial> (*)(
+          const Scalar<DataType>&, const Scalar<DataType>&,
+          const tnsr::i<DataType, Dim, Frame::Inertial>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::iJ<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ijj<DataType, Dim, Frame::Inertial>&)>(
+          &gr::derivatives_of_spacetime_metric<Dim, Frame::Inertial,
+                                               DataType>),
       "TestFunctions", "derivatives_of_spacetime_metric", {{{-10., 10.}}},
       used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<tnsr::abb<DataType, Dim, Frame::Inertial>*>,
+          const Scalar<DataType>&, const Scalar<DataType>&,
+          const tnsr::i<DataType, Dim, Frame::Inertial>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::iJ<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ijj<DataType, Dim, Frame::Inertial>&)>(
+          &gr::derivatives_of_spacetime_metric<Dim, Frame::Inertial,
+                                               DataType>),
+      "TestFunctions", {"derivatives_of_spacetime_metric"}, {{{-10., 10.}}},
+      used_for_size);
 }
 template <size_t Dim, typename DataType>
 void test_compute_spacetime_normal_vector(const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::spacetime_normal_vector<Dim, Frame::Inertial, DataType>,
+      static_cast<tnsr::A<DataType, Dim, Frame::Inertial> (*)(
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&)>(
+          &gr::spacetime_normal_vector<Dim, Frame::Inertial, DataType>),
       "TestFunctions", "spacetime_normal_vector", {{{-10., 10.}}},
       used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<tnsr::A<DataType, Dim, Frame::Inertial>*>,
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&)>(
+          &gr::spacetime_normal_vector<Dim, Frame::Inertial, DataType>),
+      "TestFunctions", {"spacetime_normal_vector"}, {{{-10., 10.}}},
+      used_for_size);
 }
 template <size_t Dim, typename DataType>
 void test_compute_spacetime_normal_one_form(const DataType& used_for_size) {
@@ -62,12 +123,39 @@ void test_compute_spacetime_normal_one_form(const DataType& used_for_size) {
     CHECK_ITERABLE_APPROX(spacetime_normal_one_form.get(i + 1),
                           make_with_value<DataType>(used_for_size, 0.));
   }
+
+  // The spatial components are reset when the result is reused
+  auto reused_normal_one_form =
+      make_with_value<tnsr::a<DataType, Dim, Frame::Inertial>>(used_for_size,
+                                                                1.0);
+  gr::spacetime_normal_one_form(make_not_null(&reused_normal_one_form),
+                                lapse);
+  CHECK(reused_normal_one_form == spacetime_normal_one_form);
 }
 template <size_t Dim, typename DataType>
 void test_compute_extrinsic_curvature(const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::extrinsic_curvature<Dim, Frame::Inertial, DataType>, "TestFunctions",
-      "extrinsic_curvature", {{{-10., 10.}}}, used_for_size);
+      static_cast<tnsr::ii<DataType, Dim, Frame::Inertial> (*)(
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::iJ<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ijj<DataType, Dim, Frame::Inertial>&)>(
+          &gr::extrinsic_curvature<Dim, Frame::Inertial, DataType>),
+      "TestFunctions", "extrinsic_curvature", {{{-10., 10.}}}, used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<tnsr::ii<DataType, Dim, Frame::Inertial>*>,
+          const Scalar<DataType>&,
+          const tnsr::I<DataType, Dim, Frame::Inertial>&,
+          const tnsr::iJ<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ii<DataType, Dim, Frame::Inertial>&,
+          const tnsr::ijj<DataType, Dim, Frame::Inertial>&)>(
+          &gr::extrinsic_curvature<Dim, Frame::Inertial, DataType>),
+      "TestFunctions", {"extrinsic_curvature"}, {{{-10., 10.}}},
+      used_for_size);
 }
 
 template <size_t Dim, typename T>
@@ -112,6 +200,22 @@ void test_compute_spatial_metric_lapse_shift(const T& used_for_size) {
   CHECK_ITERABLE_APPROX(spatial_metric, spatial_metric_test);
   CHECK_ITERABLE_APPROX(shift, shift_test);
   CHECK_ITERABLE_APPROX(lapse, lapse_test);
+
+  // The overloads taking a gsl::not_null size an empty result
+  tnsr::aa<T, Dim> psi_not_null{};
+  gr::spacetime_metric(make_not_null(&psi_not_null), lapse, shift,
+                       spatial_metric);
+  CHECK(psi_not_null == psi);
+  tnsr::ii<T, Dim> spatial_metric_not_null{};
+  gr::spatial_metric(make_not_null(&spatial_metric_not_null), psi);
+  CHECK(spatial_metric_not_null == spatial_metric_test);
+  tnsr::I<T, Dim> shift_not_null{};
+  gr::shift(make_not_null(&shift_not_null), psi,
+            determinant_and_inverse(spatial_metric).second);
+  CHECK(shift_not_null == shift_test);
+  Scalar<T> lapse_not_null{};
+  gr::lapse(make_not_null(&lapse_not_null), shift, psi);
+  CHECK(lapse_not_null == lapse_test);
 }
 
 }  // namespace
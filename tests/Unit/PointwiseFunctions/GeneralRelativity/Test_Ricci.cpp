@@ -8,6 +8,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/Ricci.hpp"
+#include "Utilities/Gsl.hpp"
 #include "tests/Unit/Pypp/CheckWithRandomValues.hpp"
 #include "tests/Unit/Pypp/SetupLocalPythonEnvironment.hpp"
 
@@ -19,8 +20,19 @@ namespace {
 template <size_t Dim, IndexType TypeOfIndex, typename DataType>
 void test_ricci(const DataType& used_for_size) {
   pypp::check_with_random_values<1>(
-      &gr::ricci_tensor<Dim, Frame::Inertial, TypeOfIndex, DataType>,
+      static_cast<tnsr::aa<DataType, Dim, Frame::Inertial, TypeOfIndex> (*)(
+          const tnsr::Abb<DataType, Dim, Frame::Inertial, TypeOfIndex>&,
+          const tnsr::aBcc<DataType, Dim, Frame::Inertial, TypeOfIndex>&)>(
+          &gr::ricci_tensor<Dim, Frame::Inertial, TypeOfIndex, DataType>),
       "TestFunctions", "ricci_tensor", {{{-1., 1.}}}, used_for_size);
+  pypp::check_with_random_values<1>(
+      static_cast<void (*)(
+          gsl::not_null<
+              tnsr::aa<DataType, Dim, Frame::Inertial, TypeOfIndex>*>,
+          const tnsr::Abb<DataType, Dim, Frame::Inertial, TypeOfIndex>&,
+          const tnsr::aBcc<DataType, Dim, Frame::Inertial, TypeOfIndex>&)>(
+          &gr::ricci_tensor<Dim, Frame::Inertial, TypeOfIndex, DataType>),
+      "TestFunctions", {"ricci_tensor"}, {{{-1., 1.}}}, used_for_size);
 }
 }  // namespace
 
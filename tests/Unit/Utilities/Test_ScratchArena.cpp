@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ScratchArena.hpp"
+
+namespace {
+void fill(double* const data, const size_t size, const double value) noexcept {
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = value;  // NOLINT
+  }
+}
+
+bool all_equal(const double* const data, const size_t size,
+               const double value) noexcept {
+  for (size_t i = 0; i < size; ++i) {
+    if (data[i] != value) {  // NOLINT
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.ScratchArena", "[Utilities][Unit]") {
+  ScratchArena arena{};
+  CHECK(arena.number_of_heap_allocations() == 0);
+  CHECK(arena.capacity() == 0);
+  // Empty allocations do not touch the heap.
+  CHECK(arena.allocate(0) == nullptr);
+  CHECK(arena.number_of_heap_allocations() == 0);
+  CHECK(arena.capacity() == 0);
+
+  const auto compute = [&arena]() noexcept {
+    /// [scratch_arena_example]
+    const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+    double* const a = arena.allocate(100);
+    fill(a, 100, 1.0);
+    {
+      const ScratchArena::Checkpoint inner_checkpoint(make_not_null(&arena));
+      double* const b = arena.allocate(10000);
+      fill(b, 10000, 2.0);
+      double* const c = arena.allocate(200000);
+      fill(c, 200000, 3.0);
+      CHECK(all_equal(b, 10000, 2.0));
+    }
+    // b and c have been released, but a is still valid.
+    double* const d = arena.allocate(50);
+    fill(d, 50, 4.0);
+    CHECK(all_equal(a, 100, 1.0));
+    /// [scratch_arena_example]
+  };
+
+  compute();
+  const size_t heap_allocations = arena.number_of_heap_allocations();
+  const size_t capacity = arena.capacity();
+  CHECK(heap_allocations > 0);
+  CHECK(capacity >= 210150);
+  for (size_t i = 0; i < 3; ++i) {
+    compute();
+    CHECK(arena.number_of_heap_allocations() == heap_allocations);
+    CHECK(arena.capacity() == capacity);
+  }
+
+  // Rewinding to a checkpoint makes the memory available again.
+  double* first = nullptr;
+  {
+    const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+    first = arena.allocate(10);
+  }
+  {
+    const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+    CHECK(arena.allocate(10) == first);
+  }
+
+  // Moving a checkpoint transfers the responsibility for rewinding.
+  {
+    const ScratchArena::Checkpoint checkpoint(make_not_null(&arena));
+    double* const a = arena.allocate(10);
+    ScratchArena::Checkpoint original(make_not_null(&arena));
+    {
+      const ScratchArena::Checkpoint moved_to(std::move(original));
+      arena.allocate(10);
+    }
+    // clang-tidy: pointer arithmetic
+    CHECK(arena.allocate(10) == a + 10);  // NOLINT
+  }
+
+  CHECK(&ScratchArena::thread_local_instance() ==
+        &ScratchArena::thread_local_instance());
+}
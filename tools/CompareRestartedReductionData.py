@@ -0,0 +1,92 @@
+#!/bin/env python
+
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import sys
+
+import h5py
+import numpy as np
+
+
+def dat_files(h5file):
+    """
+    Return the paths of all Dat subfiles in the H5 file.
+    """
+    paths = []
+    h5file.visititems(lambda name, obj: paths.append(name) if isinstance(
+        obj, h5py.Dataset) and name.endswith('.dat') else None)
+    return sorted(paths)
+
+
+def compare_restarted_reduction_data(straight_filename, restarted_filename):
+    """
+    Check that a simulation restarted from a checkpoint wrote the same
+    reduction data as a simulation that ran straight through.
+
+    The restarted simulation only writes the rows observed after the
+    checkpoint, so these must equal the last rows of the straight-through
+    simulation. Returns the list of errors found.
+    """
+    errors = []
+    with h5py.File(straight_filename, 'r') as straight_file, \
+            h5py.File(restarted_filename, 'r') as restarted_file:
+        straight_paths = dat_files(straight_file)
+        restarted_paths = dat_files(restarted_file)
+        if straight_paths != restarted_paths:
+            return [
+                "The subfiles %s of %s differ from the subfiles %s of %s" %
+                (straight_paths, straight_filename, restarted_paths,
+                 restarted_filename)
+            ]
+        if len(restarted_paths) == 0:
+            return ["No reduction data in %s" % restarted_filename]
+        for path in restarted_paths:
+            straight_rows = np.array(straight_file[path])
+            restarted_rows = np.array(restarted_file[path])
+            if len(restarted_rows) == 0:
+                errors.append("The restarted run wrote no rows to %s" % path)
+            elif len(restarted_rows) >= len(straight_rows):
+                errors.append(
+                    "The restarted run wrote %d rows to %s, but must write "
+                    "fewer than the %d rows of the run without restart" %
+                    (len(restarted_rows), path, len(straight_rows)))
+            elif not np.array_equal(straight_rows[-len(restarted_rows):],
+                                    restarted_rows):
+                errors.append(
+                    "The rows written to %s after the restart differ from "
+                    "those of the run without restart" % path)
+    return errors
+
+
+def parse_args():
+    """
+    Parse the command line arguments
+    """
+    import argparse as ap
+    parser = ap.ArgumentParser(
+        description="Compare the reduction data written by a simulation "
+        "restarted from a checkpoint to that written by the same simulation "
+        "without restarting.",
+        formatter_class=ap.ArgumentDefaultsHelpFormatter)
+    parser.add_argument(
+        '--straight-through',
+        required=True,
+        help="The H5 reduction file of the run without restart")
+    parser.add_argument(
+        '--restarted',
+        required=True,
+        help="The H5 reduction file of the restarted run, which was run in "
+        "a different directory")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    input_args = parse_args()
+    errors = compare_restarted_reduction_data(input_args.straight_through,
+                                              input_args.restarted)
+    for error in errors:
+        print("ERROR: " + error)
+    if len(errors) != 0:
+        sys.exit(1)
+    print("The restarted reduction data matches.")